@@ -212,7 +212,7 @@ int main(int argc,char ** argv){
     bool tx_started = false;
     printf("Running\n");
     tdma_start_tx(tdma,0);
-    tdma->state = master_sync;
+    tdma_set_master(tdma,true);
     for(size_t i = 0; i<30000; i++){
        /* if(i>200 && !tx_started){
             if(tdma_get_slot(tdma,0)->state == rx_sync){
@@ -72,11 +72,28 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <math.h>
+#include <string.h>
+#include <pthread.h>
 
 #include "fsk.h"
 #include "comp_prim.h"
-#include "kiss_fftr.h"
 #include "modem_probe.h"
+#include "tdma_perf.h"
+
+#ifdef MODEMPROBE_ENABLE
+/* Per-tone trace names. Constant so that nothing is formatted per sample, and so
+   the binary probe can find the trace from the pointer alone */
+static char * const fsk_probe_dc_names[MODE_M_MAX] = {"t_f1_dc","t_f2_dc","t_f3_dc","t_f4_dc"};
+static char * const fsk_probe_int_names[MODE_M_MAX] = {"t_f1_int","t_f2_int","t_f3_int","t_f4_int"};
+static char * const fsk_probe_f_names[MODE_M_MAX] = {"t_f1","t_f2","t_f3","t_f4"};
+#endif
+
+/* Save the time since t as the given demod stage, and restart t */
+#ifdef TDMA_PERF_ENABLE
+#define FSK_PERF_MARK(fsk,stage,t) do{ uint64_t now_ = tdma_perf_now(); (fsk)->perf_ns[stage] = now_-(t); (t) = now_; }while(0)
+#else
+#define FSK_PERF_MARK(fsk,stage,t)
+#endif
 
 /*---------------------------------------------------------------------------*\
 
@@ -112,6 +129,24 @@ static void fsk_generate_hann_table(struct FSK* fsk){
 #endif
 
 
+/* Get the freq est FFT for fsk->Ndft and its buffers. Returns -1 on failure */
+static int fsk_fft_alloc(struct FSK *fsk){
+    fsk->fft = modem_fft_get(fsk->Ndft,MODEM_FFT_C2C);
+    fsk->fft_in = (COMP*)modem_fft_malloc(sizeof(COMP)*fsk->Ndft);
+    fsk->fft_out = (COMP*)modem_fft_malloc(sizeof(COMP)*fsk->Ndft);
+    if(fsk->fft == NULL || fsk->fft_in == NULL || fsk->fft_out == NULL)
+        return -1;
+    return 0;
+}
+
+static void fsk_fft_free(struct FSK *fsk){
+    modem_fft_put(fsk->fft);
+    modem_fft_free(fsk->fft_in);
+    modem_fft_free(fsk->fft_out);
+    fsk->fft = NULL;
+    fsk->fft_in = NULL;
+    fsk->fft_out = NULL;
+}
 
 /*---------------------------------------------------------------------------*\
 
@@ -198,27 +233,17 @@ struct FSK * fsk_create_hbr(int Fs, int Rs,int P,int M, int tx_f1, int tx_fs)
         fsk->samp_old[i].imag = 0;
     }
 
-    #ifndef USE_FFTW
-    fsk->fft_cfg = kiss_fft_alloc(fsk->Ndft,0,NULL,NULL);
-    if(fsk->fft_cfg == NULL){
+    if(fsk_fft_alloc(fsk)){
+        fsk_fft_free(fsk);
         free(fsk->samp_old);
         free(fsk);
         return NULL;
     }
-    #else
-    fsk->fft_in = fftwf_malloc(fsk->Ndft * sizeof(fftwf_complex));
-    fsk->fft_out = fftwf_malloc(fsk->Ndft * sizeof(fftwf_complex));
-    fsk->fftw_cfg = fftwf_plan_dft_1d(fsk->Ndft, fsk->fft_in, fsk->fft_out, FFTW_FORWARD, FFTW_ESTIMATE);
-    #endif
     
     fsk->fft_est = (float*)malloc(sizeof(float)*fsk->Ndft/2);
     if(fsk->fft_est == NULL){
         free(fsk->samp_old);
-        #ifndef USE_FFTW
-        free(fsk->fft_cfg);
-        #else
-        fftwf_destroy_plan(fsk->fftw_cfg);
-        #endif
+        fsk_fft_free(fsk);
         free(fsk);
         return NULL;
     }
@@ -229,11 +254,7 @@ struct FSK * fsk_create_hbr(int Fs, int Rs,int P,int M, int tx_f1, int tx_fs)
             if(fsk->hann_table == NULL){
                 free(fsk->fft_est);
                 free(fsk->samp_old);
-                #ifndef USE_FFTW
-                free(fsk->fft_cfg);
-                #else
-                fftwf_destroy_plan(fsk->fftw_cfg);
-                #endif
+                fsk_fft_free(fsk);
                 free(fsk);
                 return NULL;
             }
@@ -258,20 +279,22 @@ struct FSK * fsk_create_hbr(int Fs, int Rs,int P,int M, int tx_f1, int tx_fs)
     
     fsk->ppm = 0;
 
-    fsk->stats = (struct MODEM_STATS*)malloc(sizeof(struct MODEM_STATS));
-    if(fsk->stats == NULL){
-        free(fsk->fft_est);
-        free(fsk->samp_old);
-        #ifndef USE_FFTW
-        free(fsk->fft_cfg);
-        #else
-        fftwf_destroy_plan(fsk->fftw_cfg);
-        #endif
-        free(fsk);
+    /* Stats storage is allocated by fsk_set_stats_level */
+    fsk->stats = NULL;
+    fsk->stats_owned = 0;
+    fsk->normalise_eye = 1;
+    fsk->stats_level = FSK_STATS_NONE;
+    fsk->eye_int = NULL;
+    fsk->eye_pending = 0;
+
+    fsk->fixed_point = 0;
+    fsk->fixed_scale = FSK_SCALE;
+    for( i=0; i<M; i++)
+        fsk->phi_q[i] = 0;
+    if(fsk_set_stats_level(fsk,FSK_STATS_FULL)){
+        fsk_destroy(fsk);
         return NULL;
     }
-    stats_init(fsk);
-    fsk->normalise_eye = 1;
 
     return fsk;
 }
@@ -354,21 +377,17 @@ struct FSK * fsk_create(int Fs, int Rs,int M, int tx_f1, int tx_fs)
         fsk->samp_old[i].imag = 0.0;
     }
     
-    #ifndef USE_FFTW
-    fsk->fft_cfg = kiss_fft_alloc(Ndft,0,NULL,NULL);
-    if(fsk->fft_cfg == NULL){
+    if(fsk_fft_alloc(fsk)){
+        fsk_fft_free(fsk);
         free(fsk->samp_old);
         free(fsk);
         return NULL;
     }
-    #endif
     
     fsk->fft_est = (float*)malloc(sizeof(float)*fsk->Ndft/2);
     if(fsk->fft_est == NULL){
         free(fsk->samp_old);
-        #ifndef USE_FFTW
-        free(fsk->fft_cfg);
-        #endif
+        fsk_fft_free(fsk);
         free(fsk);
         return NULL;
     }
@@ -379,9 +398,7 @@ struct FSK * fsk_create(int Fs, int Rs,int M, int tx_f1, int tx_fs)
             if(fsk->hann_table == NULL){
                 free(fsk->fft_est);
                 free(fsk->samp_old);
-                #ifndef USE_FFTW
-                free(fsk->fft_cfg);
-                #endif
+                fsk_fft_free(fsk);
                 free(fsk);
                 return NULL;
             }
@@ -406,19 +423,22 @@ struct FSK * fsk_create(int Fs, int Rs,int M, int tx_f1, int tx_fs)
     
     fsk->ppm = 0;
     
-    fsk->stats = (struct MODEM_STATS*)malloc(sizeof(struct MODEM_STATS));
-    
-    if(fsk->stats == NULL){
-        free(fsk->fft_est);
-        free(fsk->samp_old);
-        #ifndef USE_FFTW
-        free(fsk->fft_cfg);
-        #endif
-        free(fsk);
+    /* Stats storage is allocated by fsk_set_stats_level */
+    fsk->stats = NULL;
+    fsk->stats_owned = 0;
+    fsk->normalise_eye = 1;
+    fsk->stats_level = FSK_STATS_NONE;
+    fsk->eye_int = NULL;
+    fsk->eye_pending = 0;
+
+    fsk->fixed_point = 0;
+    fsk->fixed_scale = FSK_SCALE;
+    for( i=0; i<M; i++)
+        fsk->phi_q[i] = 0;
+    if(fsk_set_stats_level(fsk,FSK_STATS_FULL)){
+        fsk_destroy(fsk);
         return NULL;
     }
-    stats_init(fsk);
-    fsk->normalise_eye = 1;
     
     return fsk;
 }
@@ -460,7 +480,7 @@ static void stats_init(struct FSK *fsk) {
 }
 
 
-void fsk_set_nsym(struct FSK *fsk,int nsyms){
+int fsk_set_nsym(struct FSK *fsk,int nsyms){
     assert(nsyms>0);
     int Ndft,i;
     Ndft = 0;
@@ -483,29 +503,23 @@ void fsk_set_nsym(struct FSK *fsk,int nsyms){
     free(fsk->fft_est);
     fsk->fft_est = (float*)malloc(sizeof(float)*fsk->Ndft/2);
 
-    #ifndef USE_FFTW
-    free(fsk->fft_cfg);
-    
-    fsk->fft_cfg = kiss_fft_alloc(Ndft,0,NULL,NULL);
-    #else
-    fftwf_destroy_plan(fsk->fftw_cfg);
-    fftwf_free(fsk->fft_in);
-    fftwf_free(fsk->fft_out);
-    fsk->fft_in = fftwf_malloc(fsk->Ndft * sizeof(fftwf_complex));
-    fsk->fft_out = fftwf_malloc(fsk->Ndft * sizeof(fftwf_complex));
-    fsk->fftw_cfg = fftwf_plan_dft_1d(fsk->Ndft, fsk->fft_in, fsk->fft_out, FFTW_FORWARD, FFTW_ESTIMATE);
-    #endif
+    /* Plans are shared, so this is only a lookup unless Ndft is new */
+    fsk_fft_free(fsk);
+    if(fsk_fft_alloc(fsk) || fsk->fft_est == NULL)
+        return -1;
 
     for(i=0;i<Ndft/2;i++)fsk->fft_est[i] = 0;
-    
+    return 0;
 }
 
 /* Set the FSK modem into burst demod mode */
 
-void fsk_enable_burst_mode(struct FSK *fsk,int nsyms){
-    fsk_set_nsym(fsk,nsyms);
+int fsk_enable_burst_mode(struct FSK *fsk,int nsyms){
+    if(fsk_set_nsym(fsk,nsyms))
+        return -1;
     fsk->nin = fsk->N;
     fsk->burst_mode = 1;
+    return 0;
 }
 
 void fsk_clear_estimators(struct FSK *fsk){
@@ -523,24 +537,166 @@ uint32_t fsk_nin(struct FSK *fsk){
 }
 
 void fsk_destroy(struct FSK *fsk){
-    #ifndef USE_FFTW
-    free(fsk->fft_cfg);
-    #else
-    fftwf_destroy_plan(fsk->fftw_cfg);
-    fftwf_free(fsk->fft_out);
-    fftwf_free(fsk->fft_in);
-    #endif
+    fsk_fft_free(fsk);
     free(fsk->samp_old);
-    free(fsk->stats);
+    free(fsk->fft_est);
+    #if defined(USE_HANN_TABLE) && defined(GENERATE_HANN_TABLE_RUNTIME)
+    free(fsk->hann_table);
+    #endif
+    if(fsk->stats_owned)
+        free(fsk->stats);
+    free(fsk->eye_int);
     free(fsk);
 }
 
+/* Eye traces are two symbols of integrator output each, decimated so they fit in rx_eye */
+static int fsk_eye_traces(struct FSK *fsk){
+    return MODEM_STATS_ET_MAX/fsk->mode;
+}
+
+static int fsk_eye_dec(struct FSK *fsk){
+    return ceil(((float)fsk->P*2)/MODEM_STATS_EYE_IND_MAX);
+}
+
+/* Integrator outputs per tone that the eye traces touch */
+static int fsk_eye_span(struct FSK *fsk){
+    int dec = fsk_eye_dec(fsk);
+    int neyesamp = (fsk->P*2)/dec;
+    return 2*fsk->P*(fsk_eye_traces(fsk)-1) + (neyesamp-1)*dec + 1;
+}
+
+int fsk_set_stats_level(struct FSK *fsk, int level){
+    assert(level >= FSK_STATS_NONE && level <= FSK_STATS_FULL);
+    if(level > FSK_STATS_NONE && fsk->stats == NULL){
+        fsk->stats = (struct MODEM_STATS*)malloc(sizeof(struct MODEM_STATS));
+        if(fsk->stats == NULL)
+            return -1;
+        fsk->stats_owned = 1;
+        stats_init(fsk);
+    }
+    if(level == FSK_STATS_FULL && fsk->eye_int == NULL){
+        fsk->eye_int = (COMP*)malloc(sizeof(COMP)*fsk->mode*fsk_eye_span(fsk));
+        if(fsk->eye_int == NULL)
+            return -1;
+    }
+
+    /* Give back whatever the new level doesn't use */
+    if(level < FSK_STATS_FULL){
+        free(fsk->eye_int);
+        fsk->eye_int = NULL;
+    }
+    if(level == FSK_STATS_NONE && fsk->stats_owned){
+        free(fsk->stats);
+        fsk->stats = NULL;
+        fsk->stats_owned = 0;
+    }
+    fsk->eye_pending = 0;
+    fsk->stats_level = level;
+    return 0;
+}
+
+int fsk_set_stats_buffer(struct FSK *fsk, struct MODEM_STATS *stats){
+    if(fsk->stats_owned)
+        free(fsk->stats);
+    fsk->stats = stats;
+    fsk->stats_owned = 0;
+    fsk->eye_pending = 0;
+    if(stats != NULL){
+        stats_init(fsk);
+        return 0;
+    }
+    /* Back to our own storage, if the stats level needs any */
+    return fsk_set_stats_level(fsk,fsk->stats_level);
+}
+
+size_t fsk_get_footprint(struct FSK *fsk){
+    size_t bytes = sizeof(struct FSK);
+    bytes += sizeof(COMP)*fsk->nstash;
+    bytes += sizeof(float)*fsk->Ndft/2;
+    #if defined(USE_HANN_TABLE) && defined(GENERATE_HANN_TABLE_RUNTIME)
+    bytes += sizeof(float)*fsk->Ndft;
+    #endif
+    bytes += 2*sizeof(COMP)*fsk->Ndft;
+    if(fsk->stats_owned)
+        bytes += sizeof(struct MODEM_STATS);
+    if(fsk->eye_int != NULL)
+        bytes += sizeof(COMP)*fsk->mode*fsk_eye_span(fsk);
+    return bytes;
+}
+
+/* Pull the eye diagram out of the integrator outputs saved by the last demod */
+static void fsk_update_eye(struct FSK *fsk){
+    int i,j,m;
+    int P = fsk->P;
+    int M = fsk->mode;
+    int eye_traces = fsk_eye_traces(fsk);
+    int eye_span = fsk_eye_span(fsk);
+    float eye_max;
+
+    /* due to oversample rate P, we have too many samples for eye
+       trace.  So lets output a decimated version.  We use 2P
+       as we want two symbols worth of samples in trace  */
+
+    int neyesamp_dec = fsk_eye_dec(fsk);
+    int neyesamp = (P*2)/neyesamp_dec;
+    assert(neyesamp <= MODEM_STATS_EYE_IND_MAX);
+    fsk->stats->neyesamp = neyesamp;
+    fsk->stats->neyetr = M*eye_traces;
+
+    for( i=0; i<eye_traces; i++){
+        for ( m=0; m<M; m++){
+            for(j=0; j<neyesamp; j++) {
+               /*
+                  2*P*i...........: advance two symbols for next trace
+                  j*neweyesamp_dec: For 2*P>MODEM_STATS_EYE_IND_MAX advance through integrated 
+                                    samples newamp_dec at a time so we dont overflow rx_eye[][]
+                  eye_int already starts at the ideal timing offset
+               */
+               assert((i*M+m) < MODEM_STATS_ET_MAX);
+               fsk->stats->rx_eye[i*M+m][j] = cabsolute(fsk->eye_int[m*eye_span + 2*P*i + j*neyesamp_dec]);
+            }
+        }
+    }
+
+    if (fsk->normalise_eye) {
+        eye_max = 0;
+        /* Normalize eye to +/- 1 */
+        for(i=0; i<M*eye_traces; i++)
+            for(j=0; j<neyesamp; j++)
+                if(fabsf(fsk->stats->rx_eye[i][j])>eye_max)
+                    eye_max = fabsf(fsk->stats->rx_eye[i][j]);
+        
+        for(i=0; i<M*eye_traces; i++)
+            for(j=0; j<neyesamp; j++)
+                fsk->stats->rx_eye[i][j] = fsk->stats->rx_eye[i][j]/eye_max;
+    }
+    fsk->eye_pending = 0;
+}
+
 void fsk_get_demod_stats(struct FSK *fsk, struct MODEM_STATS *stats){
     /* copy from internal stats, note we can't overwrite stats completely
        as it has other states rqd by caller, also we want a consistent
        interface across modem types for the freedv_api.
     */
 
+    /* Nothing kept; give what the demod always works out */
+    if(fsk->stats == NULL){
+        stats->clock_offset = fsk->ppm;
+        stats->snr_est = fsk->EbNodB;
+        stats->rx_timing = fsk->norm_rx_timing*fsk->P;
+        stats->foff = (fsk->f1_tx+fsk->f1_tx+fsk->fs_tx)/2 - (fsk->f_est[0]+fsk->f_est[1])/2;
+        stats->neyesamp = 0;
+        stats->neyetr = 0;
+        memcpy(stats->f_est, fsk->f_est, fsk->mode*sizeof(float));
+        stats->sync = 0;
+        stats->nr = 0;
+        stats->Nc = 0;
+        return;
+    }
+
+    if(fsk->stats_level == FSK_STATS_FULL && fsk->eye_pending)
+        fsk_update_eye(fsk);
+
     stats->clock_offset = fsk->stats->clock_offset;
     stats->snr_est = fsk->stats->snr_est;           // TODO: make this SNR not Eb/No
     stats->rx_timing = fsk->stats->rx_timing;
@@ -591,21 +747,8 @@ void fsk_demod_freq_est(struct FSK *fsk, COMP fsk_in[],float *freqs,int M){
     int freqi[M];
     int f_min,f_max,f_zero;
     
-    #ifndef USE_FFTW
-    kiss_fft_cfg fft_cfg = fsk->fft_cfg;
-    /* Array to do complex FFT from using kiss_fft */
-    #ifdef DEMOD_ALLOC_STACK
-    COMP *fftin  = (COMP*)alloca(sizeof(kiss_fft_cpx)*Ndft);
-    COMP *fftout = (COMP*)alloca(sizeof(kiss_fft_cpx)*Ndft);
-    #else
-    kiss_fft_cpx *fftin  = (kiss_fft_cpx*)malloc(sizeof(kiss_fft_cpx)*Ndft);
-    kiss_fft_cpx *fftout = (kiss_fft_cpx*)malloc(sizeof(kiss_fft_cpx)*Ndft);
-    #endif
-    
-    #else
-    COMP *fftin = (COMP*)fsk->fft_in;
-    COMP *fftout = (COMP*)fsk->fft_out;
-    #endif
+    COMP *fftin = fsk->fft_in;
+    COMP *fftout = fsk->fft_out;
 
     #ifndef USE_HANN_TABLE
     COMP dphi = comp_exp_j((2*M_PI)/((float)Ndft-1));
@@ -650,12 +793,8 @@ void fsk_demod_freq_est(struct FSK *fsk, COMP fsk_in[],float *freqs,int M){
             fftin[i].imag = 0;
         }
         
-        #ifndef USE_FFTW
         /* Do the FFT */
-        kiss_fft(fft_cfg,(kiss_fft_cpx*)fftin,(kiss_fft_cpx*)fftout);
-        #else
-        fftwf_execute(fsk->fftw_cfg);
-        #endif
+        modem_fft_c2c(fsk->fft,fftin,fftout);
         
         /* Find the magnitude^2 of each freq slot and stash away in the real
         * value, so this only has to be done once. Since we're only comparing
@@ -722,14 +861,509 @@ void fsk_demod_freq_est(struct FSK *fsk, COMP fsk_in[],float *freqs,int M){
     for(i=0; i<M; i++){
         freqs[i] = (float)(freqi[i])*((float)Fs/(float)Ndft);
     }
+}
+
+/* Update the clock offset estimate and nin from a new timing estimate */
+static void fsk_update_timing(struct FSK *fsk, float norm_rx_timing){
+    int N = fsk->N;
+    int Ts = fsk->Ts;
+    int nsym = fsk->Nsym;
+    float old_norm_rx_timing,d_norm_rx_timing,appm;
+    
+    old_norm_rx_timing = fsk->norm_rx_timing;
+    fsk->norm_rx_timing = norm_rx_timing;
+    
+    /* Estimate sample clock offset */
+    d_norm_rx_timing = norm_rx_timing - old_norm_rx_timing;
+    
+    /* Filter out big jumps in due to nin change */
+    if(fabsf(d_norm_rx_timing) < .2){
+        appm = 1e6*d_norm_rx_timing/(float)nsym;
+        fsk->ppm = .9*fsk->ppm + .1*appm;
+    }
+    
+    /* Figure out how many samples are needed the next modem cycle */
+    /* Unless we're in burst mode */
+    if(!fsk->burst_mode){
+        if(norm_rx_timing > 0.25)
+            fsk->nin = N+Ts/2;
+        else if(norm_rx_timing < -0.25)
+            fsk->nin = N-Ts/2;
+        else
+            fsk->nin = N;
+    }
+    
+    modem_probe_samp_f("t_norm_rx_timing",&(norm_rx_timing),1);
+    modem_probe_samp_i("t_nin",&(fsk->nin),1);
+}
+
+/* Turn the tone magnitudes of a batch into LLRs, log(P(0)/P(1)), positive for a 0.
+   Tone magnitudes are Rician, so log p(tone k sent) is log(I0(v*|r_k|/sigma^2)) plus
+   a term common to all k. sigma^2 comes from the power in the tones not chosen, and
+   v^2 from the power in the chosen ones less that of the noise.
+
+   Each pass runs across the whole batch without branches, so it vectorizes. Only
+   the logf/expf/log1pf calls need a vector math library (and -ffast-math) to go too */
+static void fsk_sd_to_llr(struct FSK *fsk, float rx_sd[], const float mag[], float sig_pwr, float noise_pwr){
+    int nsym = fsk->Nsym;
+    int M = fsk->mode;
+    int n = nsym*M;
+    int i;
+    float var = noise_pwr/(float)(2*(M-1)*nsym) + 1e-12f;
+    float v2 = sig_pwr/(float)nsym - 2*var;
+    /* Don't believe more than 60dB of SNR */
+    float scale = sqrtf(fmaxf(v2,0))/fmaxf(var,1e-6f*v2);
+    float mu[n], lin[n], half[n];
+
+    /* log(I0(x)) by Abramowitz and Stegun 9.8.1 and 9.8.2. Both are worked out and one
+       is picked; above 3.75 it's x + .5*log(poly^2/x) */
+    for(i=0; i<n; i++){
+        float x = scale*mag[i];
+        float ts = x*(1/3.75f);
+        ts *= ts;
+        float ps = 1.0f + ts*(3.5156229f + ts*(3.0899424f + ts*(1.2067492f
+                    + ts*(0.2659732f + ts*(0.0360768f + ts*0.0045813f)))));
+        int big = x >= 3.75f;
+        float xl = big ? x : 3.75f;
+        float tl = 3.75f/xl;
+        float pl = 0.39894228f + tl*(0.01328592f + tl*(0.00225319f
+                    + tl*(-0.00157565f + tl*(0.00916281f + tl*(-0.02057706f
+                    + tl*(0.02635537f + tl*(-0.01647633f + tl*0.00392377f)))))));
+        float pb = pl*pl/xl;
+        mu[i] = big ? pb : ps;
+        lin[i] = big ? x : 0.f;
+        half[i] = big ? .5f : 1.f;
+    }
+    for(i=0; i<n; i++)
+        mu[i] = lin[i] + half[i]*logf(mu[i]);
+
+    if(M==2){
+        for(i=0; i<nsym; i++)
+            rx_sd[i] = mu[i*2] - mu[i*2+1];
+    }else if(M==4){
+        /* Sum over the two symbols with each value of the bit, by log-add-exp */
+        for(i=0; i<nsym; i++){
+            const float * u = &mu[i*4];
+            rx_sd[(i*2)  ] = fmaxf(u[0],u[1]) - fmaxf(u[2],u[3])
+                           + log1pf(expf(-fabsf(u[0]-u[1]))) - log1pf(expf(-fabsf(u[2]-u[3])));
+            rx_sd[(i*2)+1] = fmaxf(u[0],u[2]) - fmaxf(u[1],u[3])
+                           + log1pf(expf(-fabsf(u[0]-u[2]))) - log1pf(expf(-fabsf(u[1]-u[3])));
+        }
+    }
+}
+
+/* Work out EbNodB from the sums of the chosen tones' magnitude and magnitude^2,
+   and write the scalar stats */
+static void fsk_update_ebno_stats(struct FSK *fsk, float f_est[], float rx_timing, float meanebno, float stdebno){
+    int nsym = fsk->Nsym;
+    int M = fsk->mode;
+    int i;
+    float fc_avg,fc_tx;
+    
+    #ifdef EST_EBNO
+    
+    /* Calculate mean for EbNodB estimation */
+    meanebno = meanebno/(float)nsym;
+    
+    /* Calculate the std. dev for EbNodB estimate */
+    stdebno = (stdebno/(float)nsym) - (meanebno*meanebno);
+    /* trap any negative numbers to avoid NANs flowing through */
+    if (stdebno > 0.0) {
+        stdebno = sqrt(stdebno);
+    } else {
+        stdebno = 0.0;
+    }
+        
+    fsk->EbNodB = -6+(20*log10f((1e-6+meanebno)/(1e-6+stdebno)));
+    #else
+    fsk->EbNodB = 1;
+    #endif
+    
+    /* Write some statistics to the stats struct */
+    if(fsk->stats_level >= FSK_STATS_SCALAR){
+        /* Save clock offset in ppm */
+        fsk->stats->clock_offset = fsk->ppm;
+        
+        /* Calculate and save SNR from EbNodB estimate */
+
+        fsk->stats->snr_est = .5*fsk->stats->snr_est + .5*fsk->EbNodB;//+ 10*log10f(((float)Rs)/((float)Rs*M));
+        
+        /* Save rx timing */
+        fsk->stats->rx_timing = (float)rx_timing;
+        
+        /* Estimate and save frequency offset */
+        fc_avg = (f_est[0]+f_est[1])/2;
+        fc_tx = (fsk->f1_tx+fsk->f1_tx+fsk->fs_tx)/2;
+        fsk->stats->foff = fc_tx-fc_avg;
+
+        fsk->stats->nr = 0;
+        fsk->stats->Nc = 0;
+
+        for(i=0; i<M; i++) {
+            fsk->stats->f_est[i] = f_est[i];
+        }
+    }
+}
+
+/* Where the eye traces start in the integrator outputs */
+static int fsk_eye_offset(struct FSK *fsk, int high_sample){
+    int P = fsk->P;
+    int neyeoffset;
+    
+    #ifdef I_DONT_UNDERSTAND
+    neyeoffset = high_sample+1+(P*28); /* WTF this line? Where does "28" come from ?                           */
+    #endif                             /* ifdef-ed out as I am afraid it will index out of memory as P changes */
+    neyeoffset = high_sample+1;
+    /* Early timing puts the ideal offset before the first integrator output;
+       start the traces two symbols on instead */
+    if(neyeoffset < 0)
+        neyeoffset += 2*P;
+    
+    assert(neyeoffset + fsk_eye_span(fsk) <= (fsk->Nsym+1)*P);
+    return neyeoffset;
+}
+
+/*---------------------------------------------------------------------------*\
+
+  Fixed point demod. Samples are Q15, downmixer phases are 32 bit
+  accumulators in 2^-32 turns looked up in a Q15 cos/sin table, and the
+  integrators are 32 bit running sums. Timing and tone decisions work on
+  64 bit magnitudes, with the timing angle found by CORDIC.
+
+\*---------------------------------------------------------------------------*/
+
+#define FSK_NCO_BITS 10
+#define FSK_NCO_LEN (1<<FSK_NCO_BITS)
+
+/* cos and sin in Q15 over one turn */
+static int16_t fsk_nco_table[FSK_NCO_LEN][2];
+static pthread_once_t fsk_nco_once = PTHREAD_ONCE_INIT;
+
+static void fsk_nco_init(void){
+    int i;
+    for(i=0; i<FSK_NCO_LEN; i++){
+        fsk_nco_table[i][0] = (int16_t)lrintf(32767*cosf(2*M_PI*i/FSK_NCO_LEN));
+        fsk_nco_table[i][1] = (int16_t)lrintf(32767*sinf(2*M_PI*i/FSK_NCO_LEN));
+    }
+}
+
+static inline const int16_t * fsk_nco(uint32_t phi){
+    return fsk_nco_table[phi >> (32-FSK_NCO_BITS)];
+}
+
+/* Convert turns to 2^-32 turns, wrapping */
+static uint32_t fsk_turns_q32(double turns){
+    return (uint32_t)(int64_t)llrint((turns - floor(turns))*4294967296.0);
+}
+
+/* atan(2^-k) in 2^-32 turns */
+static const uint32_t fsk_cordic_atan[] = {
+    0x20000000, 0x12e4051e, 0x09fb385b, 0x051111d4, 0x028b0d43, 0x0145d7e1, 0x00a2f61e,
+    0x00517c55, 0x0028be53, 0x00145f2f, 0x000a2f98, 0x000517cc, 0x00028be6, 0x000145f3,
+    0x0000a2fa, 0x0000517d, 0x000028be, 0x0000145f, 0x00000a30, 0x00000518
+};
+
+/* Angle of x+jy in 2^-32 turns, by CORDIC */
+static int32_t fsk_atan2_q32(int64_t y, int64_t x){
+    uint32_t a = 0;
+    int32_t xi,yi,xt;
+    size_t k;
+    
+    /* Scale down so the CORDIC gain of 1.65 can't overflow */
+    while(x >= (1LL<<29) || x <= -(1LL<<29) || y >= (1LL<<29) || y <= -(1LL<<29)){
+        x /= 2;
+        y /= 2;
+    }
+    xi = (int32_t)x;
+    yi = (int32_t)y;
+    
+    /* Turn half way round into the right half plane */
+    if(xi < 0){
+        xi = -xi;
+        yi = -yi;
+        a = 0x80000000u;
+    }
+    for(k=0; k<sizeof(fsk_cordic_atan)/sizeof(fsk_cordic_atan[0]); k++){
+        if(yi > 0){
+            xt = xi + (yi>>k);
+            yi = yi - (xi>>k);
+            a += fsk_cordic_atan[k];
+        }else{
+            xt = xi - (yi>>k);
+            yi = yi + (xi>>k);
+            a -= fsk_cordic_atan[k];
+        }
+        xi = xt;
+    }
+    return (int32_t)a;
+}
+
+static inline int16_t fsk_q15_sat(float x){
+    if(x >= 32767.f) return 32767;
+    if(x <= -32767.f) return -32767;
+    return (int16_t)(x < 0 ? x-.5f : x+.5f);
+}
+
+/* Downmix samples [from,to) of Q15 input against phase phi, stepping by dphi */
+static inline uint32_t fsk_downmix_q15(const int16_t samp[], int32_t dc[], int from, int to, uint32_t phi, uint32_t dphi){
+    int k;
+    for(k=from; k<to; k++){
+        const int16_t * nco = fsk_nco(phi);
+        int32_t sr = samp[2*k];
+        int32_t si = samp[2*k+1];
+        /* Multiply by the conjugate of the oscillator */
+        dc[2*k  ] = (sr*nco[0] + si*nco[1]) >> 15;
+        dc[2*k+1] = (si*nco[0] - sr*nco[1]) >> 15;
+        phi += dphi;
+    }
+    return phi;
+}
+
+/*
+ * Fixed point version of fsk2_demod's downmix and integrate. Fills f_int with
+ * (nsym+1)*P integrator outputs per tone, real and imag interleaved, and stashes
+ * the old samples
+ */
+static void fsk_demod_integrate_fixed(struct FSK *fsk, COMP fsk_in[], float f_est[], int32_t f_int[]){
+    int Ts = fsk->Ts;
+    int Fs = fsk->Fs;
+    int nin = fsk->nin;
+    int P = fsk->P;
+    int M = fsk->mode;
+    int nstash = fsk->nstash;
+    int nold = fsk->Nmem-nin;
+    int n_int = (fsk->Nsym+1)*P;
+    int step = Ts/P;
+    /* Samples used by the integrators; at most Nmem */
+    int n_dc = Ts-step+n_int*step;
+    float scale = fsk->fixed_scale;
+    int16_t* samp;      /* Q15 input, old samples then new */
+    int32_t* dc;        /* One tone's downmixed samples */
+    int i,j,k,m;
+    
+    #ifdef DEMOD_ALLOC_STACK
+    samp = (int16_t*) alloca(sizeof(int16_t)*2*n_dc);
+    dc = (int32_t*) alloca(sizeof(int32_t)*2*n_dc);
+    #else
+    samp = (int16_t*) malloc(sizeof(int16_t)*2*n_dc);
+    dc = (int32_t*) malloc(sizeof(int32_t)*2*n_dc);
+    #endif
+    
+    /* Convert once for all tones */
+    for(k=0; k<n_dc; k++){
+        COMP c = k<nold ? fsk->samp_old[nstash-nold+k] : fsk_in[k-nold];
+        samp[2*k  ] = fsk_q15_sat(c.real*scale);
+        samp[2*k+1] = fsk_q15_sat(c.imag*scale);
+    }
+    
+    for(m=0; m<M; m++){
+        uint32_t dphi_old = fsk_turns_q32(fsk->f_est[m]/(float)Fs);
+        uint32_t dphi_new = fsk_turns_q32(f_est[m]/(float)Fs);
+        /* Back the stored phase off to account for re-integraton of old samples */
+        uint32_t phi = fsk->phi_q[m] - (uint32_t)(nold-step)*dphi_old;
+        int32_t* f_int_m = &f_int[2*m*n_int];
+        int32_t acc_r = 0;
+        int32_t acc_i = 0;
+        int n_old = nold < n_dc ? nold : n_dc;
+        
+        /* Old samples with the old freq. estimate, then new with the new */
+        phi = fsk_downmix_q15(samp,dc,0,n_old,phi,dphi_old);
+        fsk->phi_q[m] = fsk_downmix_q15(samp,dc,n_old,n_dc,phi,dphi_new);
+        
+        /* Pre-fill the running sum */
+        for(k=0; k<Ts-step; k++){
+            acc_r += dc[2*k];
+            acc_i += dc[2*k+1];
+        }
+        
+        /* Integrate over Ts at offsets of Ts/P */
+        for(i=0; i<n_int; i++){
+            for(j=0; j<step; j++,k++){
+                acc_r += dc[2*k];
+                acc_i += dc[2*k+1];
+                if(k >= Ts){
+                    acc_r -= dc[2*(k-Ts)];
+                    acc_i -= dc[2*(k-Ts)+1];
+                }
+            }
+            f_int_m[2*i  ] = acc_r;
+            f_int_m[2*i+1] = acc_i;
+        }
+    }
+    
+    for(m=0; m<M; m++)
+        fsk->f_est[m] = f_est[m];
+    
+    /* Stash samples away in the old sample buffer for the next round of bit getting */
+    memcpy((void*)&(fsk->samp_old[0]),(void*)&(fsk_in[nin-nstash]),sizeof(COMP)*nstash);
+    
     #ifndef DEMOD_ALLOC_STACK
-    free(fftin);
-    free(fftout);
+    free(samp);
+    free(dc);
     #endif
 }
 
+/*
+ * Fixed point version of fsk2_demod's timing estimate and decisions, from the
+ * integrator outputs of fsk_demod_integrate_fixed
+ */
+static void fsk_demod_decide_fixed(struct FSK *fsk, uint8_t rx_bits[], float rx_sd[], float f_est[], int32_t f_int[]){
+    int Ts = fsk->Ts;
+    int P = fsk->P;
+    int M = fsk->mode;
+    int nsym = fsk->Nsym;
+    int n_int = (nsym+1)*P;
+    int i,k,m;
+    int shift,lshift;
+    int64_t line[P];        /* abs^2 summed by position in the symbol */
+    int64_t lmax;
+    int64_t t_r,t_i;
+    int32_t norm_q;
+    int64_t rx_q;
+    int low_sample,high_sample;
+    int32_t fract;
+    int64_t tmax[M];
+    float norm_rx_timing,rx_timing;
+    float inv_scale = 1/fsk->fixed_scale;
+    float meanebno = 0,stdebno = 0;
+    float sig_pwr = 0,noise_pwr = 0;   /* Chosen and other tones, for LLRs */
+    float tone_mag[rx_sd != NULL ? nsym*M : 1];
+    
+    /* Fine Timing Estimation */
+    /* The integrators grow by up to log2(Ts) bits; drop that before squaring */
+    for(shift=0; (1<<shift)<Ts; shift++);
+    
+    for(k=0; k<P; k++)
+        line[k] = 0;
+    for(i=0,k=0; i<n_int; i++){
+        int64_t ft1 = 0;
+        for(m=0; m<M; m++){
+            int32_t r = f_int[2*(m*n_int+i)  ] >> shift;
+            int32_t q = f_int[2*(m*n_int+i)+1] >> shift;
+            ft1 += (int64_t)r*r + (int64_t)q*q;
+        }
+        line[k] += ft1;
+        if(++k == P) k = 0;
+    }
+    
+    /* The magic line has period P, so only P oscillator products are needed.
+       Keep the sums well inside 64 bits first */
+    lmax = 0;
+    for(k=0; k<P; k++)
+        if(line[k] > lmax) lmax = line[k];
+    for(lshift=0; (lmax>>lshift) >= (1LL<<36); lshift++);
+    t_r = 0;
+    t_i = 0;
+    for(k=0; k<P; k++){
+        const int16_t * osc = fsk_nco((uint32_t)(((uint64_t)k<<32)/P));
+        t_r += (line[k]>>lshift)*osc[0];
+        t_i += (line[k]>>lshift)*osc[1];
+    }
+    
+    /* Get the magic angle */
+    norm_q = fsk_atan2_q32(t_i,t_r);
+    norm_rx_timing = (float)norm_q*(1.0f/4294967296.0f);
+    rx_timing = norm_rx_timing*(float)P;
+    
+    fsk_update_timing(fsk,norm_rx_timing);
+    
+    /* Re-sample the integrators with linear interpolation, fract in Q16 */
+    rx_q = (int64_t)norm_q*P;
+    low_sample = (int)(rx_q>>32);
+    fract = (int32_t)((rx_q>>16) & 0xffff);
+    high_sample = low_sample + ((rx_q & 0xffffffff) != 0);
+    
+    for(i=0; i<nsym; i++){
+        int st = (i+1)*P;
+        int sym = 0;
+        for(m=0; m<M; m++){
+            const int32_t * lo = &f_int[2*(m*n_int+st+low_sample)];
+            const int32_t * hi = &f_int[2*(m*n_int+st+high_sample)];
+            int64_t tr = ((int64_t)lo[0]*(65536-fract) + (int64_t)hi[0]*fract) >> 16;
+            int64_t ti = ((int64_t)lo[1]*(65536-fract) + (int64_t)hi[1]*fract) >> 16;
+            tmax[m] = tr*tr + ti*ti;
+            if(tmax[m] > tmax[sym])
+                sym = m;
+        }
+        
+        if(rx_bits != NULL){
+            if(M==2){
+                rx_bits[i] = sym==1;
+            }else if(M==4){
+                rx_bits[(i*2)+1] = (sym&0x1);
+                rx_bits[(i*2)  ] = (sym&0x2)>>1;
+            }
+        }
+        
+        /* Soft decisions and EbNo are per symbol, so back in float */
+        if(rx_sd != NULL){
+            for(m=0; m<M; m++){
+                float pwr = (float)tmax[m]*inv_scale*inv_scale;
+                if(m != sym) noise_pwr += pwr;
+                else sig_pwr += pwr;
+                tone_mag[i*M+m] = sqrtf(pwr);
+            }
+        }
+        #ifdef EST_EBNO
+        float max = (float)tmax[sym]*inv_scale*inv_scale;
+        stdebno += max;
+        meanebno += sqrtf(max);
+        #endif
+    }
+    
+    if(rx_sd != NULL)
+        fsk_sd_to_llr(fsk,rx_sd,tone_mag,sig_pwr,noise_pwr);
+    fsk_update_ebno_stats(fsk,f_est,rx_timing,meanebno,stdebno);
+    
+    if(fsk->stats_level == FSK_STATS_FULL){
+        int eye_span = fsk_eye_span(fsk);
+        int neyeoffset = fsk_eye_offset(fsk,high_sample);
+        for(m=0; m<M; m++){
+            const int32_t * src = &f_int[2*(m*n_int+neyeoffset)];
+            for(k=0; k<eye_span; k++){
+                fsk->eye_int[m*eye_span+k].real = src[2*k  ]*inv_scale;
+                fsk->eye_int[m*eye_span+k].imag = src[2*k+1]*inv_scale;
+            }
+        }
+        fsk->eye_pending = 1;
+    }
+    
+    /* Dump some internal samples */
+    modem_probe_samp_f("t_EbNodB",&(fsk->EbNodB),1);
+    modem_probe_samp_f("t_ppm",&(fsk->ppm),1);
+    modem_probe_samp_f("t_rx_timing",&(rx_timing),1);
+    
+    #ifdef MODEMPROBE_ENABLE
+    COMP f_int_c[n_int];
+    for( m=0; m<M; m++){
+        for(i=0; i<n_int; i++){
+            f_int_c[i].real = f_int[2*(m*n_int+i)  ]*inv_scale;
+            f_int_c[i].imag = f_int[2*(m*n_int+i)+1]*inv_scale;
+        }
+        modem_probe_samp_c(fsk_probe_int_names[m],f_int_c,n_int);
+        modem_probe_samp_f(fsk_probe_f_names[m],&f_est[m],1);
+    }
+    #endif
+}
+
+void fsk_set_fixed_point(struct FSK *fsk, int enable, float in_scale){
+    int m;
+    
+    pthread_once(&fsk_nco_once,fsk_nco_init);
+    enable = enable != 0;
+    
+    /* Carry the downmixer phases across */
+    for(m=0; m<fsk->mode; m++){
+        if(enable && !fsk->fixed_point)
+            fsk->phi_q[m] = fsk_turns_q32(atan2f(fsk->phi_c[m].imag,fsk->phi_c[m].real)/(2*M_PI));
+        else if(!enable && fsk->fixed_point)
+            fsk->phi_c[m] = comp_exp_j(2*M_PI*(fsk->phi_q[m]/4294967296.0));
+    }
+    fsk->fixed_point = enable;
+    fsk->fixed_scale = in_scale > 0 ? in_scale : FSK_SCALE;
+}
+
 void fsk2_demod(struct FSK *fsk, uint8_t rx_bits[], float rx_sd[], COMP fsk_in[]){
-    int N = fsk->N;
     int Ts = fsk->Ts;
     int Rs = fsk->Rs;
     int Fs = fsk->Fs;
@@ -751,19 +1385,19 @@ void fsk2_demod(struct FSK *fsk, uint8_t rx_bits[], float rx_sd[], COMP fsk_in[]
     
     COMP dphi[M];
     COMP dphift;
-    float rx_timing,norm_rx_timing,old_norm_rx_timing,d_norm_rx_timing,appm;
+    float rx_timing,norm_rx_timing;
     int using_old_samps;
 
     COMP* sample_src;
     COMP* f_intbuf_m;
     
-    float f_est[M],fc_avg,fc_tx;
-    float meanebno,stdebno,eye_max;
-    int neyesamp,neyeoffset;
+    float f_est[M];
+    float meanebno = 0,stdebno = 0;
+    float sig_pwr = 0,noise_pwr = 0;   /* Chosen and other tones, for LLRs */
+    float tone_mag[rx_sd != NULL ? nsym*M : 1];
+    int neyeoffset;
     
-    #ifdef MODEMPROBE_ENABLE
-    char mp_name_tmp[20]; /* Temporary string for modem probe trace names */
-    #endif
+    TDMA_PERF_START(perf_t);
 
     //for(size_t jj = 0; jj<nin; jj++){
     //    fprintf(stderr,"%f,j%f,",fsk_in[jj].real,fsk_in[jj].imag);
@@ -776,8 +1410,33 @@ void fsk2_demod(struct FSK *fsk, uint8_t rx_bits[], float rx_sd[], COMP fsk_in[]
     /* Estimate tone frequencies */
     fsk_demod_freq_est(fsk,fsk_in,f_est,M);
     modem_probe_samp_f("t_f_est",f_est,M);
+    FSK_PERF_MARK(fsk,0,perf_t);
     
     
+    /* If this is the first run, we won't have any valid f_est */
+    /* TODO: add first_run flag to FSK to make negative freqs possible */
+    if(fsk->f_est[0]<1){
+        for( m=0; m<M; m++)
+            fsk->f_est[m] = f_est[m];
+    }
+    
+    if(fsk->fixed_point){
+        int32_t* f_intq;
+        #ifdef DEMOD_ALLOC_STACK
+        f_intq = (int32_t*) alloca(sizeof(int32_t)*2*M*(nsym+1)*P);
+        #else
+        f_intq = (int32_t*) malloc(sizeof(int32_t)*2*M*(nsym+1)*P);
+        #endif
+        fsk_demod_integrate_fixed(fsk,fsk_in,f_est,f_intq);
+        FSK_PERF_MARK(fsk,1,perf_t);
+        fsk_demod_decide_fixed(fsk,rx_bits,rx_sd,f_est,f_intq);
+        #ifndef DEMOD_ALLOC_STACK
+        free(f_intq);
+        #endif
+        FSK_PERF_MARK(fsk,2,perf_t);
+        return;
+    }
+    
     /* Allocate circular buffer for integration */
     #ifdef DEMOD_ALLOC_STACK
     f_intbuf_m = (COMP*) alloca(sizeof(COMP)*Ts);
@@ -797,13 +1456,6 @@ void fsk2_demod(struct FSK *fsk, uint8_t rx_bits[], float rx_sd[], COMP fsk_in[]
         #endif
     }
     
-    /* If this is the first run, we won't have any valid f_est */
-    /* TODO: add first_run flag to FSK to make negative freqs possible */
-    if(fsk->f_est[0]<1){
-        for( m=0; m<M; m++)
-            fsk->f_est[m] = f_est[m];
-    }
-    
     /* Initalize downmixers for each symbol tone */
     for( m=0; m<M; m++){
         /* Back the stored phase off to account for re-integraton of old samples */
@@ -843,8 +1495,7 @@ void fsk2_demod(struct FSK *fsk, uint8_t rx_bits[], float rx_sd[], COMP fsk_in[]
             f_intbuf_m[dc_i]=cmult(sample_src[dc_i],cconj(phi_c[m]));
             
             #ifdef MODEMPROBE_ENABLE
-            snprintf(mp_name_tmp,19,"t_f%zd_dc",m+1);
-            modem_probe_samp_c(mp_name_tmp,&f_intbuf_m[dc_i],1);
+            modem_probe_samp_c(fsk_probe_dc_names[m],&f_intbuf_m[dc_i],1);
             #endif
             /* Spin downconversion phases */
             phi_c[m] = cmult(phi_c[m],dphi_m);
@@ -869,8 +1520,7 @@ void fsk2_demod(struct FSK *fsk, uint8_t rx_bits[], float rx_sd[], COMP fsk_in[]
                 f_intbuf_m[cbuf_i+j]=cmult(sample_src[dc_i],cconj(phi_c[m]));
         
                 #ifdef MODEMPROBE_ENABLE
-                snprintf(mp_name_tmp,19,"t_f%zd_dc",m+1);
-                modem_probe_samp_c(mp_name_tmp,&f_intbuf_m[cbuf_i+j],1);
+                modem_probe_samp_c(fsk_probe_dc_names[m],&f_intbuf_m[cbuf_i+j],1);
                 #endif
                 /* Spin downconversion phases */
                 phi_c[m] = cmult(phi_c[m],dphi_m);
@@ -901,6 +1551,7 @@ void fsk2_demod(struct FSK *fsk, uint8_t rx_bits[], float rx_sd[], COMP fsk_in[]
 
     /* Stash samples away in the old sample buffer for the next round of bit getting */
     memcpy((void*)&(fsk->samp_old[0]),(void*)&(fsk_in[nin-nstash]),sizeof(COMP)*nstash);
+    FSK_PERF_MARK(fsk,1,perf_t);
     
     /* Fine Timing Estimation */
     /* Apply magic nonlinearity to f1_int and f2_int, shift down to 0, 
@@ -928,6 +1579,7 @@ void fsk2_demod(struct FSK *fsk, uint8_t rx_bits[], float rx_sd[], COMP fsk_in[]
     /* Check for NaNs in the fine timing estimate, return if found */
     /* otherwise segfaults happen */
     if( isnan(t_c.real) || isnan(t_c.imag)){
+        FSK_PERF_MARK(fsk,2,perf_t);
         return;
     } 
 
@@ -935,31 +1587,7 @@ void fsk2_demod(struct FSK *fsk, uint8_t rx_bits[], float rx_sd[], COMP fsk_in[]
     norm_rx_timing =  atan2f(t_c.imag,t_c.real)/(2*M_PI);
     rx_timing = norm_rx_timing*(float)P;
     
-    old_norm_rx_timing = fsk->norm_rx_timing;
-    fsk->norm_rx_timing = norm_rx_timing;
-    
-    /* Estimate sample clock offset */
-    d_norm_rx_timing = norm_rx_timing - old_norm_rx_timing;
-    
-    /* Filter out big jumps in due to nin change */
-    if(fabsf(d_norm_rx_timing) < .2){
-        appm = 1e6*d_norm_rx_timing/(float)nsym;
-        fsk->ppm = .9*fsk->ppm + .1*appm;
-    }
-    
-    /* Figure out how many samples are needed the next modem cycle */
-    /* Unless we're in burst mode */
-    if(!fsk->burst_mode){
-        if(norm_rx_timing > 0.25)
-            fsk->nin = N+Ts/2;
-        else if(norm_rx_timing < -0.25)
-            fsk->nin = N-Ts/2;
-        else
-            fsk->nin = N;
-    }
-    
-    modem_probe_samp_f("t_norm_rx_timing",&(norm_rx_timing),1);
-    modem_probe_samp_i("t_nin",&(fsk->nin),1);
+    fsk_update_timing(fsk,norm_rx_timing);
     
     /* Re-sample the integrators with linear interpolation magic */
     int low_sample = (int)floorf(rx_timing);
@@ -986,16 +1614,12 @@ void fsk2_demod(struct FSK *fsk, uint8_t rx_bits[], float rx_sd[], COMP fsk_in[]
         }
         
         float max = tmax[0]; /* Maximum for figuring correct symbol */
-        float min = tmax[0];
         int sym = 0; /* Index of maximum */
         for( m=0; m<M; m++){
             if(tmax[m]>max){
                 max = tmax[m];
                 sym = m;
             }
-            if(tmax[m]<min){
-                min = tmax[m];
-            }
         }
         
         /* Get the actual bit */
@@ -1012,24 +1636,12 @@ void fsk2_demod(struct FSK *fsk, uint8_t rx_bits[], float rx_sd[], COMP fsk_in[]
         
         /* Produce soft decision symbols */
         if(rx_sd != NULL){
-            /* Convert symbols from max^2 into max */
-            for( m=0; m<M; m++)
-                tmax[m] = sqrtf(tmax[m]);
-            
-            if(M==2){
-                rx_sd[i] = tmax[0] - tmax[1];
-            }else if(M==4){
-                /* TODO: Find a soft-decision mode that works for 4FSK */
-                min = sqrtf(min);
-                rx_sd[(i*2)+1] = - tmax[0] ;  /* Bits=00 */
-                rx_sd[(i*2)  ] = - tmax[0] ;
-                rx_sd[(i*2)+1]+=   tmax[1] ;  /* Bits=01 */
-                rx_sd[(i*2)  ]+= - tmax[1] ;
-                rx_sd[(i*2)+1]+= - tmax[2] ;  /* Bits=10 */
-                rx_sd[(i*2)  ]+=   tmax[2] ;
-                rx_sd[(i*2)+1]+=   tmax[3] ;  /* Bits=11 */
-                rx_sd[(i*2)  ]+=   tmax[3] ;
+            /* Keep the tones' magnitudes, and their powers for the noise estimate */
+            for( m=0; m<M; m++){
+                if(m != sym) noise_pwr += tmax[m];
+                tone_mag[i*M+m] = sqrtf(tmax[m]);
             }
+            sig_pwr += max;
         }
         /* Accumulate resampled int magnitude for EbNodB estimation */
         /* Standard deviation is calculated by algorithm devised by crafty soviets */
@@ -1044,97 +1656,18 @@ void fsk2_demod(struct FSK *fsk, uint8_t rx_bits[], float rx_sd[], COMP fsk_in[]
         /* Soft output goes here */
     }
     
-    #ifdef EST_EBNO
-    
-    /* Calculate mean for EbNodB estimation */
-    meanebno = meanebno/(float)nsym;
-    
-    /* Calculate the std. dev for EbNodB estimate */
-    stdebno = (stdebno/(float)nsym) - (meanebno*meanebno);
-    /* trap any negative numbers to avoid NANs flowing through */
-    if (stdebno > 0.0) {
-        stdebno = sqrt(stdebno);
-    } else {
-        stdebno = 0.0;
-    }
-        
-    fsk->EbNodB = -6+(20*log10f((1e-6+meanebno)/(1e-6+stdebno)));
-    #else
-    fsk->EbNodB = 1;
-    #endif
-    
-    /* Write some statistics to the stats struct */
-
-    /* Save clock offset in ppm */
-    fsk->stats->clock_offset = fsk->ppm;
-        
-    /* Calculate and save SNR from EbNodB estimate */
-
-    fsk->stats->snr_est = .5*fsk->stats->snr_est + .5*fsk->EbNodB;//+ 10*log10f(((float)Rs)/((float)Rs*M));
-        
-    /* Save rx timing */
-    fsk->stats->rx_timing = (float)rx_timing;
-        
-    /* Estimate and save frequency offset */
-    fc_avg = (f_est[0]+f_est[1])/2;
-    fc_tx = (fsk->f1_tx+fsk->f1_tx+fsk->fs_tx)/2;
-    fsk->stats->foff = fc_tx-fc_avg;
-    
-    /* Take a sample for the eye diagrams ---------------------------------- */
-
-    /* due to oversample rate P, we have too many samples for eye
-       trace.  So lets output a decimated version.  We use 2P
-       as we want two symbols worth of samples in trace  */
-
-    int neyesamp_dec = ceil(((float)P*2)/MODEM_STATS_EYE_IND_MAX);
-    neyesamp = (P*2)/neyesamp_dec;
-    assert(neyesamp <= MODEM_STATS_EYE_IND_MAX);
-    fsk->stats->neyesamp = neyesamp;
-
-    #ifdef I_DONT_UNDERSTAND
-    neyeoffset = high_sample+1+(P*28); /* WTF this line? Where does "28" come from ?                           */
-    #endif                             /* ifdef-ed out as I am afraid it will index out of memory as P changes */
-    neyeoffset = high_sample+1;
-    
-    int eye_traces = MODEM_STATS_ET_MAX/M;
-    int ind;
-    
-    fsk->stats->neyetr = fsk->mode*eye_traces;
-    for( i=0; i<eye_traces; i++){
-        for ( m=0; m<M; m++){
-            for(j=0; j<neyesamp; j++) {
-               /*
-                  2*P*i...........: advance two symbols for next trace
-                  neyeoffset......: centre trace on ideal timing offset, peak eye opening
-                  j*neweyesamp_dec: For 2*P>MODEM_STATS_EYE_IND_MAX advance through integrated 
-                                    samples newamp_dec at a time so we dont overflow rx_eye[][]
-               */
-               ind = 2*P*i + neyeoffset + j*neyesamp_dec;
-               assert((i*M+m) < MODEM_STATS_ET_MAX);
-               assert(ind < (nsym+1)*P);
-               fsk->stats->rx_eye[i*M+m][j] = cabsolute(f_int[m][ind]);
-            }
-        }
-    }
-        
-    if (fsk->normalise_eye) {
-        eye_max = 0;
-        /* Normalize eye to +/- 1 */
-        for(i=0; i<M*eye_traces; i++)
-            for(j=0; j<neyesamp; j++)
-                if(fabsf(fsk->stats->rx_eye[i][j])>eye_max)
-                    eye_max = fabsf(fsk->stats->rx_eye[i][j]);
-        
-        for(i=0; i<M*eye_traces; i++)
-            for(j=0; j<neyesamp; j++)
-                fsk->stats->rx_eye[i][j] = fsk->stats->rx_eye[i][j]/eye_max;
-    }
-
-    fsk->stats->nr = 0;
-    fsk->stats->Nc = 0;
+    if(rx_sd != NULL)
+        fsk_sd_to_llr(fsk,rx_sd,tone_mag,sig_pwr,noise_pwr);
+    fsk_update_ebno_stats(fsk,f_est,rx_timing,meanebno,stdebno);
 
-    for(i=0; i<M; i++) {
-        fsk->stats->f_est[i] = f_est[i];
+    /* Keep the integrator outputs the eye diagram is taken from. It's only
+       worked out if someone asks for it in fsk_get_demod_stats */
+    if(fsk->stats_level == FSK_STATS_FULL){
+        int eye_span = fsk_eye_span(fsk);
+        neyeoffset = fsk_eye_offset(fsk,high_sample);
+        for( m=0; m<M; m++)
+            memcpy(&fsk->eye_int[m*eye_span],&f_int[m][neyeoffset],sizeof(COMP)*eye_span);
+        fsk->eye_pending = 1;
     }
     
     /* Dump some internal samples */
@@ -1144,10 +1677,8 @@ void fsk2_demod(struct FSK *fsk, uint8_t rx_bits[], float rx_sd[], COMP fsk_in[]
     
     #ifdef MODEMPROBE_ENABLE
     for( m=0; m<M; m++){
-        snprintf(mp_name_tmp,19,"t_f%zd_int",m+1);
-        modem_probe_samp_c(mp_name_tmp,f_int[m],(nsym+1)*P);
-        snprintf(mp_name_tmp,19,"t_f%zd",m+1);
-        modem_probe_samp_f(mp_name_tmp,&f_est[m],1);
+        modem_probe_samp_c(fsk_probe_int_names[m],f_int[m],(nsym+1)*P);
+        modem_probe_samp_f(fsk_probe_f_names[m],&f_est[m],1);
     }
     #endif
     
@@ -1157,6 +1688,7 @@ void fsk2_demod(struct FSK *fsk, uint8_t rx_bits[], float rx_sd[], COMP fsk_in[]
     }
     free(f_intbuf_m);
     #endif
+    FSK_PERF_MARK(fsk,2,perf_t);
 }
 
 void fsk_demod(struct FSK *fsk, uint8_t rx_bits[], COMP fsk_in[]){
@@ -29,6 +29,7 @@
 #ifndef __C2FSK_H
 #define __C2FSK_H
 #include <stdint.h>
+#include <stddef.h>
 #include "comp.h"
 #include "modem_stats.h"
 
@@ -39,14 +40,14 @@
 
 #define FSK_SCALE 16383
 
-#define USE_FFTW
+#define FSK_PERF_STAGES 3
 
-#ifndef USE_FFTW
-#include "kiss_fftr.h"
-#include "kiss_fft.h"
-#else
-#include <fftw3.h>
-#endif
+/* Stats levels, see fsk_set_stats_level */
+#define FSK_STATS_NONE   0
+#define FSK_STATS_SCALAR 1
+#define FSK_STATS_FULL   2
+
+#include "modem_fft.h"
 
 struct FSK {
     /*  Static parameters set up by fsk_init */
@@ -70,13 +71,9 @@ struct FSK {
     /*  Parameters used by demod */
     COMP phi_c[MODE_M_MAX];
     
-    #ifndef USE_FFTW
-    kiss_fft_cfg fft_cfg;   /* Config for KISS FFT, used in freq est */
-    #else
-    fftwf_plan fftw_cfg;
-    fftwf_complex* fft_in;
-    fftwf_complex* fft_out;
-    #endif
+    modem_fft_t * fft;      /* Shared FFT plan, used in freq est */
+    COMP* fft_in;           /* Its buffers, Ndft each */
+    COMP* fft_out;
     
     float norm_rx_timing;   /* Normalized RX timing */
     
@@ -101,7 +98,20 @@ struct FSK {
     
     /*  modem statistic struct */
     struct MODEM_STATS *stats;
+    int stats_owned;        /* stats was allocated here rather than handed in */
     int normalise_eye;      /* enables/disables normalisation of eye diagram */
+    int stats_level;        /* FSK_STATS_NONE, FSK_STATS_SCALAR or FSK_STATS_FULL */
+    COMP* eye_int;          /* Integrator outputs kept from the last demod for the eye diagram */
+    int eye_pending;        /* eye_int is newer than stats->rx_eye */
+
+    /*  Fixed point demod, see fsk_set_fixed_point */
+    int fixed_point;        /* Downmix, integrate and decide in integer arithmetic */
+    float fixed_scale;      /* Q15 counts per unit of input amplitude */
+    uint32_t phi_q[MODE_M_MAX]; /* Downmixer phases in 2^-32 turns, used instead of phi_c */
+
+    /*  Time spent in freq est, downmix/integrate and timing est/decisions by the
+        last demod, in ns. Only filled in when built with TDMA_PERF_ENABLE */
+    uint32_t perf_ns[FSK_PERF_STAGES];
 };
 
 /*
@@ -125,9 +135,11 @@ struct FSK * fsk_create(int Fs, int Rs, int M, int tx_f1, int tx_fs);
 struct FSK * fsk_create_hbr(int Fs, int Rs, int P, int M, int tx_f1, int tx_fs);
 
 /* 
- * Set a new number of symbols per processing frame
+ * Set a new number of symbols per processing frame. Returns -1 if the
+ * buffers for the new size couldn't be allocated; the modem can then
+ * only be destroyed
  */
-void fsk_set_nsym(struct FSK *fsk,int nsym);
+int fsk_set_nsym(struct FSK *fsk,int nsym);
 
 /*
  * Set the minimum and maximum frequencies at which the freq. estimator can find tones
@@ -140,10 +152,42 @@ void fsk_set_est_limits(struct FSK *fsk,int fmin, int fmax);
 void fsk_clear_estimators(struct FSK *fsk);
 
 /*
- * Fills MODEM_STATS struct with demod statistics
+ * Fills MODEM_STATS struct with demod statistics. With FSK_STATS_FULL the eye
+ * diagram is worked out here from the last demod's integrator outputs.
  */
 void fsk_get_demod_stats(struct FSK *fsk, struct MODEM_STATS *stats);
 
+/*
+ * Set how much of MODEM_STATS the demod keeps up to date:
+ * FSK_STATS_NONE   - nothing; EbNodB, ppm and f_est in struct FSK are still set
+ * FSK_STATS_SCALAR - SNR, timing, clock and freq. offsets
+ * FSK_STATS_FULL   - scalars plus the eye diagram (the default)
+ * Returns 0, or -1 if the eye buffer couldn't be allocated
+ */
+int fsk_set_stats_level(struct FSK *fsk, int level);
+
+/*
+ * Keep stats in a caller owned struct, which may be shared by several modems;
+ * the last one to demod wins. NULL goes back to the modem's own storage.
+ * Returns 0, or -1 if own storage couldn't be allocated
+ */
+int fsk_set_stats_buffer(struct FSK *fsk, struct MODEM_STATS *stats);
+
+/*
+ * Run the demod's downmixers, integrators, timing estimate and tone decisions
+ * in fixed point, for targets with no or a slow FPU. Input is converted to Q15
+ * at in_scale counts per unit of amplitude, saturating; 0 picks FSK_SCALE, so
+ * the full range is +-2. The freq. estimator and stats stay in float. Switching
+ * keeps the downmixer phases, so it can be done between any two demods
+ */
+void fsk_set_fixed_point(struct FSK *fsk, int enable, float in_scale);
+
+/*
+ * Heap bytes held by the modem, including struct FSK. FFT plans are
+ * opaque to us and are left out
+ */
+size_t fsk_get_footprint(struct FSK *fsk);
+
 /*
  * Destroy an FSK state struct and free it's memory
  * 
@@ -203,17 +247,29 @@ void fsk_demod(struct FSK *fsk, uint8_t rx_bits[],COMP fsk_in[]);
  *  demodulated can be found by calling fsk_nin().
  * 
  * struct FSK *fsk - FSK config/state struct, set up by fsk_create
- * float rx_bits[] - Buffer for Nbits soft decision bits to be written
+ * float rx_bits[] - Buffer for Nbits soft decision bits to be written, as LLRs
+ *  log(P(0)/P(1)) worked out from the demod's own signal and noise estimates
  * float fsk_in[] - nin samples of modualted FSK
  */
 void fsk_demod_sd(struct FSK *fsk, float rx_bits[],COMP fsk_in[]);
 
+/*
+ * Demodulate nin samples of 2FSK or 4FSK into hard and/or soft bits. Either
+ *  output may be NULL. This is what fsk_demod and fsk_demod_sd call.
+ */
+void fsk2_demod(struct FSK *fsk, uint8_t rx_bits[], float rx_sd[], COMP fsk_in[]);
+
+/*
+ * Estimate the M tone frequencies in nin samples of FSK. Called by fsk2_demod.
+ */
+void fsk_demod_freq_est(struct FSK *fsk, COMP fsk_in[],float *freqs,int M);
+
 /* enables/disables normalisation of eye diagram samples */
   
 void fsk_stats_normalise_eye(struct FSK *fsk, int normalise_enable);
 
-/* Set the FSK modem into burst demod mode */
+/* Set the FSK modem into burst demod mode. Returns -1 on failure, as fsk_set_nsym */
 
-void fsk_enable_burst_mode(struct FSK *fsk,int nsyms);
+int fsk_enable_burst_mode(struct FSK *fsk,int nsyms);
 
 #endif
@@ -33,19 +33,31 @@
 */
 
 #include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
 
 #ifdef GOLAY23_MAKETABLES
 #define RUN_TIME_TABLES
 #endif
 
+/*
+ * The syndrome is linear, so it's the XOR of the syndromes of each byte of
+ * the codeword, looked up in syndrome_table[byte][value]. Encoding is the
+ * syndrome of the shifted data word, so needs no table of its own.
+ * decoding_table holds each correctable error pattern as up to three bit
+ * positions plus one, 5 bits each. 5.5 KB in all, where int tables of
+ * codewords and error patterns took 24 KB
+ */
 #ifndef NO_TABLES
 #ifdef RUN_TIME_TABLES
-int static encoding_table[4096];
-int static decoding_table[2048];
-static int inited = 0;
+#include <pthread.h>
+static uint16_t syndrome_table[3][256];
+static uint16_t decoding_table[2048];
+static pthread_once_t tables_once = PTHREAD_ONCE_INIT;
+static void golay23_make_tables(void);
 #else
 //default is to use precomputed tables
-#include "golayenctable.h"
+#include "golaysyntable.h"
 #include "golaydectable.h"
 #endif
 #endif
@@ -53,7 +65,8 @@ static int inited = 0;
 //since we want to avoid bit-reversing inside syndrome() we bit-reverse the polynomial instead
 #define GOLAY_POLYNOMIAL    0xC75   //AE3 reversed
 
-int golay23_syndrome(int c) {
+#if defined(NO_TABLES) || defined(RUN_TIME_TABLES)
+static int golay23_syndrome_loop(int c) {
     //could probably be done slightly smarter, but works
     int x;
     for (x = 11; x >= 0; x--) {
@@ -63,6 +76,18 @@ int golay23_syndrome(int c) {
     }
     return c;
 }
+#endif
+
+int golay23_syndrome(int c) {
+#ifdef NO_TABLES
+    return golay23_syndrome_loop(c);
+#else
+#ifdef RUN_TIME_TABLES
+    pthread_once(&tables_once, golay23_make_tables);
+#endif
+    return syndrome_table[0][c & 0xFF] ^ syndrome_table[1][(c >> 8) & 0xFF] ^ syndrome_table[2][(c >> 16) & 0x7F];
+#endif
+}
 
 #ifdef __GNUC__
 #define popcount __builtin_popcount
@@ -82,13 +107,6 @@ static int popcount(unsigned int c) {
 }
 #endif
 
-#if defined(NO_TABLES) || defined(RUN_TIME_TABLES)
-static int golay23_encode_no_tables(int c) {
-    c <<= 11;
-    return golay23_syndrome(c) | c;
-}
-#endif
-
 #ifdef NO_TABLES
 static int unrotate(unsigned int c, int x) {
     return ((c << x) & 0x7FFFFF) | (c >> (23 - x));
@@ -124,27 +142,33 @@ static int golay23_decode_no_tables(int c) {
     assert("Something is wrong with golay23_decode_no_tables()..");
     return c & 0xFFF;
 }
+#else
+//expand a decoding_table entry into its error pattern
+static inline int golay23_error_pattern(unsigned int e) {
+    return ((1 << (e & 0x1F)) >> 1) | ((1 << ((e >> 5) & 0x1F)) >> 1) | ((1 << (e >> 10)) >> 1);
+}
 #endif
 
-void golay23_init(void) {
 #ifdef RUN_TIME_TABLES
+static void golay23_make_tables(void) {
     int x, y, z;
-    inited = 1;
-    for (x = 0; x < 4096; x++) {
-        encoding_table[x] = golay23_encode_no_tables(x);
+    for (x = 0; x < 256; x++) {
+        syndrome_table[0][x] = golay23_syndrome_loop(x);
+        syndrome_table[1][x] = golay23_syndrome_loop(x << 8);
+        syndrome_table[2][x] = golay23_syndrome_loop((x << 16) & 0x7FFFFF);
     }
 
     decoding_table[0] = 0;
     //1-bit errors
     for (x = 0; x < 23; x++) {
         int d = 1<<x;
-        decoding_table[golay23_syndrome(d)] = d;
+        decoding_table[golay23_syndrome_loop(d)] = x+1;
     }
     //2-bit errors
     for (x = 0; x < 22; x++) {
         for (y = x+1; y < 23; y++) {
             int d = (1<<x) | (1<<y);
-            decoding_table[golay23_syndrome(d)] = d;
+            decoding_table[golay23_syndrome_loop(d)] = (x+1) | ((y+1) << 5);
         }
     }
     //3-bit errors
@@ -152,38 +176,35 @@ void golay23_init(void) {
         for (y = x+1; y < 22; y++) {
             for (z = y+1; z < 23; z++) {
                 int d = (1<<x) | (1<<y) | (1<<z);
-                decoding_table[golay23_syndrome(d)] = d;
+                decoding_table[golay23_syndrome_loop(d)] = (x+1) | ((y+1) << 5) | ((z+1) << 10);
             }
         }
     }
-#endif
 }
+#endif
 
-int  golay23_encode(int c) {
-    assert(c >= 0 && c <= 0xFFF);
+void golay23_init(void) {
 #ifdef RUN_TIME_TABLES
-    assert(inited);
+    //safe to call from any number of threads; the first one makes the tables
+    pthread_once(&tables_once, golay23_make_tables);
 #endif
+}
 
-#ifdef NO_TABLES
-    return golay23_encode_no_tables(c);
-#else
-    return encoding_table[c];
-#endif
+int  golay23_encode(int c) {
+    assert(c >= 0 && c <= 0xFFF);
+    c <<= 11;
+    return golay23_syndrome(c) | c;
 }
 
 int  golay23_decode(int c) {
     assert(c >= 0 && c <= 0x7FFFFF);
-#ifdef RUN_TIME_TABLES
-    assert(inited);
-#endif
 
 #ifdef NO_TABLES
     //duplicate old golay23_decode()'s shift
     return unrotate(golay23_decode_no_tables(c), 11);
 #else
     //message is shifted 11 places left in the return value
-    return c ^ decoding_table[golay23_syndrome(c)];
+    return c ^ golay23_error_pattern(decoding_table[golay23_syndrome(c)]);
 #endif
 }
 
@@ -191,6 +212,211 @@ int  golay23_count_errors(int recd_codeword, int corrected_codeword) {
     return popcount(recd_codeword ^ corrected_codeword);
 }
 
+/**
+ * Chase-II soft decision decoding. Hard decoding the received word with each
+ * combination of its least reliable bits flipped gives a list of candidate
+ * codewords; the one whose differences from the received word are least
+ * reliable wins. A candidate differing in set D, with metric m, is the best
+ * possible if any other codeword, being at least 7 bits from it, must pick up
+ * at least m of reliability outside D. That ends most searches early
+ */
+
+//least reliable bits to flip; 2^GOLAY23_CHASE_BITS test patterns
+#define GOLAY23_CHASE_BITS 4
+
+//hard decode to a full codeword
+static int golay23_nearest(int c) {
+#ifdef NO_TABLES
+    return golay23_encode(golay23_decode(c) >> 11);
+#else
+    return golay23_decode(c);
+#endif
+}
+
+static float golay23_metric(int d, const float rel[]) {
+    float m = 0;
+    int x;
+    for (x = 0; d; x++, d >>= 1) {
+        if (d & 1) {
+            m += rel[x];
+        }
+    }
+    return m;
+}
+
+//can no codeword beat a candidate with differences d and metric m? order[] is bits by rising reliability
+static int golay23_is_best(int d, float m, const float rel[], const int order[]) {
+    int need = 7 - popcount(d);
+    float bound = 0;
+    int x;
+    for (x = 0; x < 23 && need > 0; x++) {
+        if (!(d & (1 << order[x]))) {
+            bound += rel[order[x]];
+            need--;
+        }
+    }
+    return bound >= m;
+}
+
+int  golay23_decode_soft(int received, const float rel[], int *errs) {
+    int order[23];
+    int x, y, t;
+    int best, best_d;
+    float best_m;
+
+    assert(received >= 0 && received <= 0x7FFFFF);
+
+    //order bits by reliability; insertion sort is fine for 23
+    for (x = 0; x < 23; x++) {
+        int o = x;
+        for (y = x; y > 0 && rel[order[y-1]] > rel[o]; y--) {
+            order[y] = order[y-1];
+        }
+        order[y] = o;
+    }
+
+    best = golay23_nearest(received);
+    best_d = best ^ received;
+    best_m = golay23_metric(best_d, rel);
+
+    for (t = 1; t < (1 << GOLAY23_CHASE_BITS); t++) {
+        int flip = 0, c, d;
+        float m;
+        if (golay23_is_best(best_d, best_m, rel, order)) {
+            break;
+        }
+        for (x = 0; x < GOLAY23_CHASE_BITS; x++) {
+            if (t & (1 << x)) {
+                flip |= 1 << order[x];
+            }
+        }
+        c = golay23_nearest(received ^ flip);
+        d = c ^ received;
+        if (d == best_d) {
+            continue;
+        }
+        m = golay23_metric(d, rel);
+        if (m < best_m) {
+            best = c;
+            best_d = d;
+            best_m = m;
+        }
+    }
+
+    if (errs != NULL) {
+        *errs = popcount(best_d);
+    }
+    return best;
+}
+
+/**
+ * Batch encode/decode. With tables, the byte-wise syndrome is a few table
+ * lookups and batches are a plain loop. Without, encoding bit-slices the
+ * syndrome: it's linear in the codeword bits, so with 64 words transposed
+ * into bit planes each syndrome bit is an XOR of whole planes, with no data
+ * dependent branches
+ */
+
+#ifdef NO_TABLES
+//below this many words a batch isn't worth transposing
+#define GOLAY23_SLICE_MIN 8
+
+//golay23_syndrome(1<<x) for each codeword bit x
+static const uint16_t bit_syndromes[23] = {
+    0x001, 0x002, 0x004, 0x008, 0x010, 0x020, 0x040, 0x080,
+    0x100, 0x200, 0x400, 0x475, 0x49f, 0x54b, 0x6e3, 0x1b3,
+    0x366, 0x6cc, 0x1ed, 0x3da, 0x7b4, 0x31d, 0x63a
+};
+
+//transpose a 64x64 bit matrix in place: bit j of a[i] swaps with bit i of a[j]
+static void transpose64(uint64_t a[64]) {
+    int j, k;
+    uint64_t m = 0x00000000FFFFFFFFULL, t;
+    for (j = 32; j != 0; j >>= 1, m ^= m << j) {
+        for (k = 0; k < 64; k = ((k | j) + 1) & ~j) {
+            t = ((a[k] >> j) ^ a[k | j]) & m;
+            a[k | j] ^= t;
+            a[k] ^= t << j;
+        }
+    }
+}
+
+//syndromes of n <= 64 words
+static void golay23_syndrome_slice(const int c[], int s[], int n) {
+    uint64_t a[64];
+    uint64_t p[11];
+    int x, y;
+
+    for (x = 0; x < n; x++) {
+        a[x] = (uint32_t)c[x];
+    }
+    for (; x < 64; x++) {
+        a[x] = 0;
+    }
+    transpose64(a);
+
+    //a[x] now holds bit x of every word. The low 11 bits are their own syndrome
+    for (y = 0; y < 11; y++) {
+        p[y] = a[y];
+    }
+    for (x = 11; x < 23; x++) {
+        for (y = 0; y < 11; y++) {
+            p[y] ^= a[x] & -(uint64_t)((bit_syndromes[x] >> y) & 1);
+        }
+    }
+
+    for (y = 0; y < 11; y++) {
+        a[y] = p[y];
+    }
+    for (; y < 64; y++) {
+        a[y] = 0;
+    }
+    transpose64(a);
+    for (x = 0; x < n; x++) {
+        s[x] = (int)a[x];
+    }
+}
+#endif
+
+void golay23_encode_batch(const int data[], int codewords[], int n) {
+    int x;
+#ifdef NO_TABLES
+    int blk[64];
+    while (n >= GOLAY23_SLICE_MIN) {
+        int m = n < 64 ? n : 64;
+        for (x = 0; x < m; x++) {
+            assert(data[x] >= 0 && data[x] <= 0xFFF);
+            blk[x] = data[x] << 11;
+        }
+        golay23_syndrome_slice(blk, codewords, m);
+        for (x = 0; x < m; x++) {
+            codewords[x] |= blk[x];
+        }
+        data += m;
+        codewords += m;
+        n -= m;
+    }
+#endif
+    for (x = 0; x < n; x++) {
+        codewords[x] = golay23_encode(data[x]);
+    }
+}
+
+void golay23_decode_batch(const int received[], int decoded[], int errs[], int n) {
+    int x;
+    for (x = 0; x < n; x++) {
+        decoded[x] = golay23_decode(received[x]);
+        if (errs != NULL) {
+#ifdef NO_TABLES
+            //decode only gives back the message here, so count against the full codeword
+            errs[x] = popcount(received[x] ^ golay23_encode(decoded[x] >> 11));
+#else
+            errs[x] = golay23_count_errors(received[x], decoded[x]);
+#endif
+        }
+    }
+}
+
 /**
  * Table generation and testing code below
  */
@@ -199,30 +425,34 @@ int  golay23_count_errors(int recd_codeword, int corrected_codeword) {
 #include <stdio.h>
 
 int main() {
-    int x;
+    int x, y;
     //generate and dump
     golay23_init();
 
-    FILE *enc = fopen("golayenctable.h", "w");
+    FILE *syn = fopen("golaysyntable.h", "w");
     FILE *dec = fopen("golaydectable.h", "w");
 
-    fprintf(enc, "/* Generated by golay23.c -DGOLAY23_MAKETABLE */\n\
+    fprintf(syn, "/* Generated by golay23.c -DGOLAY23_MAKETABLES */\n\
 \n\
-const int static encoding_table[]={\n");
-    for (x = 0; x < 4096; x++) {
-        fprintf(enc, x < 4095 ? "  0x%x,\n" : "  0x%x\n", encoding_table[x]);
+static const uint16_t syndrome_table[3][256]={\n");
+    for (y = 0; y < 3; y++) {
+        fprintf(syn, "  {\n");
+        for (x = 0; x < 256; x++) {
+            fprintf(syn, x < 255 ? "    0x%x,\n" : "    0x%x\n", syndrome_table[y][x]);
+        }
+        fprintf(syn, y < 2 ? "  },\n" : "  }\n");
     }
-    fprintf(enc, "};\n");
+    fprintf(syn, "};\n");
 
-    fprintf(dec, "/* Generated by golay23.c -DGOLAY23_MAKETABLE */\n\
+    fprintf(dec, "/* Generated by golay23.c -DGOLAY23_MAKETABLES */\n\
 \n\
-const int static decoding_table[]={\n");
+static const uint16_t decoding_table[]={\n");
     for (x = 0; x < 2048; x++) {
         fprintf(dec, x < 2047 ? "  0x%x,\n" : "  0x%x\n", decoding_table[x]);
     }
     fprintf(dec, "};\n");
 
-    fclose(enc);
+    fclose(syn);
     fclose(dec);
 
     return 0;
@@ -304,6 +534,26 @@ int main() {
         }
     }
 
+    //batch decode must land every received word on the codeword within 3 bits of it;
+    //the code is perfect, so that codeword is the only right answer
+    int *recd = malloc(sizeof(int)<<23);
+    int *dec = malloc(sizeof(int)<<23);
+    int *errs = malloc(sizeof(int)<<23);
+    for (c = 0; c < (1<<23); c++) {
+        recd[c] = c;
+    }
+    golay23_decode_batch(recd, dec, errs, 1<<23);
+    for (c = 0; c < (1<<23); c++) {
+        int e = popcount(c ^ golay23_encode(dec[c] >> 11));
+        if (e > 3 || errs[c] != e) {
+            printf("%06x batch decode bad!\n", c);
+            exit(1);
+        }
+    }
+    free(recd);
+    free(dec);
+    free(errs);
+
     printf("Everything checks out\n");
     free(checkmask);
     return 0;
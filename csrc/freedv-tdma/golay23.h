@@ -38,6 +38,19 @@ int  golay23_decode(int received_codeword);
 int  golay23_count_errors(int recd_codeword, int corrected_codeword);
 int  golay23_syndrome(int c);
 
+/* Soft decision decode. received is the hard decision as for golay23_decode, and
+   rel[i] >= 0 is how sure bit i is, e.g. the magnitude of its soft decision.
+   Returns the corrected codeword as golay23_decode does, and if errs isn't NULL
+   the number of bits corrected */
+int  golay23_decode_soft(int received, const float rel[], int *errs);
+
+/* Encode or decode n words at once; the results are as from golay23_encode and
+   golay23_decode. errs, if not NULL, gets the number of bits corrected in each
+   word. Built with NO_TABLES, encoding works out syndromes 64 words at a time,
+   bit-sliced */
+void golay23_encode_batch(const int data[], int codewords[], int n);
+void golay23_decode_batch(const int received[], int decoded[], int errs[], int n);
+
 #ifdef __cplusplus
 }
 #endif
@@ -1,2052 +1,2052 @@
-/* Generated by golay23.c -DGOLAY23_MAKETABLE */
+/* Generated by golay23.c -DGOLAY23_MAKETABLES */
 
-static const int decoding_table[]={
+static const uint16_t decoding_table[]={
   0x0,
   0x1,
   0x2,
-  0x3,
-  0x4,
-  0x5,
-  0x6,
-  0x7,
-  0x8,
-  0x9,
-  0xa,
-  0xb,
-  0xc,
-  0xd,
-  0xe,
-  0x24020,
-  0x10,
-  0x11,
-  0x12,
-  0x13,
-  0x14,
-  0x15,
-  0x16,
-  0x412000,
-  0x18,
-  0x19,
-  0x1a,
-  0x180800,
-  0x1c,
-  0x200300,
-  0x48040,
-  0x1480,
-  0x20,
-  0x21,
-  0x22,
-  0x23,
-  0x24,
-  0x25,
-  0x26,
-  0x24008,
-  0x28,
-  0x29,
-  0x2a,
-  0x24004,
-  0x2c,
-  0x24002,
-  0x24001,
-  0x24000,
-  0x30,
-  0x31,
-  0x32,
-  0x8180,
-  0x34,
-  0xc40,
-  0x301000,
-  0xc0200,
-  0x38,
-  0x43000,
-  0x400600,
-  0x210040,
-  0x90080,
-  0x508000,
-  0x2900,
-  0x24010,
-  0x40,
   0x41,
-  0x42,
-  0x43,
-  0x44,
-  0x45,
-  0x46,
-  0x280080,
-  0x48,
-  0x49,
-  0x4a,
-  0x2500,
-  0x4c,
-  0x111000,
-  0x48010,
-  0x400a00,
-  0x50,
-  0x51,
-  0x52,
-  0x21200,
-  0x54,
-  0xc20,
-  0x48008,
-  0x104100,
-  0x58,
-  0x404080,
-  0x48004,
-  0x210020,
-  0x48002,
-  0xa2000,
-  0x48000,
-  0x48001,
-  0x60,
+  0x3,
   0x61,
   0x62,
-  0x540000,
-  0x64,
-  0xc10,
-  0x10300,
-  0xb000,
-  0x68,
-  0x88200,
-  0x1880,
-  0x210010,
-  0x602000,
-  0x40180,
-  0x180400,
-  0x24040,
-  0x70,
-  0xc04,
-  0x86000,
-  0x210008,
-  0xc01,
-  0xc00,
-  0x420080,
-  0xc02,
-  0x120100,
-  0x210002,
-  0x210001,
-  0x210000,
-  0x5200,
-  0xc08,
-  0x48020,
-  0x210004,
-  0x80,
+  0xc41,
+  0x4,
   0x81,
   0x82,
+  0x1041,
   0x83,
-  0x84,
-  0x85,
-  0x86,
-  0x280040,
-  0x88,
-  0x89,
-  0x8a,
-  0x50200,
-  0x8c,
-  0xa800,
-  0x500100,
-  0x1410,
-  0x90,
-  0x91,
-  0x92,
-  0x8120,
-  0x94,
-  0x160000,
-  0x4a00,
-  0x1408,
-  0x98,
-  0x404040,
-  0x222000,
-  0x1404,
-  0x90020,
-  0x1402,
-  0x1401,
-  0x1400,
-  0xa0,
+  0x1061,
+  0x1062,
+  0x49e6,
+  0x5,
   0xa1,
   0xa2,
-  0x8110,
+  0x1441,
+  0xa3,
+  0x1461,
+  0x1462,
+  0x5e2e,
   0xa4,
-  0x401200,
-  0x42400,
-  0x110800,
-  0xa8,
-  0x300400,
-  0x1840,
-  0x482000,
-  0x90010,
-  0x40140,
-  0x208200,
-  0x24080,
-  0xb0,
-  0x8102,
-  0x8101,
-  0x8100,
-  0x90008,
-  0x206000,
-  0x420040,
-  0x8104,
-  0x90004,
-  0x20a00,
-  0x144000,
-  0x8108,
-  0x90000,
-  0x90001,
-  0x90002,
-  0x1420,
-  0xc0,
+  0x1481,
+  0x1482,
+  0x568c,
+  0x1483,
+  0x5949,
+  0x4e07,
+  0x3568,
+  0x6,
   0xc1,
   0xc2,
-  0x280004,
+  0x1841,
+  0xc3,
+  0x1861,
+  0x1862,
+  0x49e4,
   0xc4,
-  0x280002,
-  0x280001,
-  0x280000,
-  0xc8,
-  0x404010,
-  0x1820,
-  0x128000,
-  0x20600,
-  0x40120,
-  0x16000,
-  0x280008,
-  0xd0,
-  0x404008,
-  0x110400,
-  0x42800,
-  0x3100,
-  0x18200,
-  0x420020,
-  0x280010,
-  0x404001,
-  0x404000,
-  0x80300,
-  0x404002,
-  0x300800,
-  0x404004,
-  0x48080,
-  0x1440,
-  0xe0,
-  0x32000,
-  0x1808,
-  0x4600,
-  0x10c000,
-  0x40108,
-  0x420010,
-  0x280020,
-  0x1802,
-  0x40104,
-  0x1800,
-  0x1801,
-  0x40101,
-  0x40100,
-  0x1804,
-  0x40102,
-  0x240200,
-  0x181000,
-  0x420004,
-  0x8140,
-  0x420002,
-  0xc80,
-  0x420000,
-  0x420001,
-  0xa400,
-  0x404020,
-  0x1810,
-  0x210080,
-  0x90040,
-  0x40110,
-  0x420008,
-  0x102200,
-  0x100,
+  0x1881,
+  0x1882,
+  0x49e3,
+  0x1883,
+  0x49e2,
+  0x49e1,
+  0x24f,
+  0xc5,
+  0x18a1,
+  0x18a2,
+  0x4128,
+  0x18a3,
+  0x3167,
+  0x5aad,
+  0x526a,
+  0x18a4,
+  0x4dcd,
+  0x5d6a,
+  0x5a27,
+  0x5228,
+  0x5eb0,
+  0x3989,
+  0x49e5,
+  0x7,
+  0xe1,
+  0xe2,
+  0x1c41,
+  0xe3,
+  0x1c61,
+  0x1c62,
+  0x5a88,
+  0xe4,
+  0x1c81,
+  0x1c82,
+  0x3969,
+  0x1c83,
+  0x562d,
+  0x4e05,
+  0x5d8a,
+  0xe5,
+  0x1ca1,
+  0x1ca2,
+  0x49aa,
+  0x1ca3,
+  0x3166,
+  0x4e04,
+  0x55e9,
+  0x1ca4,
+  0x5de8,
+  0x4e03,
+  0x5a26,
+  0x4e02,
+  0x524e,
+  0x270,
+  0x4e01,
+  0xe6,
+  0x1cc1,
+  0x1cc2,
+  0x5eb3,
+  0x1cc3,
+  0x3165,
+  0x4549,
+  0x41cd,
+  0x1cc4,
+  0x520a,
+  0x3588,
+  0x5a25,
+  0x5ece,
+  0x4d28,
+  0x568b,
+  0x49e7,
+  0x1cc5,
+  0x3163,
+  0x51ee,
+  0x5a24,
+  0x3161,
+  0x18b,
+  0x5e48,
+  0x3162,
+  0x5649,
+  0x5a22,
+  0x5a21,
+  0x2d1,
+  0x3daa,
+  0x3164,
+  0x4e06,
+  0x5a23,
+  0x8,
   0x101,
   0x102,
+  0x2041,
   0x103,
+  0x2061,
+  0x2062,
+  0x5a87,
   0x104,
+  0x2081,
+  0x2082,
+  0x4e2a,
+  0x2083,
+  0x41cc,
+  0x5ea9,
+  0x3565,
   0x105,
+  0x20a1,
+  0x20a2,
+  0x4126,
+  0x20a3,
+  0x5672,
+  0x3d8a,
+  0x3564,
+  0x20a4,
+  0x5de7,
+  0x5a4e,
+  0x3563,
+  0x5226,
+  0x3562,
+  0x3561,
+  0x1ab,
   0x106,
-  0x41800,
-  0x108,
-  0x109,
-  0x10a,
-  0x2440,
-  0x10c,
-  0x200210,
-  0x500080,
-  0x98000,
-  0x110,
-  0x111,
-  0x112,
-  0x80a0,
-  0x114,
-  0x200208,
-  0xa0400,
-  0x104040,
-  0x118,
-  0x200204,
-  0x15000,
-  0x460000,
-  0x200201,
-  0x200200,
-  0x2820,
-  0x200202,
-  0x120,
+  0x20c1,
+  0x20c2,
+  0x4125,
+  0x20c3,
+  0x5daa,
+  0x4dcb,
+  0x562c,
+  0x20c4,
+  0x5aab,
+  0x3587,
+  0x5e8e,
+  0x5225,
+  0x4d27,
+  0x5a0a,
+  0x49e8,
+  0x20c5,
+  0x4122,
+  0x4121,
+  0x209,
+  0x5224,
+  0x59ee,
+  0x5e47,
+  0x4123,
+  0x5223,
+  0x498a,
+  0x566f,
+  0x4124,
+  0x291,
+  0x5221,
+  0x5222,
+  0x3566,
+  0x107,
+  0x20e1,
+  0x20e2,
+  0x5a83,
+  0x20e3,
+  0x5a82,
+  0x5a81,
+  0x2d4,
+  0x20e4,
+  0x5de5,
+  0x3586,
+  0x5650,
+  0x496a,
+  0x4d26,
+  0x45ee,
+  0x5a84,
+  0x20e5,
+  0x5de4,
+  0x562b,
+  0x4dcc,
+  0x39a9,
+  0x460a,
+  0x5e46,
+  0x5a85,
+  0x5de1,
+  0x2ef,
+  0x5149,
+  0x5de2,
+  0x5aac,
+  0x5de3,
+  0x4e08,
+  0x3567,
+  0x20e6,
+  0x4a2e,
+  0x3584,
+  0x3d6a,
+  0x560f,
+  0x4d24,
+  0x5e45,
+  0x5a86,
+  0x3582,
+  0x4d23,
+  0x1ac,
+  0x3581,
+  0x4d21,
+  0x269,
+  0x3583,
+  0x4d22,
+  0x5a6a,
+  0x568d,
+  0x5e43,
+  0x4127,
+  0x5e42,
+  0x3168,
+  0x2f2,
+  0x5e41,
+  0x41cb,
+  0x5de6,
+  0x3585,
+  0x5a28,
+  0x5227,
+  0x4d25,
+  0x5e44,
+  0x55ca,
+  0x9,
   0x121,
   0x122,
-  0x8090,
+  0x2441,
+  0x123,
+  0x2461,
+  0x2462,
+  0x4dac,
   0x124,
-  0x182000,
-  0x10240,
-  0x600400,
+  0x2481,
+  0x2482,
+  0x3967,
+  0x2483,
+  0x5945,
+  0x5ea8,
+  0x5230,
+  0x125,
+  0x24a1,
+  0x24a2,
+  0x4106,
+  0x24a3,
+  0x5944,
+  0x524b,
+  0x55e7,
+  0x24a4,
+  0x5943,
+  0x45ed,
+  0x5e72,
+  0x5941,
+  0x2ca,
+  0x3986,
+  0x5942,
+  0x126,
+  0x24c1,
+  0x24c2,
+  0x4105,
+  0x24c3,
+  0x568e,
+  0x4547,
+  0x5ecb,
+  0x24c4,
+  0x5e2c,
+  0x5a93,
+  0x55aa,
+  0x41ab,
+  0x4d07,
+  0x3985,
+  0x49e9,
+  0x24c5,
+  0x4102,
+  0x4101,
+  0x208,
+  0x5e6f,
+  0x4a2d,
+  0x3984,
+  0x4103,
+  0x5647,
+  0x51eb,
+  0x3983,
+  0x4104,
+  0x3982,
+  0x5946,
+  0x1cc,
+  0x3981,
+  0x127,
+  0x24e1,
+  0x24e2,
+  0x3964,
+  0x24e3,
+  0x5e50,
+  0x4546,
+  0x55e5,
+  0x24e4,
+  0x3962,
+  0x3961,
+  0x1cb,
+  0x51ec,
+  0x4d06,
+  0x5a4d,
+  0x3963,
+  0x24e5,
+  0x5271,
+  0x5ecc,
+  0x55e3,
+  0x39a8,
+  0x55e2,
+  0x55e1,
+  0x2af,
+  0x5646,
+  0x41ac,
+  0x5148,
+  0x3965,
+  0x5e2b,
+  0x5947,
+  0x4e09,
+  0x55e4,
+  0x24e6,
+  0x59ed,
+  0x4543,
+  0x524c,
+  0x4542,
+  0x4d04,
+  0x22a,
+  0x4541,
+  0x5645,
+  0x4d03,
+  0x5e0f,
+  0x3966,
+  0x4d01,
+  0x268,
+  0x4544,
+  0x4d02,
+  0x5644,
+  0x5dca,
+  0x4dab,
+  0x4107,
+  0x5a90,
+  0x3169,
+  0x4545,
+  0x55e6,
+  0x2b2,
+  0x5641,
+  0x5642,
+  0x5a29,
+  0x5643,
+  0x4d05,
+  0x3987,
+  0x5e8d,
   0x128,
-  0x410800,
-  0x2c0000,
-  0x101200,
-  0x9400,
-  0x400c0,
-  0x2810,
-  0x24100,
-  0x130,
-  0x8082,
-  0x8081,
-  0x8080,
-  0x444000,
-  0x31000,
-  0x2808,
-  0x8084,
-  0x120040,
-  0x84400,
-  0x2804,
-  0x8088,
-  0x2802,
-  0x200220,
-  0x2800,
-  0x2801,
-  0x140,
+  0x2501,
+  0x2502,
+  0x40c5,
+  0x2503,
+  0x45eb,
+  0x5ea4,
+  0x49ca,
+  0x2504,
+  0x524d,
+  0x5ea3,
+  0x59ec,
+  0x5ea2,
+  0x4ce6,
+  0x2f5,
+  0x5ea1,
+  0x2505,
+  0x40c2,
+  0x40c1,
+  0x206,
+  0x39a7,
+  0x5e8c,
+  0x5a71,
+  0x40c3,
+  0x4d8b,
+  0x562e,
+  0x5147,
+  0x40c4,
+  0x4a0f,
+  0x5948,
+  0x5ea5,
+  0x3569,
+  0x2506,
+  0x40a2,
+  0x40a1,
+  0x205,
+  0x5a4c,
+  0x4ce4,
+  0x51ed,
+  0x40a3,
+  0x3dca,
+  0x4ce3,
+  0x4a2b,
+  0x40a4,
+  0x4ce1,
+  0x267,
+  0x5ea6,
+  0x4ce2,
+  0x4041,
+  0x202,
+  0x201,
+  0x10,
+  0x556a,
+  0x4062,
+  0x4061,
+  0x203,
+  0x5ecd,
+  0x4082,
+  0x4081,
+  0x204,
+  0x5229,
+  0x4ce5,
+  0x3988,
+  0x4083,
+  0x2507,
+  0x558a,
+  0x4e4f,
+  0x5e2d,
+  0x39a5,
+  0x4cc4,
+  0x418b,
+  0x5a89,
+  0x5a30,
+  0x4cc3,
+  0x5145,
+  0x3968,
+  0x4cc1,
+  0x266,
+  0x5ea7,
+  0x4cc2,
+  0x39a3,
+  0x5a4b,
+  0x5144,
+  0x40e6,
+  0x1cd,
+  0x39a1,
+  0x39a2,
+  0x55e8,
+  0x5142,
+  0x5de9,
+  0x28a,
+  0x5141,
+  0x39a4,
+  0x4cc5,
+  0x5143,
+  0x4a2c,
+  0x5e8b,
+  0x4c83,
+  0x5aae,
+  0x40e5,
+  0x4c81,
+  0x264,
+  0x4548,
+  0x4c82,
+  0x4c61,
+  0x263,
+  0x3589,
+  0x4c62,
+  0x261,
+  0x13,
+  0x4c41,
+  0x262,
+  0x45ec,
+  0x40e2,
+  0x40e1,
+  0x207,
+  0x39a6,
+  0x4ca4,
+  0x5e49,
+  0x40e3,
+  0x5648,
+  0x4ca3,
+  0x5146,
+  0x40e4,
+  0x4ca1,
+  0x265,
+  0x59eb,
+  0x4ca2,
+  0xa,
   0x141,
   0x142,
-  0x2408,
+  0x2841,
+  0x143,
+  0x2861,
+  0x2862,
+  0x560b,
   0x144,
-  0x428000,
-  0x10220,
-  0x104010,
+  0x2881,
+  0x2882,
+  0x4e28,
+  0x2883,
+  0x5925,
+  0x51cd,
+  0x5d87,
+  0x145,
+  0x28a1,
+  0x28a2,
+  0x49a7,
+  0x28a3,
+  0x5924,
+  0x3d88,
+  0x5266,
+  0x28a4,
+  0x5923,
+  0x5d66,
+  0x41ee,
+  0x5921,
+  0x2c9,
+  0x5651,
+  0x5922,
+  0x146,
+  0x28c1,
+  0x28c2,
+  0x59cc,
+  0x28c3,
+  0x5da8,
+  0x4527,
+  0x5265,
+  0x28c4,
+  0x5207,
+  0x5d65,
+  0x55a9,
+  0x566c,
+  0x45cb,
+  0x5a08,
+  0x49ea,
+  0x28c5,
+  0x562f,
+  0x5d64,
+  0x5263,
+  0x4a0e,
+  0x5262,
+  0x5261,
+  0x293,
+  0x5d62,
+  0x4988,
+  0x2eb,
+  0x5d61,
+  0x3da7,
+  0x5926,
+  0x5d63,
+  0x5264,
+  0x147,
+  0x28e1,
+  0x28e2,
+  0x49a5,
+  0x28e3,
+  0x4dee,
+  0x4526,
+  0x5d84,
+  0x28e4,
+  0x5206,
+  0x5aaf,
+  0x5d83,
+  0x4968,
+  0x5d82,
+  0x5d81,
+  0x2ec,
+  0x28e5,
+  0x49a2,
+  0x49a1,
+  0x24d,
+  0x5eb4,
+  0x4608,
+  0x59cb,
+  0x49a3,
+  0x45cc,
+  0x566b,
+  0x5128,
+  0x49a4,
+  0x3da6,
+  0x5927,
+  0x4e0a,
+  0x5d85,
+  0x28e6,
+  0x5204,
+  0x4523,
+  0x3d68,
+  0x4522,
+  0x5ab2,
+  0x229,
+  0x4521,
+  0x5201,
+  0x290,
+  0x4e4e,
+  0x5202,
+  0x3da5,
+  0x5203,
+  0x4524,
+  0x5d86,
+  0x5a68,
+  0x5dc9,
+  0x560c,
+  0x49a6,
+  0x3da4,
+  0x316a,
+  0x4525,
+  0x5267,
+  0x3da3,
+  0x5205,
+  0x5d67,
+  0x5a2a,
+  0x1ed,
+  0x3da1,
+  0x3da2,
+  0x55c8,
   0x148,
-  0x2402,
-  0x2401,
-  0x2400,
-  0x84800,
-  0x400a0,
-  0x221000,
-  0x2404,
-  0x150,
-  0xd0000,
-  0x600800,
-  0x104004,
-  0x3080,
-  0x104002,
-  0x104001,
-  0x104000,
-  0x120020,
-  0x9800,
-  0x80280,
-  0x2410,
-  0x410400,
-  0x200240,
-  0x48100,
-  0x104008,
-  0x160,
-  0x205000,
-  0x10204,
-  0xa0800,
-  0x10202,
-  0x40088,
-  0x10200,
-  0x10201,
-  0x120010,
-  0x40084,
-  0x40c000,
-  0x2420,
-  0x40081,
-  0x40080,
-  0x10208,
-  0x40082,
-  0x120008,
-  0x402200,
-  0x41400,
-  0x80c0,
-  0x288000,
-  0xd00,
-  0x10210,
-  0x104020,
-  0x120000,
-  0x120001,
-  0x120002,
-  0x210100,
-  0x120004,
-  0x40090,
-  0x2840,
-  0x481000,
-  0x180,
+  0x2901,
+  0x2902,
+  0x4e24,
+  0x2903,
+  0x5da6,
+  0x3d85,
+  0x49c9,
+  0x2904,
+  0x4e22,
+  0x4e21,
+  0x271,
+  0x4967,
+  0x568f,
+  0x5a06,
+  0x4e23,
+  0x2905,
+  0x51cb,
+  0x3d83,
+  0x5ed5,
+  0x3d82,
+  0x4607,
+  0x1ec,
+  0x3d81,
+  0x560d,
+  0x4986,
+  0x5127,
+  0x4e25,
+  0x5e6e,
+  0x5928,
+  0x3d84,
+  0x356a,
+  0x2906,
+  0x5da3,
+  0x5692,
+  0x3d67,
+  0x5da1,
+  0x2ed,
+  0x5a04,
+  0x5da2,
+  0x3dc9,
+  0x4985,
+  0x5a03,
+  0x4e26,
+  0x5a02,
+  0x5da4,
+  0x2d0,
+  0x5a01,
+  0x5a67,
+  0x4984,
+  0x45cd,
+  0x4149,
+  0x5569,
+  0x5da5,
+  0x3d86,
+  0x5268,
+  0x4981,
+  0x24c,
+  0x5d68,
+  0x4982,
+  0x522a,
+  0x4983,
+  0x5a05,
+  0x55c7,
+  0x2907,
+  0x5589,
+  0x5e0e,
+  0x3d66,
+  0x4964,
+  0x4605,
+  0x566d,
+  0x5a8a,
+  0x4963,
+  0x59cd,
+  0x5125,
+  0x4e27,
+  0x24b,
+  0x4961,
+  0x4962,
+  0x5d88,
+  0x5a66,
+  0x4603,
+  0x5124,
+  0x49a8,
+  0x4601,
+  0x230,
+  0x3d87,
+  0x4602,
+  0x5122,
+  0x5dea,
+  0x289,
+  0x5121,
+  0x4965,
+  0x4604,
+  0x5123,
+  0x55c6,
+  0x5a65,
+  0x3d62,
+  0x3d61,
+  0x1eb,
+  0x51cc,
+  0x5da7,
+  0x4528,
+  0x3d63,
+  0x5eb1,
+  0x5208,
+  0x358a,
+  0x3d64,
+  0x4966,
+  0x4d49,
+  0x5a07,
+  0x55c5,
+  0x2d3,
+  0x5a61,
+  0x5a62,
+  0x3d65,
+  0x5a63,
+  0x4606,
+  0x5e4a,
+  0x55c4,
+  0x5a64,
+  0x4987,
+  0x5126,
+  0x55c3,
+  0x3da8,
+  0x55c2,
+  0x55c1,
+  0x2ae,
+  0x149,
+  0x2921,
+  0x2922,
+  0x5e8f,
+  0x2923,
+  0x58a4,
+  0x44e6,
+  0x49c8,
+  0x2924,
+  0x58a3,
+  0x4a0c,
+  0x55a6,
+  0x58a1,
+  0x2c5,
+  0x4deb,
+  0x58a2,
+  0x2925,
+  0x5883,
+  0x566e,
+  0x458b,
+  0x5881,
+  0x2c4,
+  0x5e0d,
+  0x5882,
+  0x5861,
+  0x2c3,
+  0x5107,
+  0x5862,
+  0x2c1,
+  0x16,
+  0x5841,
+  0x2c2,
+  0x2926,
+  0x4e4b,
+  0x44e3,
+  0x55a4,
+  0x44e2,
+  0x41ec,
+  0x227,
+  0x44e1,
+  0x3dc8,
+  0x55a2,
+  0x55a1,
+  0x2ad,
+  0x5e92,
+  0x58c5,
+  0x44e4,
+  0x55a3,
+  0x51ac,
+  0x5dc7,
+  0x5a4f,
+  0x4148,
+  0x5568,
+  0x58c4,
+  0x44e5,
+  0x5269,
+  0x4e30,
+  0x58c3,
+  0x5d69,
+  0x55a5,
+  0x58c1,
+  0x2c6,
+  0x398a,
+  0x58c2,
+  0x2927,
+  0x5588,
+  0x44c3,
+  0x5a70,
+  0x44c2,
+  0x51ab,
+  0x226,
+  0x44c1,
+  0x5e6d,
+  0x4a2f,
+  0x5105,
+  0x396a,
+  0x560e,
+  0x58e5,
+  0x44c4,
+  0x5d89,
+  0x41eb,
+  0x5dc6,
+  0x5104,
+  0x49a9,
+  0x4e4c,
+  0x58e4,
+  0x44c5,
+  0x55ea,
+  0x5102,
+  0x58e3,
+  0x288,
+  0x5101,
+  0x58e1,
+  0x2c7,
+  0x5103,
+  0x58e2,
+  0x4462,
+  0x5dc5,
+  0x223,
+  0x4461,
+  0x222,
+  0x4441,
+  0x11,
+  0x221,
+  0x598b,
+  0x5209,
+  0x4483,
+  0x55a7,
+  0x4482,
+  0x4d48,
+  0x224,
+  0x4481,
+  0x5dc1,
+  0x2ee,
+  0x44a3,
+  0x5dc2,
+  0x44a2,
+  0x5dc3,
+  0x225,
+  0x44a1,
+  0x564a,
+  0x5dc4,
+  0x5106,
+  0x4dec,
+  0x3da9,
+  0x58e6,
+  0x44a4,
+  0x4a0b,
+  0x2928,
+  0x5587,
+  0x59ab,
+  0x49c3,
+  0x5270,
+  0x49c2,
+  0x49c1,
+  0x24e,
+  0x3dc6,
+  0x5e0b,
+  0x50e5,
+  0x4e29,
+  0x45ac,
+  0x5905,
+  0x5eaa,
+  0x49c4,
+  0x5e51,
+  0x4ded,
+  0x50e4,
+  0x4146,
+  0x5566,
+  0x5904,
+  0x3d89,
+  0x49c5,
+  0x50e2,
+  0x5903,
+  0x287,
+  0x50e1,
+  0x5901,
+  0x2c8,
+  0x50e3,
+  0x5902,
+  0x3dc4,
+  0x5a91,
+  0x5e6c,
+  0x4145,
+  0x5565,
+  0x5da9,
+  0x4507,
+  0x49c6,
+  0x1ee,
+  0x3dc1,
+  0x3dc2,
+  0x55a8,
+  0x3dc3,
+  0x4d47,
+  0x5a09,
+  0x518b,
+  0x5563,
+  0x4142,
+  0x4141,
+  0x20a,
+  0x2ab,
+  0x5561,
+  0x5562,
+  0x4143,
+  0x3dc5,
+  0x4989,
+  0x50e6,
+  0x4144,
+  0x5564,
+  0x5906,
+  0x4e4d,
+  0x5e2f,
+  0x5581,
+  0x2ac,
+  0x50a4,
+  0x5582,
+  0x5ecf,
+  0x5583,
+  0x4506,
+  0x49c7,
+  0x50a2,
+  0x5584,
+  0x285,
+  0x50a1,
+  0x4969,
+  0x4d46,
+  0x50a3,
+  0x41ed,
+  0x5082,
+  0x5585,
+  0x284,
+  0x5081,
+  0x39aa,
+  0x4609,
+  0x5083,
+  0x5e6b,
+  0x282,
+  0x5041,
+  0x14,
+  0x281,
+  0x5062,
+  0x5907,
+  0x283,
+  0x5061,
+  0x4a0d,
+  0x5586,
+  0x4503,
+  0x3d69,
+  0x4502,
+  0x4d44,
+  0x228,
+  0x4501,
+  0x3dc7,
+  0x4d43,
+  0x50c5,
+  0x5ed2,
+  0x4d41,
+  0x26a,
+  0x4504,
+  0x4d42,
+  0x5a69,
+  0x5dc8,
+  0x50c4,
+  0x4147,
+  0x5567,
+  0x524f,
+  0x4505,
+  0x59ac,
+  0x50c2,
+  0x45ab,
+  0x286,
+  0x50c1,
+  0x5e0c,
+  0x4d45,
+  0x50c3,
+  0x55c9,
+  0xb,
+  0x161,
+  0x162,
+  0x2c41,
+  0x163,
+  0x2c61,
+  0x2c62,
+  0x560a,
+  0x164,
+  0x2c81,
+  0x2c82,
+  0x3927,
+  0x2c83,
+  0x5e93,
+  0x5a2c,
+  0x3505,
+  0x165,
+  0x2ca1,
+  0x2ca2,
+  0x5a6f,
+  0x2ca3,
+  0x30e6,
+  0x5249,
+  0x3504,
+  0x2ca4,
+  0x4a30,
+  0x5d46,
+  0x3503,
+  0x55ee,
+  0x3502,
+  0x3501,
+  0x1a8,
+  0x166,
+  0x2cc1,
+  0x2cc2,
+  0x522d,
+  0x2cc3,
+  0x30e5,
+  0x4dc8,
+  0x5ec9,
+  0x2cc4,
+  0x5aa8,
+  0x5d45,
+  0x4e0c,
+  0x41a9,
+  0x45ca,
+  0x5687,
+  0x49eb,
+  0x2cc5,
+  0x30e3,
+  0x5d44,
+  0x564e,
+  0x30e1,
+  0x187,
+  0x460f,
+  0x30e2,
+  0x5d42,
+  0x51e9,
+  0x2ea,
+  0x5d41,
+  0x5a72,
+  0x30e4,
+  0x5d43,
+  0x3506,
+  0x167,
+  0x2ce1,
+  0x2ce2,
+  0x3924,
+  0x2ce3,
+  0x30c5,
+  0x5ded,
+  0x4e51,
+  0x2ce4,
+  0x3922,
+  0x3921,
+  0x1c9,
+  0x4948,
+  0x5a0f,
+  0x5686,
+  0x3923,
+  0x2ce5,
+  0x30c3,
+  0x5628,
+  0x5e90,
+  0x30c1,
+  0x186,
+  0x59ca,
+  0x30c2,
+  0x5a8d,
+  0x566a,
+  0x49ec,
+  0x3925,
+  0x5e29,
+  0x30c4,
+  0x4e0b,
+  0x3507,
+  0x2ce6,
+  0x30a3,
+  0x5a50,
+  0x3d48,
+  0x30a1,
+  0x185,
+  0x5684,
+  0x30a2,
+  0x4e2f,
+  0x5e4d,
+  0x5683,
+  0x3926,
+  0x5682,
+  0x30a4,
+  0x2b4,
+  0x5681,
+  0x3061,
+  0x183,
+  0x4da9,
+  0x3062,
   0x181,
+  0xc,
+  0x3041,
   0x182,
-  0x8030,
+  0x41c8,
+  0x3083,
+  0x5d47,
+  0x5a2b,
+  0x3081,
   0x184,
-  0x14400,
-  0x500008,
-  0x22200,
+  0x5685,
+  0x3082,
+  0x168,
+  0x2d01,
+  0x2d02,
+  0x5e4c,
+  0x2d03,
+  0x45e9,
+  0x4dc6,
+  0x34a4,
+  0x2d04,
+  0x5aa6,
+  0x520f,
+  0x34a3,
+  0x4947,
+  0x34a2,
+  0x34a1,
+  0x1a5,
+  0x2d05,
+  0x51ca,
+  0x5627,
+  0x3483,
+  0x5ed0,
+  0x3482,
+  0x3481,
+  0x1a4,
+  0x4d89,
+  0x3462,
+  0x3461,
+  0x1a3,
+  0x3441,
+  0x1a2,
+  0x1a1,
+  0xd,
+  0x2d06,
+  0x5aa4,
+  0x4dc3,
+  0x3d47,
+  0x4dc2,
+  0x5250,
+  0x26e,
+  0x4dc1,
+  0x5aa1,
+  0x2d5,
+  0x4a29,
+  0x5aa2,
+  0x5dec,
+  0x5aa3,
+  0x4dc4,
+  0x34c5,
+  0x49ed,
+  0x5e71,
+  0x5a8c,
+  0x4169,
+  0x5549,
+  0x3107,
+  0x4dc5,
+  0x34c4,
+  0x41c7,
+  0x5aa5,
+  0x5d48,
+  0x34c3,
+  0x522b,
+  0x34c2,
+  0x34c1,
+  0x1a6,
+  0x2d07,
+  0x4e0d,
+  0x5625,
+  0x3d46,
+  0x4944,
+  0x5eae,
+  0x4189,
+  0x5a8b,
+  0x4943,
+  0x522c,
+  0x5ed3,
+  0x3928,
+  0x24a,
+  0x4941,
+  0x4942,
+  0x34e5,
+  0x5622,
+  0x5a49,
+  0x2b1,
+  0x5621,
+  0x526f,
+  0x3106,
+  0x5623,
+  0x34e4,
+  0x41c6,
+  0x5deb,
+  0x5624,
+  0x34e3,
+  0x4945,
+  0x34e2,
+  0x34e1,
+  0x1a7,
+  0x5e89,
+  0x3d42,
+  0x3d41,
+  0x1ea,
+  0x5a2d,
+  0x3105,
+  0x4dc7,
+  0x3d43,
+  0x41c5,
+  0x5aa7,
+  0x358b,
+  0x3d44,
+  0x4946,
+  0x4d69,
+  0x5688,
+  0x5e30,
+  0x41c4,
+  0x3103,
+  0x5626,
+  0x3d45,
+  0x3101,
   0x188,
-  0xa1000,
-  0x500004,
-  0x204800,
-  0x500002,
-  0x40060,
-  0x500000,
-  0x500001,
-  0x190,
-  0x8022,
-  0x8021,
-  0x8020,
-  0x3040,
-  0x480800,
-  0x250000,
-  0x8024,
-  0x40c00,
-  0x112000,
-  0x80240,
-  0x8028,
-  0x2c000,
-  0x200280,
-  0x500010,
-  0x1500,
-  0x1a0,
-  0x8012,
-  0x8011,
-  0x8010,
-  0x220800,
-  0x40048,
-  0x85000,
-  0x8014,
-  0x6200,
-  0x40044,
-  0x30400,
-  0x8018,
-  0x40041,
-  0x40040,
-  0x500020,
-  0x40042,
-  0x8003,
-  0x8002,
-  0x8001,
-  0x8000,
-  0x100600,
-  0x8006,
-  0x8005,
-  0x8004,
-  0x601000,
-  0x800a,
-  0x8009,
-  0x8008,
-  0x90100,
-  0x40050,
-  0x2880,
-  0x800c,
-  0x1c0,
-  0x100a00,
-  0x64000,
-  0x411000,
-  0x3010,
-  0x40028,
-  0x8c00,
-  0x280100,
-  0x218000,
-  0x40024,
-  0x80210,
-  0x2480,
-  0x40021,
-  0x40020,
-  0x500040,
-  0x40022,
-  0x3004,
-  0x220400,
-  0x80208,
-  0x8060,
-  0x3000,
-  0x3001,
-  0x3002,
-  0x104080,
-  0x80202,
-  0x404100,
-  0x80200,
-  0x80201,
-  0x3008,
-  0x40030,
-  0x80204,
-  0x30800,
-  0x480400,
-  0x4000c,
-  0x302000,
-  0x8050,
-  0x40009,
-  0x40008,
-  0x10280,
-  0x4000a,
-  0x40005,
-  0x40004,
-  0x1900,
-  0x40006,
-  0x40001,
-  0x40000,
-  0x40003,
-  0x40002,
-  0x14800,
-  0x8042,
-  0x8041,
-  0x8040,
-  0x3020,
-  0x40018,
-  0x420100,
-  0x8044,
-  0x120080,
-  0x40014,
-  0x80220,
-  0x8048,
-  0x40011,
-  0x40010,
-  0x204400,
-  0x40012,
-  0x200,
-  0x201,
-  0x202,
-  0x203,
-  0x204,
-  0x205,
-  0x206,
-  0x108400,
-  0x208,
-  0x209,
-  0x20a,
-  0x50080,
+  0x5e4b,
+  0x3102,
+  0x20e,
+  0x41c1,
+  0x41c2,
+  0x5272,
+  0x41c3,
+  0x3104,
+  0x59e9,
+  0x34e6,
+  0x169,
+  0x2d21,
+  0x2d22,
+  0x38e4,
+  0x2d23,
+  0x45e8,
+  0x5245,
+  0x5ec6,
+  0x2d24,
+  0x38e2,
+  0x38e1,
+  0x1c7,
+  0x41a6,
+  0x564c,
+  0x4dea,
+  0x38e3,
+  0x2d25,
+  0x5ead,
+  0x5243,
+  0x458a,
+  0x5242,
+  0x4e0e,
+  0x292,
+  0x5241,
+  0x4d88,
+  0x51e6,
+  0x5ab0,
+  0x38e5,
+  0x5e27,
+  0x596a,
+  0x5244,
+  0x3528,
+  0x2d26,
+  0x4e4a,
+  0x55ec,
+  0x5ec3,
+  0x41a4,
+  0x5ec2,
+  0x5ec1,
+  0x2f6,
+  0x41a3,
+  0x51e5,
+  0x4a28,
+  0x38e6,
+  0x20d,
+  0x41a1,
+  0x41a2,
+  0x5ec4,
+  0x5a2e,
+  0x51e4,
+  0x4da7,
+  0x4168,
+  0x5548,
+  0x3127,
+  0x5246,
+  0x5ec5,
+  0x51e1,
+  0x28f,
+  0x5d49,
+  0x51e2,
+  0x41a5,
+  0x51e3,
+  0x398b,
+  0x5671,
+  0x2d27,
+  0x3882,
+  0x3881,
+  0x1c4,
+  0x5ab3,
+  0x51aa,
+  0x4188,
+  0x3883,
+  0x3841,
+  0x1c2,
+  0x1c1,
+  0xe,
+  0x5e25,
+  0x3862,
+  0x3861,
+  0x1c3,
+  0x41ea,
+  0x5a48,
+  0x4da6,
+  0x38a4,
+  0x5e24,
+  0x3126,
+  0x5247,
+  0x55eb,
+  0x5e23,
+  0x38a2,
+  0x38a1,
+  0x1c5,
+  0x2f1,
+  0x5e21,
+  0x5e22,
+  0x38a3,
+  0x5e88,
+  0x5630,
+  0x4da5,
+  0x38c4,
+  0x49ee,
+  0x3125,
+  0x456a,
+  0x5ec7,
+  0x598a,
+  0x38c2,
+  0x38c1,
+  0x1c6,
+  0x41a7,
+  0x4d68,
+  0x5689,
+  0x38c3,
+  0x4da2,
+  0x3123,
+  0x26d,
+  0x4da1,
+  0x3121,
+  0x189,
+  0x4da3,
+  0x3122,
+  0x564b,
+  0x51e7,
+  0x4da4,
+  0x38c5,
+  0x5e26,
+  0x3124,
+  0x59e8,
+  0x4a0a,
+  0x2d28,
+  0x45e3,
+  0x59aa,
+  0x5693,
+  0x45e1,
+  0x22f,
+  0x4187,
+  0x45e2,
+  0x4d85,
+  0x5e0a,
+  0x4a26,
+  0x3907,
+  0x5a8e,
+  0x45e4,
+  0x5eab,
+  0x3525,
+  0x4d84,
+  0x5a47,
+  0x5dee,
+  0x4166,
+  0x5546,
+  0x45e5,
+  0x5248,
+  0x3524,
+  0x26c,
+  0x4d81,
+  0x4d82,
+  0x3523,
+  0x4d83,
+  0x3522,
+  0x3521,
+  0x1a9,
+  0x5e87,
+  0x39ac,
+  0x4a24,
+  0x4165,
+  0x5545,
+  0x45e6,
+  0x4dc9,
+  0x5ec8,
+  0x4a22,
+  0x5aa9,
+  0x251,
+  0x4a21,
+  0x41a8,
+  0x4d67,
+  0x4a23,
+  0x518a,
+  0x5543,
+  0x4162,
+  0x4161,
+  0x20b,
+  0x2aa,
+  0x5541,
+  0x5542,
+  0x4163,
+  0x4d86,
+  0x51e8,
+  0x4a25,
+  0x4164,
+  0x5544,
+  0x5e4e,
+  0x59e7,
+  0x3526,
+  0x5e86,
+  0x5a45,
+  0x4183,
+  0x3904,
+  0x4182,
+  0x45e7,
   0x20c,
-  0x200110,
-  0x83000,
-  0x400840,
-  0x210,
-  0x211,
-  0x212,
-  0x21040,
-  0x214,
-  0x200108,
-  0x4880,
-  0xc0020,
-  0x218,
-  0x200104,
-  0x400420,
-  0xe000,
-  0x200101,
-  0x200100,
-  0x130000,
-  0x200102,
-  0x220,
-  0x221,
-  0x222,
-  0x202800,
-  0x224,
-  0x401080,
-  0x10140,
-  0xc0010,
-  0x228,
-  0x88040,
-  0x400410,
-  0x101100,
-  0x140800,
-  0x12400,
-  0x208080,
-  0x24200,
-  0x230,
-  0x114000,
-  0x400408,
-  0xc0004,
-  0x2a000,
-  0xc0002,
-  0xc0001,
-  0xc0000,
-  0x400402,
-  0x20880,
-  0x400400,
-  0x400401,
-  0x5040,
-  0x200120,
-  0x400404,
-  0xc0008,
-  0x240,
+  0x4181,
+  0x55ed,
+  0x3902,
+  0x3901,
+  0x1c8,
+  0x4949,
+  0x4d66,
+  0x4184,
+  0x3903,
+  0x5a41,
+  0x2d2,
+  0x5629,
+  0x5a42,
+  0x39ab,
+  0x5a43,
+  0x4185,
+  0x5e6a,
+  0x4d87,
+  0x5a44,
+  0x516a,
+  0x3905,
+  0x5e28,
+  0x5690,
+  0x59e6,
+  0x3527,
+  0x2f4,
+  0x5e81,
+  0x5e82,
+  0x3d49,
+  0x5e83,
+  0x4d64,
+  0x4186,
+  0x564d,
+  0x5e84,
+  0x4d63,
+  0x4a27,
+  0x3906,
+  0x4d61,
+  0x26b,
+  0x59e5,
+  0x4d62,
+  0x5e85,
+  0x5a46,
+  0x4da8,
+  0x4167,
+  0x5547,
+  0x3128,
+  0x59e4,
+  0x522e,
+  0x41c9,
+  0x45aa,
+  0x59e3,
+  0x5eac,
+  0x59e2,
+  0x4d65,
+  0x2cf,
+  0x59e1,
+  0x16a,
+  0x2d41,
+  0x2d42,
+  0x5603,
+  0x2d43,
+  0x5602,
+  0x5601,
+  0x2b0,
+  0x2d44,
+  0x3dac,
+  0x5cc5,
+  0x5a92,
+  0x4907,
+  0x45c6,
+  0x4de9,
+  0x5604,
+  0x2d45,
+  0x51c8,
+  0x5cc4,
+  0x4589,
+  0x4e2d,
+  0x5e4f,
+  0x59c7,
+  0x5605,
+  0x5cc2,
+  0x5667,
+  0x2e6,
+  0x5cc1,
+  0x520c,
+  0x5969,
+  0x5cc3,
+  0x3548,
+  0x2d46,
+  0x4e49,
+  0x5ca4,
+  0x3d07,
+  0x5a8f,
+  0x45c4,
+  0x49ac,
+  0x5606,
+  0x5ca2,
+  0x45c3,
+  0x2e5,
+  0x5ca1,
+  0x45c1,
+  0x22e,
+  0x5ca3,
+  0x45c2,
+  0x5c82,
+  0x5a0d,
+  0x2e4,
+  0x5c81,
+  0x5528,
+  0x3147,
+  0x5c83,
+  0x526b,
+  0x2e2,
+  0x5c41,
+  0x17,
+  0x2e1,
+  0x5c62,
+  0x45c5,
+  0x2e3,
+  0x5c61,
+  0x2d47,
+  0x5ed1,
+  0x526c,
+  0x3d06,
+  0x4904,
+  0x51a9,
+  0x59c5,
+  0x5607,
+  0x4903,
+  0x5665,
+  0x460d,
+  0x3949,
+  0x248,
+  0x4901,
+  0x4902,
+  0x5d8b,
+  0x41e9,
+  0x5664,
+  0x59c3,
+  0x49ab,
+  0x59c2,
+  0x3146,
+  0x2ce,
+  0x59c1,
+  0x5661,
+  0x2b3,
+  0x5ce6,
+  0x5662,
+  0x4905,
+  0x5663,
+  0x59c4,
+  0x522f,
+  0x55cd,
+  0x3d02,
+  0x3d01,
+  0x1e8,
+  0x5e70,
+  0x3145,
+  0x4569,
+  0x3d03,
+  0x5989,
+  0x520b,
+  0x5ce5,
+  0x3d04,
+  0x4906,
+  0x45c7,
+  0x568a,
+  0x5a6d,
+  0x5251,
+  0x3143,
+  0x5ce4,
+  0x3d05,
+  0x3141,
+  0x18a,
+  0x59c6,
+  0x3142,
+  0x5ce2,
+  0x5666,
+  0x2e7,
+  0x5ce1,
+  0x3dab,
+  0x3144,
+  0x5ce3,
+  0x4a09,
+  0x2d48,
+  0x51c5,
+  0x59a9,
+  0x3ce6,
+  0x48e4,
+  0x5a6c,
+  0x5e91,
+  0x5608,
+  0x48e3,
+  0x5e09,
+  0x55cc,
+  0x4e2b,
+  0x247,
+  0x48e1,
+  0x48e2,
+  0x3545,
+  0x51c1,
+  0x28e,
+  0x4e50,
+  0x51c2,
+  0x5526,
+  0x51c3,
+  0x3d8b,
+  0x3544,
+  0x5a2f,
+  0x51c4,
+  0x5d06,
+  0x3543,
+  0x48e5,
+  0x3542,
+  0x3541,
+  0x1aa,
+  0x460c,
+  0x3ce2,
+  0x3ce1,
+  0x1e7,
+  0x5525,
+  0x5dab,
+  0x4dca,
+  0x3ce3,
+  0x526d,
+  0x5aaa,
+  0x5d05,
+  0x3ce4,
+  0x48e6,
+  0x45c8,
+  0x5a0b,
+  0x5189,
+  0x5523,
+  0x51c6,
+  0x5d04,
+  0x3ce5,
+  0x2a9,
+  0x5521,
+  0x5522,
+  0x5a51,
+  0x5d02,
+  0x498b,
+  0x2e8,
+  0x5d01,
+  0x5524,
+  0x4e0f,
+  0x5d03,
+  0x3546,
+  0x4883,
+  0x3cc2,
+  0x3cc1,
+  0x1e6,
+  0x244,
+  0x4881,
+  0x4882,
+  0x3cc3,
+  0x243,
+  0x4861,
+  0x4862,
+  0x3cc4,
+  0x12,
   0x241,
   0x242,
-  0x21010,
-  0x244,
-  0x46000,
-  0x10120,
-  0x400808,
-  0x248,
-  0x88020,
-  0x304000,
-  0x400804,
-  0x20480,
-  0x400802,
-  0x400801,
-  0x400800,
+  0x4841,
+  0x5dac,
+  0x51c7,
+  0x562a,
+  0x3cc5,
+  0x48a4,
+  0x460b,
+  0x59c8,
+  0x5e69,
+  0x48a3,
+  0x5668,
+  0x5169,
+  0x5a0c,
+  0x245,
+  0x48a1,
+  0x48a2,
+  0x3547,
+  0x3c41,
+  0x1e2,
+  0x1e1,
+  0xf,
+  0x48c4,
+  0x3c62,
+  0x3c61,
+  0x1e3,
+  0x48c3,
+  0x3c82,
+  0x3c81,
+  0x1e4,
+  0x246,
+  0x48c1,
+  0x48c2,
+  0x3c83,
+  0x5a6b,
+  0x3ca2,
+  0x3ca1,
+  0x1e5,
+  0x5527,
+  0x3148,
+  0x520d,
+  0x3ca3,
+  0x41ca,
+  0x45a9,
+  0x5d07,
+  0x3ca4,
+  0x48c5,
+  0x5ed4,
+  0x4e2c,
+  0x55cb,
+  0x2d49,
+  0x4e46,
+  0x59a8,
+  0x4585,
+  0x5dcc,
+  0x51a7,
+  0x4de4,
+  0x5609,
+  0x5691,
+  0x5e08,
+  0x4de3,
+  0x3947,
+  0x4de2,
+  0x5965,
+  0x26f,
+  0x4de1,
+  0x41e7,
+  0x4582,
+  0x4581,
+  0x22c,
+  0x5506,
+  0x5964,
+  0x524a,
+  0x4583,
+  0x49cd,
+  0x5963,
+  0x5d26,
+  0x4584,
+  0x5961,
+  0x2cb,
+  0x4de5,
+  0x5962,
+  0x4e41,
+  0x272,
+  0x520e,
+  0x4e42,
+  0x5505,
+  0x4e43,
+  0x4567,
+  0x5eca,
+  0x5987,
+  0x4e44,
+  0x5d25,
+  0x55ab,
+  0x41aa,
+  0x45c9,
+  0x4de6,
+  0x5188,
+  0x5503,
+  0x4e45,
+  0x5d24,
+  0x4586,
+  0x2a8,
+  0x5501,
+  0x5502,
+  0x3dcd,
+  0x5d22,
+  0x51ea,
+  0x2e9,
+  0x5d21,
+  0x5504,
+  0x5966,
+  0x5d23,
+  0x4a07,
+  0x41e5,
+  0x51a3,
+  0x5eb2,
+  0x3944,
+  0x51a1,
+  0x28d,
+  0x4566,
+  0x51a2,
+  0x5986,
+  0x3942,
+  0x3941,
+  0x1ca,
+  0x4928,
+  0x51a4,
+  0x4de7,
+  0x3943,
+  0x20f,
+  0x41e1,
+  0x41e2,
+  0x4587,
+  0x41e3,
+  0x51a5,
+  0x59c9,
+  0x5e68,
+  0x41e4,
+  0x5669,
+  0x5168,
+  0x3945,
+  0x5e2a,
+  0x5967,
+  0x55ac,
+  0x4a06,
+  0x5984,
+  0x4e47,
+  0x4563,
+  0x3d28,
+  0x4562,
+  0x51a6,
+  0x22b,
+  0x4561,
+  0x2cc,
+  0x5981,
+  0x5982,
+  0x3946,
+  0x5983,
+  0x5eaf,
+  0x4564,
+  0x4a05,
+  0x41e6,
+  0x5dcb,
+  0x4daa,
+  0x5ab4,
+  0x5507,
+  0x3149,
+  0x4565,
+  0x4a04,
+  0x5985,
+  0x45a8,
+  0x5d27,
+  0x4a03,
+  0x526e,
+  0x4a02,
+  0x4a01,
   0x250,
-  0x21002,
-  0x21001,
-  0x21000,
-  0x580000,
-  0x18080,
-  0x202400,
-  0x21004,
-  0x12800,
-  0x140400,
-  0x80180,
-  0x21008,
-  0x5020,
-  0x200140,
-  0x48200,
-  0x400810,
-  0x260,
-  0x88008,
-  0x10104,
-  0x4480,
-  0x10102,
-  0x320000,
-  0x10100,
-  0x10101,
-  0x88001,
-  0x88000,
-  0x62000,
-  0x88002,
-  0x5010,
-  0x88004,
-  0x10108,
-  0x400820,
-  0x240080,
-  0x402100,
-  0x108800,
-  0x21020,
-  0x5008,
-  0xe00,
-  0x10110,
-  0xc0040,
-  0x5004,
-  0x88010,
-  0x400440,
-  0x210200,
-  0x5000,
-  0x5001,
-  0x5002,
-  0x102080,
-  0x280,
-  0x281,
-  0x282,
-  0x50008,
-  0x284,
-  0x401020,
-  0x4810,
-  0x22100,
-  0x288,
-  0x50002,
-  0x50001,
-  0x50000,
-  0x20440,
-  0x184000,
-  0x208020,
-  0x50004,
-  0x290,
-  0x82400,
-  0x4804,
-  0x700000,
-  0x4802,
-  0x18040,
-  0x4800,
-  0x4801,
-  0x109000,
-  0x20820,
-  0x80140,
-  0x50010,
-  0x442000,
-  0x200180,
-  0x4808,
-  0x1600,
-  0x2a0,
-  0x401004,
-  0x1a0000,
-  0x4440,
-  0x401001,
-  0x401000,
-  0x208008,
-  0x401002,
-  0x6100,
-  0x20810,
-  0x208004,
-  0x50020,
-  0x208002,
-  0x401008,
-  0x208000,
-  0x208001,
-  0x240040,
-  0x20808,
-  0x13000,
-  0x8300,
-  0x100500,
-  0x401010,
-  0x4820,
-  0xc0080,
-  0x20801,
-  0x20800,
-  0x400480,
-  0x20802,
-  0x90200,
-  0x20804,
-  0x208010,
-  0x102040,
-  0x2c0,
-  0x100900,
-  0x40a000,
-  0x4420,
-  0x20408,
-  0x18010,
-  0x141000,
-  0x280200,
-  0x20404,
-  0x203000,
-  0x80110,
-  0x50040,
-  0x20400,
-  0x20401,
-  0x20402,
-  0x400880,
-  0x240020,
-  0x18004,
-  0x80108,
-  0x21080,
-  0x18001,
-  0x18000,
-  0x4840,
-  0x18002,
-  0x80102,
-  0x404200,
-  0x80100,
-  0x80101,
-  0x20410,
-  0x18008,
-  0x80104,
-  0x102020,
-  0x240010,
-  0x4402,
-  0x4401,
-  0x4400,
-  0x82800,
-  0x401040,
-  0x10180,
-  0x4404,
-  0x510000,
-  0x88080,
-  0x1a00,
-  0x4408,
-  0x20420,
-  0x40300,
-  0x208040,
-  0x102010,
-  0x240000,
-  0x240001,
-  0x240002,
-  0x4410,
-  0x240004,
-  0x18020,
-  0x420200,
-  0x102008,
-  0x240008,
-  0x20840,
-  0x80120,
-  0x102004,
-  0x5080,
-  0x102002,
-  0x102001,
-  0x102000,
-  0x300,
-  0x301,
-  0x302,
-  0x484000,
-  0x304,
-  0x200018,
-  0x10060,
-  0x22080,
-  0x308,
-  0x200014,
-  0x28800,
-  0x101020,
-  0x200011,
-  0x200010,
-  0x44400,
-  0x200012,
-  0x310,
-  0x20000c,
-  0x142000,
-  0x10c00,
-  0x200009,
-  0x200008,
-  0x409000,
-  0x20000a,
-  0x200005,
-  0x200004,
-  0x800c0,
-  0x200006,
-  0x200001,
-  0x200000,
-  0x200003,
-  0x200002,
-  0x320,
-  0x60400,
-  0x10044,
-  0x101008,
-  0x10042,
-  0xc800,
-  0x10040,
-  0x10041,
-  0x6080,
-  0x101002,
-  0x101001,
-  0x101000,
-  0x4a0000,
-  0x200030,
-  0x10048,
-  0x101004,
-  0x81800,
-  0x402040,
-  0x224000,
-  0x8280,
-  0x100480,
-  0x200028,
-  0x10050,
-  0xc0100,
-  0x58000,
-  0x200024,
-  0x400500,
-  0x101010,
-  0x200021,
-  0x200020,
-  0x2a00,
-  0x200022,
-  0x340,
-  0x100880,
-  0x10024,
-  0x248000,
-  0x10022,
-  0x81400,
-  0x10020,
-  0x10021,
-  0x441000,
-  0x34000,
-  0x80090,
-  0x2600,
-  0x10a000,
-  0x200050,
-  0x10028,
-  0x400900,
-  0xc400,
-  0x402020,
-  0x80088,
-  0x21100,
-  0x60800,
-  0x200048,
-  0x10030,
-  0x104200,
-  0x80082,
-  0x200044,
-  0x80080,
-  0x80081,
-  0x200041,
-  0x200040,
-  0x80084,
-  0x200042,
-  0x10006,
-  0x402010,
-  0x10004,
-  0x10005,
-  0x10002,
-  0x10003,
-  0x10000,
-  0x10001,
-  0x200c00,
-  0x88100,
-  0x1000c,
-  0x101040,
-  0x1000a,
-  0x40280,
-  0x10008,
-  0x10009,
-  0x402001,
-  0x402000,
-  0x10014,
-  0x402002,
-  0x10012,
-  0x402004,
-  0x10010,
-  0x10011,
-  0x120200,
-  0x402008,
-  0x800a0,
-  0x44800,
-  0x5100,
-  0x200060,
-  0x10018,
-  0x28400,
-  0x380,
-  0x100840,
-  0x201400,
-  0x22004,
-  0xc8000,
-  0x22002,
-  0x22001,
-  0x22000,
-  0x6020,
-  0x408400,
-  0x80050,
-  0x50100,
-  0x11800,
-  0x200090,
-  0x500200,
-  0x22008,
-  0x430000,
-  0x45000,
-  0x80048,
-  0x8220,
-  0x100420,
-  0x200088,
-  0x4900,
-  0x22010,
-  0x80042,
-  0x200084,
-  0x80040,
-  0x80041,
-  0x200081,
-  0x200080,
-  0x80044,
-  0x200082,
-  0x6008,
-  0x290000,
-  0x440800,
-  0x8210,
-  0x100410,
-  0x401100,
-  0x100c0,
-  0x22020,
-  0x6000,
-  0x6001,
-  0x6002,
-  0x101080,
-  0x6004,
-  0x40240,
-  0x208100,
-  0x80c00,
-  0x100404,
-  0x8202,
-  0x8201,
-  0x8200,
-  0x100400,
-  0x100401,
-  0x100402,
-  0x8204,
-  0x6010,
-  0x20900,
-  0x80060,
-  0x8208,
-  0x100408,
-  0x2000a0,
-  0x61000,
-  0x414000,
-  0x100801,
-  0x100800,
-  0x80018,
-  0x100802,
-  0x604000,
-  0x100804,
-  0x100a0,
-  0x22040,
-  0x80012,
-  0x100808,
-  0x80010,
-  0x80011,
-  0x20500,
-  0x40220,
-  0x80014,
-  0xd000,
-  0x8000a,
-  0x100810,
-  0x80008,
-  0x80009,
-  0x3200,
-  0x18100,
-  0x8000c,
-  0x440400,
-  0x80002,
-  0x80003,
-  0x80000,
-  0x80001,
-  0x80006,
-  0x2000c0,
-  0x80004,
-  0x80005,
-  0x29000,
-  0x100820,
-  0x10084,
-  0x4500,
-  0x10082,
-  0x40208,
-  0x10080,
-  0x10081,
-  0x6040,
-  0x40204,
-  0x80030,
-  0x620000,
-  0x40201,
-  0x40200,
-  0x10088,
-  0x40202,
-  0x240100,
-  0x402080,
-  0x80028,
-  0x8240,
-  0x100440,
-  0xa4000,
-  0x10090,
-  0x201800,
-  0x80022,
-  0x11400,
-  0x80020,
-  0x80021,
-  0x408800,
-  0x40210,
-  0x80024,
-  0x102100,
-  0x400,
-  0x401,
-  0x402,
-  0x403,
-  0x404,
-  0x405,
-  0x406,
-  0x108200,
-  0x408,
-  0x409,
-  0x40a,
-  0x2140,
-  0x40c,
-  0x4c0000,
-  0x210800,
-  0x1090,
-  0x410,
-  0x411,
-  0x412,
-  0x244000,
-  0x414,
-  0x860,
-  0xa0100,
-  0x1088,
-  0x418,
-  0x38000,
-  0x400220,
-  0x1084,
-  0x106000,
-  0x1082,
-  0x1081,
-  0x1080,
-  0x420,
-  0x421,
-  0x422,
-  0x91000,
-  0x424,
-  0x850,
-  0x42080,
-  0x600100,
-  0x428,
-  0x300080,
-  0x400210,
-  0x48800,
-  0x9100,
-  0x12200,
-  0x180040,
-  0x24400,
-  0x430,
-  0x844,
-  0x400208,
-  0x122000,
-  0x841,
-  0x840,
-  0x1c000,
-  0x842,
-  0x400202,
-  0x84100,
-  0x400200,
-  0x400201,
-  0x260000,
-  0x848,
-  0x400204,
-  0x10a0,
-  0x440,
-  0x441,
-  0x442,
-  0x2108,
-  0x444,
-  0x830,
-  0x405000,
-  0x70000,
-  0x448,
-  0x2102,
-  0x2101,
-  0x2100,
-  0x20280,
-  0x20c000,
-  0x180020,
-  0x2104,
-  0x450,
-  0x824,
-  0x110080,
-  0x488000,
-  0x821,
-  0x820,
-  0x202200,
-  0x822,
-  0x281000,
-  0x140200,
-  0x24800,
-  0x2110,
-  0x410100,
-  0x828,
-  0x48400,
-  0x10c0,
-  0x460,
-  0x814,
-  0x228000,
-  0x4280,
-  0x811,
-  0x810,
-  0x180008,
-  0x812,
-  0x54000,
-  0x421000,
-  0x180004,
-  0x2120,
-  0x180002,
-  0x818,
-  0x180000,
-  0x180001,
-  0x805,
-  0x804,
-  0x41100,
-  0x806,
-  0x801,
-  0x800,
-  0x803,
-  0x802,
-  0xa080,
-  0x80c,
-  0x400240,
-  0x210400,
-  0x809,
-  0x808,
-  0x180010,
-  0x80a,
-  0x480,
-  0x481,
-  0x482,
-  0x420800,
-  0x484,
-  0x14100,
-  0x42020,
-  0x1018,
-  0x488,
-  0x300020,
-  0x8c000,
-  0x1014,
-  0x20240,
-  0x1012,
-  0x1011,
-  0x1010,
-  0x490,
-  0x82200,
-  0x110040,
-  0x100c,
-  0x608000,
-  0x100a,
-  0x1009,
-  0x1008,
-  0x40900,
-  0x1006,
-  0x1005,
-  0x1004,
-  0x1003,
-  0x1002,
-  0x1001,
-  0x1000,
-  0x4a0,
-  0x300008,
-  0x42004,
-  0x4240,
-  0x42002,
-  0xa8000,
-  0x42000,
-  0x42001,
-  0x300001,
-  0x300000,
-  0x30100,
-  0x300002,
-  0x404800,
-  0x300004,
-  0x42008,
-  0x1030,
-  0x25000,
-  0x450000,
-  0x280800,
-  0x8500,
-  0x100300,
-  0x8c0,
-  0x42010,
-  0x1028,
-  0xa040,
-  0x300010,
-  0x400280,
-  0x1024,
-  0x90400,
-  0x1022,
-  0x1021,
-  0x1020,
-  0x4c0,
-  0x49000,
-  0x110010,
-  0x4220,
-  0x20208,
-  0x502000,
-  0x8900,
-  0x280400,
-  0x20204,
-  0x90800,
-  0x640000,
-  0x2180,
-  0x20200,
-  0x20201,
-  0x20202,
-  0x1050,
-  0x110002,
-  0x220100,
-  0x110000,
-  0x110001,
-  0xc4000,
-  0x8a0,
-  0x110004,
-  0x1048,
-  0xa020,
-  0x404400,
-  0x110008,
-  0x1044,
-  0x20210,
-  0x1042,
-  0x1041,
-  0x1040,
-  0x480100,
-  0x4202,
-  0x4201,
-  0x4200,
-  0x211000,
-  0x890,
-  0x42040,
-  0x4204,
-  0xa010,
-  0x300040,
-  0x1c00,
-  0x4208,
-  0x20220,
-  0x40500,
-  0x180080,
-  0x418000,
-  0xa008,
-  0x884,
-  0x110020,
-  0x4210,
-  0x881,
-  0x880,
-  0x420400,
-  0x882,
-  0xa000,
-  0xa001,
-  0xa002,
-  0xe0000,
-  0xa004,
-  0x888,
-  0x204100,
-  0x1060,
-  0x500,
-  0x501,
-  0x502,
-  0x2048,
-  0x504,
-  0x14080,
-  0xa0010,
-  0x600020,
-  0x508,
-  0x2042,
-  0x2041,
-  0x2040,
-  0x9020,
-  0x120800,
-  0x44200,
-  0x2044,
-  0x510,
-  0x501000,
-  0xa0004,
-  0x10a00,
-  0xa0002,
-  0x4a000,
-  0xa0000,
-  0xa0001,
-  0x40880,
-  0x84020,
-  0x308000,
-  0x2050,
-  0x410040,
-  0x200600,
-  0xa0008,
-  0x1180,
-  0x520,
-  0x60200,
-  0x104800,
-  0x600004,
-  0x9008,
-  0x600002,
-  0x600001,
-  0x600000,
-  0x9004,
-  0x84010,
-  0x30080,
-  0x2060,
-  0x9000,
-  0x9001,
-  0x9002,
-  0x600008,
-  0x212000,
-  0x84008,
-  0x41040,
-  0x8480,
-  0x100280,
-  0x940,
-  0xa0020,
-  0x600010,
-  0x84001,
-  0x84000,
-  0x400300,
-  0x84002,
-  0x9010,
-  0x84004,
-  0x2c00,
-  0x150000,
-  0x540,
-  0x200a,
-  0x2009,
-  0x2008,
-  0x340000,
-  0x81200,
-  0x8880,
-  0x200c,
-  0x2003,
-  0x2002,
-  0x2001,
-  0x2000,
-  0x410010,
-  0x2006,
-  0x2005,
-  0x2004,
-  0xc200,
-  0x220080,
-  0x41020,
-  0x2018,
-  0x410008,
-  0x920,
-  0xa0040,
-  0x104400,
-  0x410004,
-  0x2012,
-  0x2011,
-  0x2010,
-  0x410000,
-  0x410001,
-  0x410002,
-  0x2014,
-  0x480080,
-  0x118000,
-  0x41010,
-  0x2028,
-  0x26000,
-  0x910,
-  0x10600,
-  0x600040,
-  0x200a00,
-  0x2022,
-  0x2021,
-  0x2020,
-  0x9040,
-  0x40480,
-  0x180100,
-  0x2024,
-  0x41002,
-  0x904,
-  0x41000,
-  0x41001,
-  0x901,
-  0x900,
-  0x41004,
-  0x902,
-  0x120400,
-  0x84040,
-  0x41008,
-  0x2030,
-  0x410020,
-  0x908,
-  0x204080,
-  0x28200,
-  0x580,
-  0x14004,
-  0x201200,
-  0x1c0000,
-  0x14001,
-  0x14000,
-  0x8840,
-  0x14002,
-  0x40810,
-  0x408200,
-  0x30020,
-  0x20c0,
-  0x282000,
-  0x14008,
-  0x500400,
-  0x1110,
-  0x40808,
-  0x220040,
-  0x406000,
-  0x8420,
-  0x100220,
-  0x14010,
-  0xa0080,
-  0x1108,
-  0x40800,
-  0x40801,
-  0x40802,
-  0x1104,
-  0x40804,
-  0x1102,
-  0x1101,
-  0x1100,
-  0x480040,
-  0x3800,
-  0x30008,
-  0x8410,
-  0x100210,
-  0x14020,
-  0x42100,
-  0x600080,
-  0x30002,
-  0x300100,
-  0x30000,
-  0x30001,
-  0x9080,
-  0x40440,
-  0x30004,
-  0x80a00,
-  0x100204,
-  0x8402,
-  0x8401,
-  0x8400,
-  0x100200,
-  0x100201,
-  0x100202,
-  0x8404,
-  0x40820,
-  0x84080,
-  0x30010,
-  0x8408,
-  0x100208,
-  0x422000,
-  0x204040,
-  0x1120,
-  0x480020,
-  0x220010,
-  0x8804,
-  0x2088,
-  0x8802,
-  0x14040,
-  0x8800,
-  0x8801,
-  0x105000,
-  0x2082,
-  0x2081,
-  0x2080,
-  0x20300,
-  0x40420,
-  0x8808,
-  0x2084,
-  0x220001,
-  0x220000,
-  0x110100,
-  0x220002,
-  0x3400,
-  0x220004,
-  0x8810,
-  0x440200,
-  0x40840,
-  0x220008,
-  0x80600,
-  0x2090,
-  0x410080,
-  0x188000,
-  0x204020,
-  0x1140,
-  0x480000,
-  0x480001,
-  0x480002,
-  0x4300,
-  0x480004,
-  0x40408,
-  0x8820,
-  0x121000,
-  0x480008,
-  0x40404,
-  0x30040,
-  0x20a0,
-  0x40401,
-  0x40400,
-  0x204010,
-  0x40402,
-  0x480010,
-  0x220020,
-  0x41080,
-  0x8440,
-  0x100240,
-  0x980,
-  0x204008,
-  0x92000,
-  0xa100,
-  0x11200,
-  0x204004,
-  0x500800,
-  0x204002,
-  0x40410,
-  0x204000,
-  0x204001,
-  0x600,
-  0x601,
-  0x602,
-  0x108004,
-  0x604,
-  0x108002,
-  0x108001,
-  0x108000,
-  0x608,
-  0x5800,
-  0x400030,
-  0x2a0000,
-  0x200c0,
-  0x12020,
-  0x44100,
-  0x108008,
-  0x610,
-  0x82080,
-  0x400028,
-  0x10900,
-  0x51000,
-  0x424000,
-  0x202040,
-  0x108010,
-  0x400022,
-  0x140040,
-  0x400020,
-  0x400021,
-  0x88800,
-  0x200500,
-  0x400024,
-  0x1280,
-  0x620,
-  0x60100,
-  0x400018,
-  0x40c0,
-  0x284000,
-  0x12008,
-  0x21800,
-  0x108020,
-  0x400012,
-  0x12004,
-  0x400010,
-  0x400011,
-  0x12001,
-  0x12000,
-  0x400014,
-  0x12002,
-  0x40000a,
-  0x209000,
-  0x400008,
-  0x400009,
-  0x100180,
-  0xa40,
-  0x40000c,
-  0xc0400,
-  0x400002,
-  0x400003,
-  0x400000,
-  0x400001,
-  0x400006,
-  0x12010,
-  0x400004,
-  0x400005,
-  0x640,
-  0x610000,
-  0xc0800,
-  0x40a0,
-  0x20088,
-  0x81100,
-  0x202010,
-  0x108040,
-  0x20084,
-  0x140010,
-  0x19000,
-  0x2300,
-  0x20080,
-  0x20081,
-  0x20082,
-  0x400c00,
-  0xc100,
-  0x140008,
-  0x202004,
-  0x21400,
-  0x202002,
-  0xa20,
-  0x202000,
-  0x202001,
-  0x140001,
-  0x140000,
-  0x400060,
-  0x140002,
-  0x20090,
-  0x140004,
-  0x202008,
-  0x94000,
-  0x103000,
-  0x4082,
-  0x4081,
-  0x4080,
-  0x448000,
-  0xa10,
-  0x10500,
-  0x4084,
-  0x200900,
-  0x88400,
-  0x400050,
-  0x4088,
-  0x200a0,
-  0x12040,
-  0x180200,
-  0x241000,
-  0xb0000,
-  0xa04,
-  0x400048,
-  0x4090,
-  0xa01,
-  0xa00,
-  0x202020,
-  0xa02,
-  0x400042,
-  0x140020,
-  0x400040,
-  0x400041,
-  0x5400,
-  0xa08,
-  0x400044,
-  0x28100,
-  0x680,
-  0x82010,
-  0x201100,
-  0x4060,
-  0x20048,
-  0x240800,
-  0x490000,
-  0x108080,
-  0x20044,
-  0x408100,
-  0x102800,
-  0x50400,
-  0x20040,
-  0x20041,
-  0x20042,
-  0x1210,
-  0x82001,
-  0x82000,
-  0x68000,
-  0x82002,
-  0x100120,
-  0x82004,
-  0x4c00,
-  0x1208,
-  0x214000,
-  0x82008,
-  0x4000a0,
-  0x1204,
-  0x20050,
-  0x1202,
-  0x1201,
-  0x1200,
-  0x18800,
-  0x4042,
-  0x4041,
-  0x4040,
-  0x100110,
-  0x401400,
-  0x42200,
-  0x4044,
-  0xc1000,
-  0x300200,
-  0x400090,
-  0x4048,
-  0x20060,
-  0x12080,
-  0x208400,
-  0x80900,
-  0x100104,
-  0x82020,
-  0x400088,
-  0x4050,
-  0x100100,
-  0x100101,
-  0x100102,
-  0x230000,
-  0x400082,
-  0x20c00,
-  0x400080,
-  0x400081,
-  0x100108,
-  0x4c000,
-  0x400084,
-  0x1220,
-  0x2000c,
-  0x4022,
-  0x4021,
-  0x4020,
-  0x20008,
-  0x20009,
-  0x2000a,
-  0x4024,
-  0x20004,
-  0x20005,
-  0x20006,
-  0x4028,
-  0x20000,
-  0x20001,
-  0x20002,
-  0x20003,
-  0x401800,
-  0x82040,
-  0x110200,
-  0x4030,
-  0x20018,
-  0x18400,
-  0x202080,
-  0x440100,
-  0x20014,
-  0x140080,
-  0x80500,
-  0x208800,
-  0x20010,
-  0x20011,
-  0x20012,
-  0x1240,
-  0x4003,
-  0x4002,
-  0x4001,
-  0x4000,
-  0x20028,
-  0x4006,
-  0x4005,
-  0x4004,
-  0x20024,
-  0x400a,
-  0x4009,
-  0x4008,
-  0x20020,
-  0x20021,
-  0x20022,
-  0x400c,
-  0x240400,
-  0x4012,
-  0x4011,
-  0x4010,
-  0x100140,
-  0xa80,
-  0x89000,
-  0x4014,
-  0xa200,
-  0x11100,
-  0x4000c0,
-  0x4018,
-  0x20030,
-  0x680000,
-  0x50800,
-  0x102400,
-  0x700,
-  0x60020,
-  0x201080,
-  0x10810,
-  0x402800,
-  0x81040,
-  0x44008,
-  0x108100,
-  0x190000,
-  0x408080,
-  0x44004,
-  0x2240,
-  0x44002,
-  0x200410,
-  0x44000,
-  0x44001,
-  0xc040,
-  0x10802,
-  0x10801,
-  0x10800,
-  0x1000a0,
-  0x200408,
-  0xa0200,
-  0x10804,
-  0x23000,
-  0x200404,
-  0x400120,
-  0x10808,
-  0x200401,
-  0x200400,
-  0x44010,
-  0x200402,
-  0x60001,
-  0x60000,
-  0x8a000,
-  0x60002,
-  0x100090,
-  0x60004,
-  0x10440,
-  0x600200,
-  0x200840,
-  0x60008,
-  0x400110,
-  0x101400,
-  0x9200,
-  0x12100,
-  0x44020,
-  0x80880,
-  0x100084,
-  0x60010,
-  0x400108,
-  0x10820,
-  0x100080,
-  0x100081,
-  0x100082,
-  0x7000,
-  0x400102,
-  0x84200,
-  0x400100,
-  0x400101,
-  0x100088,
-  0x200420,
-  0x400104,
-  0x28040,
-  0xc010,
-  0x81004,
-  0x520000,
-  0x2208,
-  0x81001,
-  0x81000,
-  0x10420,
-  0x81002,
-  0x200820,
-  0x2202,
-  0x2201,
-  0x2200,
-  0x20180,
-  0x81008,
-  0x44040,
-  0x2204,
-  0xc000,
-  0xc001,
-  0xc002,
-  0x10840,
-  0xc004,
-  0x81010,
-  0x202100,
-  0x440080,
-  0xc008,
-  0x140100,
-  0x80480,
-  0x2210,
-  0x410200,
-  0x200440,
-  0x101800,
-  0x28020,
-  0x200808,
-  0x60040,
-  0x10404,
-  0x4180,
-  0x10402,
-  0x81020,
-  0x10400,
-  0x10401,
-  0x200800,
-  0x200801,
-  0x200802,
-  0x2220,
-  0x200804,
-  0x504000,
-  0x10408,
-  0x28010,
-  0xc020,
-  0x402400,
-  0x41200,
-  0x380000,
-  0x1000c0,
-  0xb00,
-  0x10410,
-  0x28008,
-  0x200810,
-  0x11080,
-  0x400140,
-  0x28004,
-  0xc2000,
-  0x28002,
-  0x28001,
-  0x28000,
-  0x201002,
-  0x408008,
-  0x201000,
-  0x201001,
-  0x100030,
-  0x14200,
-  0x201004,
-  0x22400,
-  0x408001,
-  0x408000,
-  0x201008,
-  0x408002,
-  0x20140,
-  0x408004,
-  0x44080,
-  0x80820,
-  0x100024,
-  0x82100,
-  0x201010,
-  0x10880,
-  0x100020,
-  0x100021,
-  0x100022,
-  0x440040,
-  0x40a00,
-  0x408010,
-  0x80440,
-  0x124000,
-  0x100028,
-  0x200480,
-  0x1a000,
-  0x1300,
-  0x100014,
-  0x60080,
-  0x201020,
-  0x4140,
-  0x100010,
-  0x100011,
-  0x100012,
-  0x80808,
-  0x6400,
-  0x408020,
-  0x30200,
-  0x80804,
-  0x100018,
-  0x80802,
-  0x80801,
-  0x80800,
-  0x100004,
-  0x100005,
-  0x100006,
-  0x8600,
-  0x100000,
-  0x100001,
-  0x100002,
-  0x100003,
-  0x10000c,
-  0x11040,
-  0x400180,
-  0x242000,
-  0x100008,
-  0x100009,
-  0x10000a,
-  0x80810,
-  0x52000,
-  0x100c00,
-  0x201040,
-  0x4120,
-  0x20108,
-  0x81080,
-  0x8a00,
-  0x440010,
-  0x20104,
-  0x408040,
-  0x80410,
-  0x2280,
-  0x20100,
-  0x20101,
-  0x20102,
-  0x310000,
-  0xc080,
-  0x220200,
-  0x80408,
-  0x440004,
-  0x100060,
-  0x440002,
-  0x440001,
-  0x440000,
-  0x80402,
-  0x11020,
-  0x80400,
-  0x80401,
-  0x20110,
-  0x6800,
-  0x80404,
-  0x440008,
-  0x480200,
-  0x4102,
-  0x4101,
-  0x4100,
-  0x100050,
-  0x20a000,
-  0x10480,
-  0x4104,
-  0x200880,
-  0x11010,
-  0x148000,
-  0x4108,
-  0x20120,
-  0x40600,
-  0x403000,
-  0x80840,
-  0x100044,
-  0x11008,
-  0x22800,
-  0x4110,
-  0x100040,
-  0x100041,
-  0x100042,
-  0x440020,
-  0x11001,
-  0x11000,
-  0x80420,
-  0x11002,
-  0x100048,
-  0x11004,
-  0x204200,
-  0x28080
+  0x59a2,
+  0x5e04,
+  0x2cd,
+  0x59a1,
+  0x54c5,
+  0x45ea,
+  0x59a3,
+  0x49cb,
+  0x5e01,
+  0x2f0,
+  0x59a4,
+  0x5e02,
+  0x4927,
+  0x5e03,
+  0x4de8,
+  0x5186,
+  0x54c3,
+  0x51c9,
+  0x59a5,
+  0x4588,
+  0x2a6,
+  0x54c1,
+  0x54c2,
+  0x5e67,
+  0x4d8a,
+  0x5e05,
+  0x5167,
+  0x564f,
+  0x54c4,
+  0x5968,
+  0x460e,
+  0x3549,
+  0x54a3,
+  0x4e48,
+  0x59a6,
+  0x3d27,
+  0x2a5,
+  0x54a1,
+  0x54a2,
+  0x5184,
+  0x3dcb,
+  0x5e06,
+  0x4a2a,
+  0x5183,
+  0x54a4,
+  0x5182,
+  0x5181,
+  0x28c,
+  0x2a3,
+  0x5461,
+  0x5462,
+  0x416a,
+  0x15,
+  0x2a1,
+  0x2a2,
+  0x5441,
+  0x5483,
+  0x45a7,
+  0x5d28,
+  0x5a6e,
+  0x2a4,
+  0x5481,
+  0x5482,
+  0x5185,
+  0x4e2e,
+  0x558b,
+  0x59a7,
+  0x3d26,
+  0x4924,
+  0x51a8,
+  0x418a,
+  0x5e65,
+  0x4923,
+  0x5e07,
+  0x5165,
+  0x3948,
+  0x249,
+  0x4921,
+  0x4922,
+  0x5ab1,
+  0x41e8,
+  0x5a4a,
+  0x5164,
+  0x5e63,
+  0x54e6,
+  0x5e62,
+  0x5e61,
+  0x2f3,
+  0x5162,
+  0x45a6,
+  0x28b,
+  0x5161,
+  0x4925,
+  0x3dcc,
+  0x5163,
+  0x5e64,
+  0x5e8a,
+  0x3d22,
+  0x3d21,
+  0x1e9,
+  0x54e5,
+  0x5a0e,
+  0x4568,
+  0x3d23,
+  0x5988,
+  0x45a5,
+  0x5670,
+  0x3d24,
+  0x4926,
+  0x4d6a,
+  0x5dcd,
+  0x5187,
+  0x54e3,
+  0x45a4,
+  0x49cc,
+  0x3d25,
+  0x2a7,
+  0x54e1,
+  0x54e2,
+  0x5e66,
+  0x45a1,
+  0x22d,
+  0x5166,
+  0x45a2,
+  0x54e4,
+  0x45a3,
+  0x59ea,
+  0x4a08
 };
@@ -1,4100 +0,0 @@
-/* Generated by golay23.c -DGOLAY23_MAKETABLE */
-
-static const int encoding_table[]={
-  0x0,
-  0xc75,
-  0x149f,
-  0x18ea,
-  0x254b,
-  0x293e,
-  0x31d4,
-  0x3da1,
-  0x46e3,
-  0x4a96,
-  0x527c,
-  0x5e09,
-  0x63a8,
-  0x6fdd,
-  0x7737,
-  0x7b42,
-  0x81b3,
-  0x8dc6,
-  0x952c,
-  0x9959,
-  0xa4f8,
-  0xa88d,
-  0xb067,
-  0xbc12,
-  0xc750,
-  0xcb25,
-  0xd3cf,
-  0xdfba,
-  0xe21b,
-  0xee6e,
-  0xf684,
-  0xfaf1,
-  0x10366,
-  0x10f13,
-  0x117f9,
-  0x11b8c,
-  0x1262d,
-  0x12a58,
-  0x132b2,
-  0x13ec7,
-  0x14585,
-  0x149f0,
-  0x1511a,
-  0x15d6f,
-  0x160ce,
-  0x16cbb,
-  0x17451,
-  0x17824,
-  0x182d5,
-  0x18ea0,
-  0x1964a,
-  0x19a3f,
-  0x1a79e,
-  0x1abeb,
-  0x1b301,
-  0x1bf74,
-  0x1c436,
-  0x1c843,
-  0x1d0a9,
-  0x1dcdc,
-  0x1e17d,
-  0x1ed08,
-  0x1f5e2,
-  0x1f997,
-  0x206cc,
-  0x20ab9,
-  0x21253,
-  0x21e26,
-  0x22387,
-  0x22ff2,
-  0x23718,
-  0x23b6d,
-  0x2402f,
-  0x24c5a,
-  0x254b0,
-  0x258c5,
-  0x26564,
-  0x26911,
-  0x271fb,
-  0x27d8e,
-  0x2877f,
-  0x28b0a,
-  0x293e0,
-  0x29f95,
-  0x2a234,
-  0x2ae41,
-  0x2b6ab,
-  0x2bade,
-  0x2c19c,
-  0x2cde9,
-  0x2d503,
-  0x2d976,
-  0x2e4d7,
-  0x2e8a2,
-  0x2f048,
-  0x2fc3d,
-  0x305aa,
-  0x309df,
-  0x31135,
-  0x31d40,
-  0x320e1,
-  0x32c94,
-  0x3347e,
-  0x3380b,
-  0x34349,
-  0x34f3c,
-  0x357d6,
-  0x35ba3,
-  0x36602,
-  0x36a77,
-  0x3729d,
-  0x37ee8,
-  0x38419,
-  0x3886c,
-  0x39086,
-  0x39cf3,
-  0x3a152,
-  0x3ad27,
-  0x3b5cd,
-  0x3b9b8,
-  0x3c2fa,
-  0x3ce8f,
-  0x3d665,
-  0x3da10,
-  0x3e7b1,
-  0x3ebc4,
-  0x3f32e,
-  0x3ff5b,
-  0x401ed,
-  0x40d98,
-  0x41572,
-  0x41907,
-  0x424a6,
-  0x428d3,
-  0x43039,
-  0x43c4c,
-  0x4470e,
-  0x44b7b,
-  0x45391,
-  0x45fe4,
-  0x46245,
-  0x46e30,
-  0x476da,
-  0x47aaf,
-  0x4805e,
-  0x48c2b,
-  0x494c1,
-  0x498b4,
-  0x4a515,
-  0x4a960,
-  0x4b18a,
-  0x4bdff,
-  0x4c6bd,
-  0x4cac8,
-  0x4d222,
-  0x4de57,
-  0x4e3f6,
-  0x4ef83,
-  0x4f769,
-  0x4fb1c,
-  0x5028b,
-  0x50efe,
-  0x51614,
-  0x51a61,
-  0x527c0,
-  0x52bb5,
-  0x5335f,
-  0x53f2a,
-  0x54468,
-  0x5481d,
-  0x550f7,
-  0x55c82,
-  0x56123,
-  0x56d56,
-  0x575bc,
-  0x579c9,
-  0x58338,
-  0x58f4d,
-  0x597a7,
-  0x59bd2,
-  0x5a673,
-  0x5aa06,
-  0x5b2ec,
-  0x5be99,
-  0x5c5db,
-  0x5c9ae,
-  0x5d144,
-  0x5dd31,
-  0x5e090,
-  0x5ece5,
-  0x5f40f,
-  0x5f87a,
-  0x60721,
-  0x60b54,
-  0x613be,
-  0x61fcb,
-  0x6226a,
-  0x62e1f,
-  0x636f5,
-  0x63a80,
-  0x641c2,
-  0x64db7,
-  0x6555d,
-  0x65928,
-  0x66489,
-  0x668fc,
-  0x67016,
-  0x67c63,
-  0x68692,
-  0x68ae7,
-  0x6920d,
-  0x69e78,
-  0x6a3d9,
-  0x6afac,
-  0x6b746,
-  0x6bb33,
-  0x6c071,
-  0x6cc04,
-  0x6d4ee,
-  0x6d89b,
-  0x6e53a,
-  0x6e94f,
-  0x6f1a5,
-  0x6fdd0,
-  0x70447,
-  0x70832,
-  0x710d8,
-  0x71cad,
-  0x7210c,
-  0x72d79,
-  0x73593,
-  0x739e6,
-  0x742a4,
-  0x74ed1,
-  0x7563b,
-  0x75a4e,
-  0x767ef,
-  0x76b9a,
-  0x77370,
-  0x77f05,
-  0x785f4,
-  0x78981,
-  0x7916b,
-  0x79d1e,
-  0x7a0bf,
-  0x7acca,
-  0x7b420,
-  0x7b855,
-  0x7c317,
-  0x7cf62,
-  0x7d788,
-  0x7dbfd,
-  0x7e65c,
-  0x7ea29,
-  0x7f2c3,
-  0x7feb6,
-  0x803da,
-  0x80faf,
-  0x81745,
-  0x81b30,
-  0x82691,
-  0x82ae4,
-  0x8320e,
-  0x83e7b,
-  0x84539,
-  0x8494c,
-  0x851a6,
-  0x85dd3,
-  0x86072,
-  0x86c07,
-  0x874ed,
-  0x87898,
-  0x88269,
-  0x88e1c,
-  0x896f6,
-  0x89a83,
-  0x8a722,
-  0x8ab57,
-  0x8b3bd,
-  0x8bfc8,
-  0x8c48a,
-  0x8c8ff,
-  0x8d015,
-  0x8dc60,
-  0x8e1c1,
-  0x8edb4,
-  0x8f55e,
-  0x8f92b,
-  0x900bc,
-  0x90cc9,
-  0x91423,
-  0x91856,
-  0x925f7,
-  0x92982,
-  0x93168,
-  0x93d1d,
-  0x9465f,
-  0x94a2a,
-  0x952c0,
-  0x95eb5,
-  0x96314,
-  0x96f61,
-  0x9778b,
-  0x97bfe,
-  0x9810f,
-  0x98d7a,
-  0x99590,
-  0x999e5,
-  0x9a444,
-  0x9a831,
-  0x9b0db,
-  0x9bcae,
-  0x9c7ec,
-  0x9cb99,
-  0x9d373,
-  0x9df06,
-  0x9e2a7,
-  0x9eed2,
-  0x9f638,
-  0x9fa4d,
-  0xa0516,
-  0xa0963,
-  0xa1189,
-  0xa1dfc,
-  0xa205d,
-  0xa2c28,
-  0xa34c2,
-  0xa38b7,
-  0xa43f5,
-  0xa4f80,
-  0xa576a,
-  0xa5b1f,
-  0xa66be,
-  0xa6acb,
-  0xa7221,
-  0xa7e54,
-  0xa84a5,
-  0xa88d0,
-  0xa903a,
-  0xa9c4f,
-  0xaa1ee,
-  0xaad9b,
-  0xab571,
-  0xab904,
-  0xac246,
-  0xace33,
-  0xad6d9,
-  0xadaac,
-  0xae70d,
-  0xaeb78,
-  0xaf392,
-  0xaffe7,
-  0xb0670,
-  0xb0a05,
-  0xb12ef,
-  0xb1e9a,
-  0xb233b,
-  0xb2f4e,
-  0xb37a4,
-  0xb3bd1,
-  0xb4093,
-  0xb4ce6,
-  0xb540c,
-  0xb5879,
-  0xb65d8,
-  0xb69ad,
-  0xb7147,
-  0xb7d32,
-  0xb87c3,
-  0xb8bb6,
-  0xb935c,
-  0xb9f29,
-  0xba288,
-  0xbaefd,
-  0xbb617,
-  0xbba62,
-  0xbc120,
-  0xbcd55,
-  0xbd5bf,
-  0xbd9ca,
-  0xbe46b,
-  0xbe81e,
-  0xbf0f4,
-  0xbfc81,
-  0xc0237,
-  0xc0e42,
-  0xc16a8,
-  0xc1add,
-  0xc277c,
-  0xc2b09,
-  0xc33e3,
-  0xc3f96,
-  0xc44d4,
-  0xc48a1,
-  0xc504b,
-  0xc5c3e,
-  0xc619f,
-  0xc6dea,
-  0xc7500,
-  0xc7975,
-  0xc8384,
-  0xc8ff1,
-  0xc971b,
-  0xc9b6e,
-  0xca6cf,
-  0xcaaba,
-  0xcb250,
-  0xcbe25,
-  0xcc567,
-  0xcc912,
-  0xcd1f8,
-  0xcdd8d,
-  0xce02c,
-  0xcec59,
-  0xcf4b3,
-  0xcf8c6,
-  0xd0151,
-  0xd0d24,
-  0xd15ce,
-  0xd19bb,
-  0xd241a,
-  0xd286f,
-  0xd3085,
-  0xd3cf0,
-  0xd47b2,
-  0xd4bc7,
-  0xd532d,
-  0xd5f58,
-  0xd62f9,
-  0xd6e8c,
-  0xd7666,
-  0xd7a13,
-  0xd80e2,
-  0xd8c97,
-  0xd947d,
-  0xd9808,
-  0xda5a9,
-  0xda9dc,
-  0xdb136,
-  0xdbd43,
-  0xdc601,
-  0xdca74,
-  0xdd29e,
-  0xddeeb,
-  0xde34a,
-  0xdef3f,
-  0xdf7d5,
-  0xdfba0,
-  0xe04fb,
-  0xe088e,
-  0xe1064,
-  0xe1c11,
-  0xe21b0,
-  0xe2dc5,
-  0xe352f,
-  0xe395a,
-  0xe4218,
-  0xe4e6d,
-  0xe5687,
-  0xe5af2,
-  0xe6753,
-  0xe6b26,
-  0xe73cc,
-  0xe7fb9,
-  0xe8548,
-  0xe893d,
-  0xe91d7,
-  0xe9da2,
-  0xea003,
-  0xeac76,
-  0xeb49c,
-  0xeb8e9,
-  0xec3ab,
-  0xecfde,
-  0xed734,
-  0xedb41,
-  0xee6e0,
-  0xeea95,
-  0xef27f,
-  0xefe0a,
-  0xf079d,
-  0xf0be8,
-  0xf1302,
-  0xf1f77,
-  0xf22d6,
-  0xf2ea3,
-  0xf3649,
-  0xf3a3c,
-  0xf417e,
-  0xf4d0b,
-  0xf55e1,
-  0xf5994,
-  0xf6435,
-  0xf6840,
-  0xf70aa,
-  0xf7cdf,
-  0xf862e,
-  0xf8a5b,
-  0xf92b1,
-  0xf9ec4,
-  0xfa365,
-  0xfaf10,
-  0xfb7fa,
-  0xfbb8f,
-  0xfc0cd,
-  0xfccb8,
-  0xfd452,
-  0xfd827,
-  0xfe586,
-  0xfe9f3,
-  0xff119,
-  0xffd6c,
-  0x1007b4,
-  0x100bc1,
-  0x10132b,
-  0x101f5e,
-  0x1022ff,
-  0x102e8a,
-  0x103660,
-  0x103a15,
-  0x104157,
-  0x104d22,
-  0x1055c8,
-  0x1059bd,
-  0x10641c,
-  0x106869,
-  0x107083,
-  0x107cf6,
-  0x108607,
-  0x108a72,
-  0x109298,
-  0x109eed,
-  0x10a34c,
-  0x10af39,
-  0x10b7d3,
-  0x10bba6,
-  0x10c0e4,
-  0x10cc91,
-  0x10d47b,
-  0x10d80e,
-  0x10e5af,
-  0x10e9da,
-  0x10f130,
-  0x10fd45,
-  0x1104d2,
-  0x1108a7,
-  0x11104d,
-  0x111c38,
-  0x112199,
-  0x112dec,
-  0x113506,
-  0x113973,
-  0x114231,
-  0x114e44,
-  0x1156ae,
-  0x115adb,
-  0x11677a,
-  0x116b0f,
-  0x1173e5,
-  0x117f90,
-  0x118561,
-  0x118914,
-  0x1191fe,
-  0x119d8b,
-  0x11a02a,
-  0x11ac5f,
-  0x11b4b5,
-  0x11b8c0,
-  0x11c382,
-  0x11cff7,
-  0x11d71d,
-  0x11db68,
-  0x11e6c9,
-  0x11eabc,
-  0x11f256,
-  0x11fe23,
-  0x120178,
-  0x120d0d,
-  0x1215e7,
-  0x121992,
-  0x122433,
-  0x122846,
-  0x1230ac,
-  0x123cd9,
-  0x12479b,
-  0x124bee,
-  0x125304,
-  0x125f71,
-  0x1262d0,
-  0x126ea5,
-  0x12764f,
-  0x127a3a,
-  0x1280cb,
-  0x128cbe,
-  0x129454,
-  0x129821,
-  0x12a580,
-  0x12a9f5,
-  0x12b11f,
-  0x12bd6a,
-  0x12c628,
-  0x12ca5d,
-  0x12d2b7,
-  0x12dec2,
-  0x12e363,
-  0x12ef16,
-  0x12f7fc,
-  0x12fb89,
-  0x13021e,
-  0x130e6b,
-  0x131681,
-  0x131af4,
-  0x132755,
-  0x132b20,
-  0x1333ca,
-  0x133fbf,
-  0x1344fd,
-  0x134888,
-  0x135062,
-  0x135c17,
-  0x1361b6,
-  0x136dc3,
-  0x137529,
-  0x13795c,
-  0x1383ad,
-  0x138fd8,
-  0x139732,
-  0x139b47,
-  0x13a6e6,
-  0x13aa93,
-  0x13b279,
-  0x13be0c,
-  0x13c54e,
-  0x13c93b,
-  0x13d1d1,
-  0x13dda4,
-  0x13e005,
-  0x13ec70,
-  0x13f49a,
-  0x13f8ef,
-  0x140659,
-  0x140a2c,
-  0x1412c6,
-  0x141eb3,
-  0x142312,
-  0x142f67,
-  0x14378d,
-  0x143bf8,
-  0x1440ba,
-  0x144ccf,
-  0x145425,
-  0x145850,
-  0x1465f1,
-  0x146984,
-  0x14716e,
-  0x147d1b,
-  0x1487ea,
-  0x148b9f,
-  0x149375,
-  0x149f00,
-  0x14a2a1,
-  0x14aed4,
-  0x14b63e,
-  0x14ba4b,
-  0x14c109,
-  0x14cd7c,
-  0x14d596,
-  0x14d9e3,
-  0x14e442,
-  0x14e837,
-  0x14f0dd,
-  0x14fca8,
-  0x15053f,
-  0x15094a,
-  0x1511a0,
-  0x151dd5,
-  0x152074,
-  0x152c01,
-  0x1534eb,
-  0x15389e,
-  0x1543dc,
-  0x154fa9,
-  0x155743,
-  0x155b36,
-  0x156697,
-  0x156ae2,
-  0x157208,
-  0x157e7d,
-  0x15848c,
-  0x1588f9,
-  0x159013,
-  0x159c66,
-  0x15a1c7,
-  0x15adb2,
-  0x15b558,
-  0x15b92d,
-  0x15c26f,
-  0x15ce1a,
-  0x15d6f0,
-  0x15da85,
-  0x15e724,
-  0x15eb51,
-  0x15f3bb,
-  0x15ffce,
-  0x160095,
-  0x160ce0,
-  0x16140a,
-  0x16187f,
-  0x1625de,
-  0x1629ab,
-  0x163141,
-  0x163d34,
-  0x164676,
-  0x164a03,
-  0x1652e9,
-  0x165e9c,
-  0x16633d,
-  0x166f48,
-  0x1677a2,
-  0x167bd7,
-  0x168126,
-  0x168d53,
-  0x1695b9,
-  0x1699cc,
-  0x16a46d,
-  0x16a818,
-  0x16b0f2,
-  0x16bc87,
-  0x16c7c5,
-  0x16cbb0,
-  0x16d35a,
-  0x16df2f,
-  0x16e28e,
-  0x16eefb,
-  0x16f611,
-  0x16fa64,
-  0x1703f3,
-  0x170f86,
-  0x17176c,
-  0x171b19,
-  0x1726b8,
-  0x172acd,
-  0x173227,
-  0x173e52,
-  0x174510,
-  0x174965,
-  0x17518f,
-  0x175dfa,
-  0x17605b,
-  0x176c2e,
-  0x1774c4,
-  0x1778b1,
-  0x178240,
-  0x178e35,
-  0x1796df,
-  0x179aaa,
-  0x17a70b,
-  0x17ab7e,
-  0x17b394,
-  0x17bfe1,
-  0x17c4a3,
-  0x17c8d6,
-  0x17d03c,
-  0x17dc49,
-  0x17e1e8,
-  0x17ed9d,
-  0x17f577,
-  0x17f902,
-  0x18046e,
-  0x18081b,
-  0x1810f1,
-  0x181c84,
-  0x182125,
-  0x182d50,
-  0x1835ba,
-  0x1839cf,
-  0x18428d,
-  0x184ef8,
-  0x185612,
-  0x185a67,
-  0x1867c6,
-  0x186bb3,
-  0x187359,
-  0x187f2c,
-  0x1885dd,
-  0x1889a8,
-  0x189142,
-  0x189d37,
-  0x18a096,
-  0x18ace3,
-  0x18b409,
-  0x18b87c,
-  0x18c33e,
-  0x18cf4b,
-  0x18d7a1,
-  0x18dbd4,
-  0x18e675,
-  0x18ea00,
-  0x18f2ea,
-  0x18fe9f,
-  0x190708,
-  0x190b7d,
-  0x191397,
-  0x191fe2,
-  0x192243,
-  0x192e36,
-  0x1936dc,
-  0x193aa9,
-  0x1941eb,
-  0x194d9e,
-  0x195574,
-  0x195901,
-  0x1964a0,
-  0x1968d5,
-  0x19703f,
-  0x197c4a,
-  0x1986bb,
-  0x198ace,
-  0x199224,
-  0x199e51,
-  0x19a3f0,
-  0x19af85,
-  0x19b76f,
-  0x19bb1a,
-  0x19c058,
-  0x19cc2d,
-  0x19d4c7,
-  0x19d8b2,
-  0x19e513,
-  0x19e966,
-  0x19f18c,
-  0x19fdf9,
-  0x1a02a2,
-  0x1a0ed7,
-  0x1a163d,
-  0x1a1a48,
-  0x1a27e9,
-  0x1a2b9c,
-  0x1a3376,
-  0x1a3f03,
-  0x1a4441,
-  0x1a4834,
-  0x1a50de,
-  0x1a5cab,
-  0x1a610a,
-  0x1a6d7f,
-  0x1a7595,
-  0x1a79e0,
-  0x1a8311,
-  0x1a8f64,
-  0x1a978e,
-  0x1a9bfb,
-  0x1aa65a,
-  0x1aaa2f,
-  0x1ab2c5,
-  0x1abeb0,
-  0x1ac5f2,
-  0x1ac987,
-  0x1ad16d,
-  0x1add18,
-  0x1ae0b9,
-  0x1aeccc,
-  0x1af426,
-  0x1af853,
-  0x1b01c4,
-  0x1b0db1,
-  0x1b155b,
-  0x1b192e,
-  0x1b248f,
-  0x1b28fa,
-  0x1b3010,
-  0x1b3c65,
-  0x1b4727,
-  0x1b4b52,
-  0x1b53b8,
-  0x1b5fcd,
-  0x1b626c,
-  0x1b6e19,
-  0x1b76f3,
-  0x1b7a86,
-  0x1b8077,
-  0x1b8c02,
-  0x1b94e8,
-  0x1b989d,
-  0x1ba53c,
-  0x1ba949,
-  0x1bb1a3,
-  0x1bbdd6,
-  0x1bc694,
-  0x1bcae1,
-  0x1bd20b,
-  0x1bde7e,
-  0x1be3df,
-  0x1befaa,
-  0x1bf740,
-  0x1bfb35,
-  0x1c0583,
-  0x1c09f6,
-  0x1c111c,
-  0x1c1d69,
-  0x1c20c8,
-  0x1c2cbd,
-  0x1c3457,
-  0x1c3822,
-  0x1c4360,
-  0x1c4f15,
-  0x1c57ff,
-  0x1c5b8a,
-  0x1c662b,
-  0x1c6a5e,
-  0x1c72b4,
-  0x1c7ec1,
-  0x1c8430,
-  0x1c8845,
-  0x1c90af,
-  0x1c9cda,
-  0x1ca17b,
-  0x1cad0e,
-  0x1cb5e4,
-  0x1cb991,
-  0x1cc2d3,
-  0x1ccea6,
-  0x1cd64c,
-  0x1cda39,
-  0x1ce798,
-  0x1cebed,
-  0x1cf307,
-  0x1cff72,
-  0x1d06e5,
-  0x1d0a90,
-  0x1d127a,
-  0x1d1e0f,
-  0x1d23ae,
-  0x1d2fdb,
-  0x1d3731,
-  0x1d3b44,
-  0x1d4006,
-  0x1d4c73,
-  0x1d5499,
-  0x1d58ec,
-  0x1d654d,
-  0x1d6938,
-  0x1d71d2,
-  0x1d7da7,
-  0x1d8756,
-  0x1d8b23,
-  0x1d93c9,
-  0x1d9fbc,
-  0x1da21d,
-  0x1dae68,
-  0x1db682,
-  0x1dbaf7,
-  0x1dc1b5,
-  0x1dcdc0,
-  0x1dd52a,
-  0x1dd95f,
-  0x1de4fe,
-  0x1de88b,
-  0x1df061,
-  0x1dfc14,
-  0x1e034f,
-  0x1e0f3a,
-  0x1e17d0,
-  0x1e1ba5,
-  0x1e2604,
-  0x1e2a71,
-  0x1e329b,
-  0x1e3eee,
-  0x1e45ac,
-  0x1e49d9,
-  0x1e5133,
-  0x1e5d46,
-  0x1e60e7,
-  0x1e6c92,
-  0x1e7478,
-  0x1e780d,
-  0x1e82fc,
-  0x1e8e89,
-  0x1e9663,
-  0x1e9a16,
-  0x1ea7b7,
-  0x1eabc2,
-  0x1eb328,
-  0x1ebf5d,
-  0x1ec41f,
-  0x1ec86a,
-  0x1ed080,
-  0x1edcf5,
-  0x1ee154,
-  0x1eed21,
-  0x1ef5cb,
-  0x1ef9be,
-  0x1f0029,
-  0x1f0c5c,
-  0x1f14b6,
-  0x1f18c3,
-  0x1f2562,
-  0x1f2917,
-  0x1f31fd,
-  0x1f3d88,
-  0x1f46ca,
-  0x1f4abf,
-  0x1f5255,
-  0x1f5e20,
-  0x1f6381,
-  0x1f6ff4,
-  0x1f771e,
-  0x1f7b6b,
-  0x1f819a,
-  0x1f8def,
-  0x1f9505,
-  0x1f9970,
-  0x1fa4d1,
-  0x1fa8a4,
-  0x1fb04e,
-  0x1fbc3b,
-  0x1fc779,
-  0x1fcb0c,
-  0x1fd3e6,
-  0x1fdf93,
-  0x1fe232,
-  0x1fee47,
-  0x1ff6ad,
-  0x1ffad8,
-  0x20031d,
-  0x200f68,
-  0x201782,
-  0x201bf7,
-  0x202656,
-  0x202a23,
-  0x2032c9,
-  0x203ebc,
-  0x2045fe,
-  0x20498b,
-  0x205161,
-  0x205d14,
-  0x2060b5,
-  0x206cc0,
-  0x20742a,
-  0x20785f,
-  0x2082ae,
-  0x208edb,
-  0x209631,
-  0x209a44,
-  0x20a7e5,
-  0x20ab90,
-  0x20b37a,
-  0x20bf0f,
-  0x20c44d,
-  0x20c838,
-  0x20d0d2,
-  0x20dca7,
-  0x20e106,
-  0x20ed73,
-  0x20f599,
-  0x20f9ec,
-  0x21007b,
-  0x210c0e,
-  0x2114e4,
-  0x211891,
-  0x212530,
-  0x212945,
-  0x2131af,
-  0x213dda,
-  0x214698,
-  0x214aed,
-  0x215207,
-  0x215e72,
-  0x2163d3,
-  0x216fa6,
-  0x21774c,
-  0x217b39,
-  0x2181c8,
-  0x218dbd,
-  0x219557,
-  0x219922,
-  0x21a483,
-  0x21a8f6,
-  0x21b01c,
-  0x21bc69,
-  0x21c72b,
-  0x21cb5e,
-  0x21d3b4,
-  0x21dfc1,
-  0x21e260,
-  0x21ee15,
-  0x21f6ff,
-  0x21fa8a,
-  0x2205d1,
-  0x2209a4,
-  0x22114e,
-  0x221d3b,
-  0x22209a,
-  0x222cef,
-  0x223405,
-  0x223870,
-  0x224332,
-  0x224f47,
-  0x2257ad,
-  0x225bd8,
-  0x226679,
-  0x226a0c,
-  0x2272e6,
-  0x227e93,
-  0x228462,
-  0x228817,
-  0x2290fd,
-  0x229c88,
-  0x22a129,
-  0x22ad5c,
-  0x22b5b6,
-  0x22b9c3,
-  0x22c281,
-  0x22cef4,
-  0x22d61e,
-  0x22da6b,
-  0x22e7ca,
-  0x22ebbf,
-  0x22f355,
-  0x22ff20,
-  0x2306b7,
-  0x230ac2,
-  0x231228,
-  0x231e5d,
-  0x2323fc,
-  0x232f89,
-  0x233763,
-  0x233b16,
-  0x234054,
-  0x234c21,
-  0x2354cb,
-  0x2358be,
-  0x23651f,
-  0x23696a,
-  0x237180,
-  0x237df5,
-  0x238704,
-  0x238b71,
-  0x23939b,
-  0x239fee,
-  0x23a24f,
-  0x23ae3a,
-  0x23b6d0,
-  0x23baa5,
-  0x23c1e7,
-  0x23cd92,
-  0x23d578,
-  0x23d90d,
-  0x23e4ac,
-  0x23e8d9,
-  0x23f033,
-  0x23fc46,
-  0x2402f0,
-  0x240e85,
-  0x24166f,
-  0x241a1a,
-  0x2427bb,
-  0x242bce,
-  0x243324,
-  0x243f51,
-  0x244413,
-  0x244866,
-  0x24508c,
-  0x245cf9,
-  0x246158,
-  0x246d2d,
-  0x2475c7,
-  0x2479b2,
-  0x248343,
-  0x248f36,
-  0x2497dc,
-  0x249ba9,
-  0x24a608,
-  0x24aa7d,
-  0x24b297,
-  0x24bee2,
-  0x24c5a0,
-  0x24c9d5,
-  0x24d13f,
-  0x24dd4a,
-  0x24e0eb,
-  0x24ec9e,
-  0x24f474,
-  0x24f801,
-  0x250196,
-  0x250de3,
-  0x251509,
-  0x25197c,
-  0x2524dd,
-  0x2528a8,
-  0x253042,
-  0x253c37,
-  0x254775,
-  0x254b00,
-  0x2553ea,
-  0x255f9f,
-  0x25623e,
-  0x256e4b,
-  0x2576a1,
-  0x257ad4,
-  0x258025,
-  0x258c50,
-  0x2594ba,
-  0x2598cf,
-  0x25a56e,
-  0x25a91b,
-  0x25b1f1,
-  0x25bd84,
-  0x25c6c6,
-  0x25cab3,
-  0x25d259,
-  0x25de2c,
-  0x25e38d,
-  0x25eff8,
-  0x25f712,
-  0x25fb67,
-  0x26043c,
-  0x260849,
-  0x2610a3,
-  0x261cd6,
-  0x262177,
-  0x262d02,
-  0x2635e8,
-  0x26399d,
-  0x2642df,
-  0x264eaa,
-  0x265640,
-  0x265a35,
-  0x266794,
-  0x266be1,
-  0x26730b,
-  0x267f7e,
-  0x26858f,
-  0x2689fa,
-  0x269110,
-  0x269d65,
-  0x26a0c4,
-  0x26acb1,
-  0x26b45b,
-  0x26b82e,
-  0x26c36c,
-  0x26cf19,
-  0x26d7f3,
-  0x26db86,
-  0x26e627,
-  0x26ea52,
-  0x26f2b8,
-  0x26fecd,
-  0x27075a,
-  0x270b2f,
-  0x2713c5,
-  0x271fb0,
-  0x272211,
-  0x272e64,
-  0x27368e,
-  0x273afb,
-  0x2741b9,
-  0x274dcc,
-  0x275526,
-  0x275953,
-  0x2764f2,
-  0x276887,
-  0x27706d,
-  0x277c18,
-  0x2786e9,
-  0x278a9c,
-  0x279276,
-  0x279e03,
-  0x27a3a2,
-  0x27afd7,
-  0x27b73d,
-  0x27bb48,
-  0x27c00a,
-  0x27cc7f,
-  0x27d495,
-  0x27d8e0,
-  0x27e541,
-  0x27e934,
-  0x27f1de,
-  0x27fdab,
-  0x2800c7,
-  0x280cb2,
-  0x281458,
-  0x28182d,
-  0x28258c,
-  0x2829f9,
-  0x283113,
-  0x283d66,
-  0x284624,
-  0x284a51,
-  0x2852bb,
-  0x285ece,
-  0x28636f,
-  0x286f1a,
-  0x2877f0,
-  0x287b85,
-  0x288174,
-  0x288d01,
-  0x2895eb,
-  0x28999e,
-  0x28a43f,
-  0x28a84a,
-  0x28b0a0,
-  0x28bcd5,
-  0x28c797,
-  0x28cbe2,
-  0x28d308,
-  0x28df7d,
-  0x28e2dc,
-  0x28eea9,
-  0x28f643,
-  0x28fa36,
-  0x2903a1,
-  0x290fd4,
-  0x29173e,
-  0x291b4b,
-  0x2926ea,
-  0x292a9f,
-  0x293275,
-  0x293e00,
-  0x294542,
-  0x294937,
-  0x2951dd,
-  0x295da8,
-  0x296009,
-  0x296c7c,
-  0x297496,
-  0x2978e3,
-  0x298212,
-  0x298e67,
-  0x29968d,
-  0x299af8,
-  0x29a759,
-  0x29ab2c,
-  0x29b3c6,
-  0x29bfb3,
-  0x29c4f1,
-  0x29c884,
-  0x29d06e,
-  0x29dc1b,
-  0x29e1ba,
-  0x29edcf,
-  0x29f525,
-  0x29f950,
-  0x2a060b,
-  0x2a0a7e,
-  0x2a1294,
-  0x2a1ee1,
-  0x2a2340,
-  0x2a2f35,
-  0x2a37df,
-  0x2a3baa,
-  0x2a40e8,
-  0x2a4c9d,
-  0x2a5477,
-  0x2a5802,
-  0x2a65a3,
-  0x2a69d6,
-  0x2a713c,
-  0x2a7d49,
-  0x2a87b8,
-  0x2a8bcd,
-  0x2a9327,
-  0x2a9f52,
-  0x2aa2f3,
-  0x2aae86,
-  0x2ab66c,
-  0x2aba19,
-  0x2ac15b,
-  0x2acd2e,
-  0x2ad5c4,
-  0x2ad9b1,
-  0x2ae410,
-  0x2ae865,
-  0x2af08f,
-  0x2afcfa,
-  0x2b056d,
-  0x2b0918,
-  0x2b11f2,
-  0x2b1d87,
-  0x2b2026,
-  0x2b2c53,
-  0x2b34b9,
-  0x2b38cc,
-  0x2b438e,
-  0x2b4ffb,
-  0x2b5711,
-  0x2b5b64,
-  0x2b66c5,
-  0x2b6ab0,
-  0x2b725a,
-  0x2b7e2f,
-  0x2b84de,
-  0x2b88ab,
-  0x2b9041,
-  0x2b9c34,
-  0x2ba195,
-  0x2bade0,
-  0x2bb50a,
-  0x2bb97f,
-  0x2bc23d,
-  0x2bce48,
-  0x2bd6a2,
-  0x2bdad7,
-  0x2be776,
-  0x2beb03,
-  0x2bf3e9,
-  0x2bff9c,
-  0x2c012a,
-  0x2c0d5f,
-  0x2c15b5,
-  0x2c19c0,
-  0x2c2461,
-  0x2c2814,
-  0x2c30fe,
-  0x2c3c8b,
-  0x2c47c9,
-  0x2c4bbc,
-  0x2c5356,
-  0x2c5f23,
-  0x2c6282,
-  0x2c6ef7,
-  0x2c761d,
-  0x2c7a68,
-  0x2c8099,
-  0x2c8cec,
-  0x2c9406,
-  0x2c9873,
-  0x2ca5d2,
-  0x2ca9a7,
-  0x2cb14d,
-  0x2cbd38,
-  0x2cc67a,
-  0x2cca0f,
-  0x2cd2e5,
-  0x2cde90,
-  0x2ce331,
-  0x2cef44,
-  0x2cf7ae,
-  0x2cfbdb,
-  0x2d024c,
-  0x2d0e39,
-  0x2d16d3,
-  0x2d1aa6,
-  0x2d2707,
-  0x2d2b72,
-  0x2d3398,
-  0x2d3fed,
-  0x2d44af,
-  0x2d48da,
-  0x2d5030,
-  0x2d5c45,
-  0x2d61e4,
-  0x2d6d91,
-  0x2d757b,
-  0x2d790e,
-  0x2d83ff,
-  0x2d8f8a,
-  0x2d9760,
-  0x2d9b15,
-  0x2da6b4,
-  0x2daac1,
-  0x2db22b,
-  0x2dbe5e,
-  0x2dc51c,
-  0x2dc969,
-  0x2dd183,
-  0x2dddf6,
-  0x2de057,
-  0x2dec22,
-  0x2df4c8,
-  0x2df8bd,
-  0x2e07e6,
-  0x2e0b93,
-  0x2e1379,
-  0x2e1f0c,
-  0x2e22ad,
-  0x2e2ed8,
-  0x2e3632,
-  0x2e3a47,
-  0x2e4105,
-  0x2e4d70,
-  0x2e559a,
-  0x2e59ef,
-  0x2e644e,
-  0x2e683b,
-  0x2e70d1,
-  0x2e7ca4,
-  0x2e8655,
-  0x2e8a20,
-  0x2e92ca,
-  0x2e9ebf,
-  0x2ea31e,
-  0x2eaf6b,
-  0x2eb781,
-  0x2ebbf4,
-  0x2ec0b6,
-  0x2eccc3,
-  0x2ed429,
-  0x2ed85c,
-  0x2ee5fd,
-  0x2ee988,
-  0x2ef162,
-  0x2efd17,
-  0x2f0480,
-  0x2f08f5,
-  0x2f101f,
-  0x2f1c6a,
-  0x2f21cb,
-  0x2f2dbe,
-  0x2f3554,
-  0x2f3921,
-  0x2f4263,
-  0x2f4e16,
-  0x2f56fc,
-  0x2f5a89,
-  0x2f6728,
-  0x2f6b5d,
-  0x2f73b7,
-  0x2f7fc2,
-  0x2f8533,
-  0x2f8946,
-  0x2f91ac,
-  0x2f9dd9,
-  0x2fa078,
-  0x2fac0d,
-  0x2fb4e7,
-  0x2fb892,
-  0x2fc3d0,
-  0x2fcfa5,
-  0x2fd74f,
-  0x2fdb3a,
-  0x2fe69b,
-  0x2feaee,
-  0x2ff204,
-  0x2ffe71,
-  0x3004a9,
-  0x3008dc,
-  0x301036,
-  0x301c43,
-  0x3021e2,
-  0x302d97,
-  0x30357d,
-  0x303908,
-  0x30424a,
-  0x304e3f,
-  0x3056d5,
-  0x305aa0,
-  0x306701,
-  0x306b74,
-  0x30739e,
-  0x307feb,
-  0x30851a,
-  0x30896f,
-  0x309185,
-  0x309df0,
-  0x30a051,
-  0x30ac24,
-  0x30b4ce,
-  0x30b8bb,
-  0x30c3f9,
-  0x30cf8c,
-  0x30d766,
-  0x30db13,
-  0x30e6b2,
-  0x30eac7,
-  0x30f22d,
-  0x30fe58,
-  0x3107cf,
-  0x310bba,
-  0x311350,
-  0x311f25,
-  0x312284,
-  0x312ef1,
-  0x31361b,
-  0x313a6e,
-  0x31412c,
-  0x314d59,
-  0x3155b3,
-  0x3159c6,
-  0x316467,
-  0x316812,
-  0x3170f8,
-  0x317c8d,
-  0x31867c,
-  0x318a09,
-  0x3192e3,
-  0x319e96,
-  0x31a337,
-  0x31af42,
-  0x31b7a8,
-  0x31bbdd,
-  0x31c09f,
-  0x31ccea,
-  0x31d400,
-  0x31d875,
-  0x31e5d4,
-  0x31e9a1,
-  0x31f14b,
-  0x31fd3e,
-  0x320265,
-  0x320e10,
-  0x3216fa,
-  0x321a8f,
-  0x32272e,
-  0x322b5b,
-  0x3233b1,
-  0x323fc4,
-  0x324486,
-  0x3248f3,
-  0x325019,
-  0x325c6c,
-  0x3261cd,
-  0x326db8,
-  0x327552,
-  0x327927,
-  0x3283d6,
-  0x328fa3,
-  0x329749,
-  0x329b3c,
-  0x32a69d,
-  0x32aae8,
-  0x32b202,
-  0x32be77,
-  0x32c535,
-  0x32c940,
-  0x32d1aa,
-  0x32dddf,
-  0x32e07e,
-  0x32ec0b,
-  0x32f4e1,
-  0x32f894,
-  0x330103,
-  0x330d76,
-  0x33159c,
-  0x3319e9,
-  0x332448,
-  0x33283d,
-  0x3330d7,
-  0x333ca2,
-  0x3347e0,
-  0x334b95,
-  0x33537f,
-  0x335f0a,
-  0x3362ab,
-  0x336ede,
-  0x337634,
-  0x337a41,
-  0x3380b0,
-  0x338cc5,
-  0x33942f,
-  0x33985a,
-  0x33a5fb,
-  0x33a98e,
-  0x33b164,
-  0x33bd11,
-  0x33c653,
-  0x33ca26,
-  0x33d2cc,
-  0x33deb9,
-  0x33e318,
-  0x33ef6d,
-  0x33f787,
-  0x33fbf2,
-  0x340544,
-  0x340931,
-  0x3411db,
-  0x341dae,
-  0x34200f,
-  0x342c7a,
-  0x343490,
-  0x3438e5,
-  0x3443a7,
-  0x344fd2,
-  0x345738,
-  0x345b4d,
-  0x3466ec,
-  0x346a99,
-  0x347273,
-  0x347e06,
-  0x3484f7,
-  0x348882,
-  0x349068,
-  0x349c1d,
-  0x34a1bc,
-  0x34adc9,
-  0x34b523,
-  0x34b956,
-  0x34c214,
-  0x34ce61,
-  0x34d68b,
-  0x34dafe,
-  0x34e75f,
-  0x34eb2a,
-  0x34f3c0,
-  0x34ffb5,
-  0x350622,
-  0x350a57,
-  0x3512bd,
-  0x351ec8,
-  0x352369,
-  0x352f1c,
-  0x3537f6,
-  0x353b83,
-  0x3540c1,
-  0x354cb4,
-  0x35545e,
-  0x35582b,
-  0x35658a,
-  0x3569ff,
-  0x357115,
-  0x357d60,
-  0x358791,
-  0x358be4,
-  0x35930e,
-  0x359f7b,
-  0x35a2da,
-  0x35aeaf,
-  0x35b645,
-  0x35ba30,
-  0x35c172,
-  0x35cd07,
-  0x35d5ed,
-  0x35d998,
-  0x35e439,
-  0x35e84c,
-  0x35f0a6,
-  0x35fcd3,
-  0x360388,
-  0x360ffd,
-  0x361717,
-  0x361b62,
-  0x3626c3,
-  0x362ab6,
-  0x36325c,
-  0x363e29,
-  0x36456b,
-  0x36491e,
-  0x3651f4,
-  0x365d81,
-  0x366020,
-  0x366c55,
-  0x3674bf,
-  0x3678ca,
-  0x36823b,
-  0x368e4e,
-  0x3696a4,
-  0x369ad1,
-  0x36a770,
-  0x36ab05,
-  0x36b3ef,
-  0x36bf9a,
-  0x36c4d8,
-  0x36c8ad,
-  0x36d047,
-  0x36dc32,
-  0x36e193,
-  0x36ede6,
-  0x36f50c,
-  0x36f979,
-  0x3700ee,
-  0x370c9b,
-  0x371471,
-  0x371804,
-  0x3725a5,
-  0x3729d0,
-  0x37313a,
-  0x373d4f,
-  0x37460d,
-  0x374a78,
-  0x375292,
-  0x375ee7,
-  0x376346,
-  0x376f33,
-  0x3777d9,
-  0x377bac,
-  0x37815d,
-  0x378d28,
-  0x3795c2,
-  0x3799b7,
-  0x37a416,
-  0x37a863,
-  0x37b089,
-  0x37bcfc,
-  0x37c7be,
-  0x37cbcb,
-  0x37d321,
-  0x37df54,
-  0x37e2f5,
-  0x37ee80,
-  0x37f66a,
-  0x37fa1f,
-  0x380773,
-  0x380b06,
-  0x3813ec,
-  0x381f99,
-  0x382238,
-  0x382e4d,
-  0x3836a7,
-  0x383ad2,
-  0x384190,
-  0x384de5,
-  0x38550f,
-  0x38597a,
-  0x3864db,
-  0x3868ae,
-  0x387044,
-  0x387c31,
-  0x3886c0,
-  0x388ab5,
-  0x38925f,
-  0x389e2a,
-  0x38a38b,
-  0x38affe,
-  0x38b714,
-  0x38bb61,
-  0x38c023,
-  0x38cc56,
-  0x38d4bc,
-  0x38d8c9,
-  0x38e568,
-  0x38e91d,
-  0x38f1f7,
-  0x38fd82,
-  0x390415,
-  0x390860,
-  0x39108a,
-  0x391cff,
-  0x39215e,
-  0x392d2b,
-  0x3935c1,
-  0x3939b4,
-  0x3942f6,
-  0x394e83,
-  0x395669,
-  0x395a1c,
-  0x3967bd,
-  0x396bc8,
-  0x397322,
-  0x397f57,
-  0x3985a6,
-  0x3989d3,
-  0x399139,
-  0x399d4c,
-  0x39a0ed,
-  0x39ac98,
-  0x39b472,
-  0x39b807,
-  0x39c345,
-  0x39cf30,
-  0x39d7da,
-  0x39dbaf,
-  0x39e60e,
-  0x39ea7b,
-  0x39f291,
-  0x39fee4,
-  0x3a01bf,
-  0x3a0dca,
-  0x3a1520,
-  0x3a1955,
-  0x3a24f4,
-  0x3a2881,
-  0x3a306b,
-  0x3a3c1e,
-  0x3a475c,
-  0x3a4b29,
-  0x3a53c3,
-  0x3a5fb6,
-  0x3a6217,
-  0x3a6e62,
-  0x3a7688,
-  0x3a7afd,
-  0x3a800c,
-  0x3a8c79,
-  0x3a9493,
-  0x3a98e6,
-  0x3aa547,
-  0x3aa932,
-  0x3ab1d8,
-  0x3abdad,
-  0x3ac6ef,
-  0x3aca9a,
-  0x3ad270,
-  0x3ade05,
-  0x3ae3a4,
-  0x3aefd1,
-  0x3af73b,
-  0x3afb4e,
-  0x3b02d9,
-  0x3b0eac,
-  0x3b1646,
-  0x3b1a33,
-  0x3b2792,
-  0x3b2be7,
-  0x3b330d,
-  0x3b3f78,
-  0x3b443a,
-  0x3b484f,
-  0x3b50a5,
-  0x3b5cd0,
-  0x3b6171,
-  0x3b6d04,
-  0x3b75ee,
-  0x3b799b,
-  0x3b836a,
-  0x3b8f1f,
-  0x3b97f5,
-  0x3b9b80,
-  0x3ba621,
-  0x3baa54,
-  0x3bb2be,
-  0x3bbecb,
-  0x3bc589,
-  0x3bc9fc,
-  0x3bd116,
-  0x3bdd63,
-  0x3be0c2,
-  0x3becb7,
-  0x3bf45d,
-  0x3bf828,
-  0x3c069e,
-  0x3c0aeb,
-  0x3c1201,
-  0x3c1e74,
-  0x3c23d5,
-  0x3c2fa0,
-  0x3c374a,
-  0x3c3b3f,
-  0x3c407d,
-  0x3c4c08,
-  0x3c54e2,
-  0x3c5897,
-  0x3c6536,
-  0x3c6943,
-  0x3c71a9,
-  0x3c7ddc,
-  0x3c872d,
-  0x3c8b58,
-  0x3c93b2,
-  0x3c9fc7,
-  0x3ca266,
-  0x3cae13,
-  0x3cb6f9,
-  0x3cba8c,
-  0x3cc1ce,
-  0x3ccdbb,
-  0x3cd551,
-  0x3cd924,
-  0x3ce485,
-  0x3ce8f0,
-  0x3cf01a,
-  0x3cfc6f,
-  0x3d05f8,
-  0x3d098d,
-  0x3d1167,
-  0x3d1d12,
-  0x3d20b3,
-  0x3d2cc6,
-  0x3d342c,
-  0x3d3859,
-  0x3d431b,
-  0x3d4f6e,
-  0x3d5784,
-  0x3d5bf1,
-  0x3d6650,
-  0x3d6a25,
-  0x3d72cf,
-  0x3d7eba,
-  0x3d844b,
-  0x3d883e,
-  0x3d90d4,
-  0x3d9ca1,
-  0x3da100,
-  0x3dad75,
-  0x3db59f,
-  0x3db9ea,
-  0x3dc2a8,
-  0x3dcedd,
-  0x3dd637,
-  0x3dda42,
-  0x3de7e3,
-  0x3deb96,
-  0x3df37c,
-  0x3dff09,
-  0x3e0052,
-  0x3e0c27,
-  0x3e14cd,
-  0x3e18b8,
-  0x3e2519,
-  0x3e296c,
-  0x3e3186,
-  0x3e3df3,
-  0x3e46b1,
-  0x3e4ac4,
-  0x3e522e,
-  0x3e5e5b,
-  0x3e63fa,
-  0x3e6f8f,
-  0x3e7765,
-  0x3e7b10,
-  0x3e81e1,
-  0x3e8d94,
-  0x3e957e,
-  0x3e990b,
-  0x3ea4aa,
-  0x3ea8df,
-  0x3eb035,
-  0x3ebc40,
-  0x3ec702,
-  0x3ecb77,
-  0x3ed39d,
-  0x3edfe8,
-  0x3ee249,
-  0x3eee3c,
-  0x3ef6d6,
-  0x3efaa3,
-  0x3f0334,
-  0x3f0f41,
-  0x3f17ab,
-  0x3f1bde,
-  0x3f267f,
-  0x3f2a0a,
-  0x3f32e0,
-  0x3f3e95,
-  0x3f45d7,
-  0x3f49a2,
-  0x3f5148,
-  0x3f5d3d,
-  0x3f609c,
-  0x3f6ce9,
-  0x3f7403,
-  0x3f7876,
-  0x3f8287,
-  0x3f8ef2,
-  0x3f9618,
-  0x3f9a6d,
-  0x3fa7cc,
-  0x3fabb9,
-  0x3fb353,
-  0x3fbf26,
-  0x3fc464,
-  0x3fc811,
-  0x3fd0fb,
-  0x3fdc8e,
-  0x3fe12f,
-  0x3fed5a,
-  0x3ff5b0,
-  0x3ff9c5,
-  0x40063a,
-  0x400a4f,
-  0x4012a5,
-  0x401ed0,
-  0x402371,
-  0x402f04,
-  0x4037ee,
-  0x403b9b,
-  0x4040d9,
-  0x404cac,
-  0x405446,
-  0x405833,
-  0x406592,
-  0x4069e7,
-  0x40710d,
-  0x407d78,
-  0x408789,
-  0x408bfc,
-  0x409316,
-  0x409f63,
-  0x40a2c2,
-  0x40aeb7,
-  0x40b65d,
-  0x40ba28,
-  0x40c16a,
-  0x40cd1f,
-  0x40d5f5,
-  0x40d980,
-  0x40e421,
-  0x40e854,
-  0x40f0be,
-  0x40fccb,
-  0x41055c,
-  0x410929,
-  0x4111c3,
-  0x411db6,
-  0x412017,
-  0x412c62,
-  0x413488,
-  0x4138fd,
-  0x4143bf,
-  0x414fca,
-  0x415720,
-  0x415b55,
-  0x4166f4,
-  0x416a81,
-  0x41726b,
-  0x417e1e,
-  0x4184ef,
-  0x41889a,
-  0x419070,
-  0x419c05,
-  0x41a1a4,
-  0x41add1,
-  0x41b53b,
-  0x41b94e,
-  0x41c20c,
-  0x41ce79,
-  0x41d693,
-  0x41dae6,
-  0x41e747,
-  0x41eb32,
-  0x41f3d8,
-  0x41ffad,
-  0x4200f6,
-  0x420c83,
-  0x421469,
-  0x42181c,
-  0x4225bd,
-  0x4229c8,
-  0x423122,
-  0x423d57,
-  0x424615,
-  0x424a60,
-  0x42528a,
-  0x425eff,
-  0x42635e,
-  0x426f2b,
-  0x4277c1,
-  0x427bb4,
-  0x428145,
-  0x428d30,
-  0x4295da,
-  0x4299af,
-  0x42a40e,
-  0x42a87b,
-  0x42b091,
-  0x42bce4,
-  0x42c7a6,
-  0x42cbd3,
-  0x42d339,
-  0x42df4c,
-  0x42e2ed,
-  0x42ee98,
-  0x42f672,
-  0x42fa07,
-  0x430390,
-  0x430fe5,
-  0x43170f,
-  0x431b7a,
-  0x4326db,
-  0x432aae,
-  0x433244,
-  0x433e31,
-  0x434573,
-  0x434906,
-  0x4351ec,
-  0x435d99,
-  0x436038,
-  0x436c4d,
-  0x4374a7,
-  0x4378d2,
-  0x438223,
-  0x438e56,
-  0x4396bc,
-  0x439ac9,
-  0x43a768,
-  0x43ab1d,
-  0x43b3f7,
-  0x43bf82,
-  0x43c4c0,
-  0x43c8b5,
-  0x43d05f,
-  0x43dc2a,
-  0x43e18b,
-  0x43edfe,
-  0x43f514,
-  0x43f961,
-  0x4407d7,
-  0x440ba2,
-  0x441348,
-  0x441f3d,
-  0x44229c,
-  0x442ee9,
-  0x443603,
-  0x443a76,
-  0x444134,
-  0x444d41,
-  0x4455ab,
-  0x4459de,
-  0x44647f,
-  0x44680a,
-  0x4470e0,
-  0x447c95,
-  0x448664,
-  0x448a11,
-  0x4492fb,
-  0x449e8e,
-  0x44a32f,
-  0x44af5a,
-  0x44b7b0,
-  0x44bbc5,
-  0x44c087,
-  0x44ccf2,
-  0x44d418,
-  0x44d86d,
-  0x44e5cc,
-  0x44e9b9,
-  0x44f153,
-  0x44fd26,
-  0x4504b1,
-  0x4508c4,
-  0x45102e,
-  0x451c5b,
-  0x4521fa,
-  0x452d8f,
-  0x453565,
-  0x453910,
-  0x454252,
-  0x454e27,
-  0x4556cd,
-  0x455ab8,
-  0x456719,
-  0x456b6c,
-  0x457386,
-  0x457ff3,
-  0x458502,
-  0x458977,
-  0x45919d,
-  0x459de8,
-  0x45a049,
-  0x45ac3c,
-  0x45b4d6,
-  0x45b8a3,
-  0x45c3e1,
-  0x45cf94,
-  0x45d77e,
-  0x45db0b,
-  0x45e6aa,
-  0x45eadf,
-  0x45f235,
-  0x45fe40,
-  0x46011b,
-  0x460d6e,
-  0x461584,
-  0x4619f1,
-  0x462450,
-  0x462825,
-  0x4630cf,
-  0x463cba,
-  0x4647f8,
-  0x464b8d,
-  0x465367,
-  0x465f12,
-  0x4662b3,
-  0x466ec6,
-  0x46762c,
-  0x467a59,
-  0x4680a8,
-  0x468cdd,
-  0x469437,
-  0x469842,
-  0x46a5e3,
-  0x46a996,
-  0x46b17c,
-  0x46bd09,
-  0x46c64b,
-  0x46ca3e,
-  0x46d2d4,
-  0x46dea1,
-  0x46e300,
-  0x46ef75,
-  0x46f79f,
-  0x46fbea,
-  0x47027d,
-  0x470e08,
-  0x4716e2,
-  0x471a97,
-  0x472736,
-  0x472b43,
-  0x4733a9,
-  0x473fdc,
-  0x47449e,
-  0x4748eb,
-  0x475001,
-  0x475c74,
-  0x4761d5,
-  0x476da0,
-  0x47754a,
-  0x47793f,
-  0x4783ce,
-  0x478fbb,
-  0x479751,
-  0x479b24,
-  0x47a685,
-  0x47aaf0,
-  0x47b21a,
-  0x47be6f,
-  0x47c52d,
-  0x47c958,
-  0x47d1b2,
-  0x47ddc7,
-  0x47e066,
-  0x47ec13,
-  0x47f4f9,
-  0x47f88c,
-  0x4805e0,
-  0x480995,
-  0x48117f,
-  0x481d0a,
-  0x4820ab,
-  0x482cde,
-  0x483434,
-  0x483841,
-  0x484303,
-  0x484f76,
-  0x48579c,
-  0x485be9,
-  0x486648,
-  0x486a3d,
-  0x4872d7,
-  0x487ea2,
-  0x488453,
-  0x488826,
-  0x4890cc,
-  0x489cb9,
-  0x48a118,
-  0x48ad6d,
-  0x48b587,
-  0x48b9f2,
-  0x48c2b0,
-  0x48cec5,
-  0x48d62f,
-  0x48da5a,
-  0x48e7fb,
-  0x48eb8e,
-  0x48f364,
-  0x48ff11,
-  0x490686,
-  0x490af3,
-  0x491219,
-  0x491e6c,
-  0x4923cd,
-  0x492fb8,
-  0x493752,
-  0x493b27,
-  0x494065,
-  0x494c10,
-  0x4954fa,
-  0x49588f,
-  0x49652e,
-  0x49695b,
-  0x4971b1,
-  0x497dc4,
-  0x498735,
-  0x498b40,
-  0x4993aa,
-  0x499fdf,
-  0x49a27e,
-  0x49ae0b,
-  0x49b6e1,
-  0x49ba94,
-  0x49c1d6,
-  0x49cda3,
-  0x49d549,
-  0x49d93c,
-  0x49e49d,
-  0x49e8e8,
-  0x49f002,
-  0x49fc77,
-  0x4a032c,
-  0x4a0f59,
-  0x4a17b3,
-  0x4a1bc6,
-  0x4a2667,
-  0x4a2a12,
-  0x4a32f8,
-  0x4a3e8d,
-  0x4a45cf,
-  0x4a49ba,
-  0x4a5150,
-  0x4a5d25,
-  0x4a6084,
-  0x4a6cf1,
-  0x4a741b,
-  0x4a786e,
-  0x4a829f,
-  0x4a8eea,
-  0x4a9600,
-  0x4a9a75,
-  0x4aa7d4,
-  0x4aaba1,
-  0x4ab34b,
-  0x4abf3e,
-  0x4ac47c,
-  0x4ac809,
-  0x4ad0e3,
-  0x4adc96,
-  0x4ae137,
-  0x4aed42,
-  0x4af5a8,
-  0x4af9dd,
-  0x4b004a,
-  0x4b0c3f,
-  0x4b14d5,
-  0x4b18a0,
-  0x4b2501,
-  0x4b2974,
-  0x4b319e,
-  0x4b3deb,
-  0x4b46a9,
-  0x4b4adc,
-  0x4b5236,
-  0x4b5e43,
-  0x4b63e2,
-  0x4b6f97,
-  0x4b777d,
-  0x4b7b08,
-  0x4b81f9,
-  0x4b8d8c,
-  0x4b9566,
-  0x4b9913,
-  0x4ba4b2,
-  0x4ba8c7,
-  0x4bb02d,
-  0x4bbc58,
-  0x4bc71a,
-  0x4bcb6f,
-  0x4bd385,
-  0x4bdff0,
-  0x4be251,
-  0x4bee24,
-  0x4bf6ce,
-  0x4bfabb,
-  0x4c040d,
-  0x4c0878,
-  0x4c1092,
-  0x4c1ce7,
-  0x4c2146,
-  0x4c2d33,
-  0x4c35d9,
-  0x4c39ac,
-  0x4c42ee,
-  0x4c4e9b,
-  0x4c5671,
-  0x4c5a04,
-  0x4c67a5,
-  0x4c6bd0,
-  0x4c733a,
-  0x4c7f4f,
-  0x4c85be,
-  0x4c89cb,
-  0x4c9121,
-  0x4c9d54,
-  0x4ca0f5,
-  0x4cac80,
-  0x4cb46a,
-  0x4cb81f,
-  0x4cc35d,
-  0x4ccf28,
-  0x4cd7c2,
-  0x4cdbb7,
-  0x4ce616,
-  0x4cea63,
-  0x4cf289,
-  0x4cfefc,
-  0x4d076b,
-  0x4d0b1e,
-  0x4d13f4,
-  0x4d1f81,
-  0x4d2220,
-  0x4d2e55,
-  0x4d36bf,
-  0x4d3aca,
-  0x4d4188,
-  0x4d4dfd,
-  0x4d5517,
-  0x4d5962,
-  0x4d64c3,
-  0x4d68b6,
-  0x4d705c,
-  0x4d7c29,
-  0x4d86d8,
-  0x4d8aad,
-  0x4d9247,
-  0x4d9e32,
-  0x4da393,
-  0x4dafe6,
-  0x4db70c,
-  0x4dbb79,
-  0x4dc03b,
-  0x4dcc4e,
-  0x4dd4a4,
-  0x4dd8d1,
-  0x4de570,
-  0x4de905,
-  0x4df1ef,
-  0x4dfd9a,
-  0x4e02c1,
-  0x4e0eb4,
-  0x4e165e,
-  0x4e1a2b,
-  0x4e278a,
-  0x4e2bff,
-  0x4e3315,
-  0x4e3f60,
-  0x4e4422,
-  0x4e4857,
-  0x4e50bd,
-  0x4e5cc8,
-  0x4e6169,
-  0x4e6d1c,
-  0x4e75f6,
-  0x4e7983,
-  0x4e8372,
-  0x4e8f07,
-  0x4e97ed,
-  0x4e9b98,
-  0x4ea639,
-  0x4eaa4c,
-  0x4eb2a6,
-  0x4ebed3,
-  0x4ec591,
-  0x4ec9e4,
-  0x4ed10e,
-  0x4edd7b,
-  0x4ee0da,
-  0x4eecaf,
-  0x4ef445,
-  0x4ef830,
-  0x4f01a7,
-  0x4f0dd2,
-  0x4f1538,
-  0x4f194d,
-  0x4f24ec,
-  0x4f2899,
-  0x4f3073,
-  0x4f3c06,
-  0x4f4744,
-  0x4f4b31,
-  0x4f53db,
-  0x4f5fae,
-  0x4f620f,
-  0x4f6e7a,
-  0x4f7690,
-  0x4f7ae5,
-  0x4f8014,
-  0x4f8c61,
-  0x4f948b,
-  0x4f98fe,
-  0x4fa55f,
-  0x4fa92a,
-  0x4fb1c0,
-  0x4fbdb5,
-  0x4fc6f7,
-  0x4fca82,
-  0x4fd268,
-  0x4fde1d,
-  0x4fe3bc,
-  0x4fefc9,
-  0x4ff723,
-  0x4ffb56,
-  0x50018e,
-  0x500dfb,
-  0x501511,
-  0x501964,
-  0x5024c5,
-  0x5028b0,
-  0x50305a,
-  0x503c2f,
-  0x50476d,
-  0x504b18,
-  0x5053f2,
-  0x505f87,
-  0x506226,
-  0x506e53,
-  0x5076b9,
-  0x507acc,
-  0x50803d,
-  0x508c48,
-  0x5094a2,
-  0x5098d7,
-  0x50a576,
-  0x50a903,
-  0x50b1e9,
-  0x50bd9c,
-  0x50c6de,
-  0x50caab,
-  0x50d241,
-  0x50de34,
-  0x50e395,
-  0x50efe0,
-  0x50f70a,
-  0x50fb7f,
-  0x5102e8,
-  0x510e9d,
-  0x511677,
-  0x511a02,
-  0x5127a3,
-  0x512bd6,
-  0x51333c,
-  0x513f49,
-  0x51440b,
-  0x51487e,
-  0x515094,
-  0x515ce1,
-  0x516140,
-  0x516d35,
-  0x5175df,
-  0x5179aa,
-  0x51835b,
-  0x518f2e,
-  0x5197c4,
-  0x519bb1,
-  0x51a610,
-  0x51aa65,
-  0x51b28f,
-  0x51befa,
-  0x51c5b8,
-  0x51c9cd,
-  0x51d127,
-  0x51dd52,
-  0x51e0f3,
-  0x51ec86,
-  0x51f46c,
-  0x51f819,
-  0x520742,
-  0x520b37,
-  0x5213dd,
-  0x521fa8,
-  0x522209,
-  0x522e7c,
-  0x523696,
-  0x523ae3,
-  0x5241a1,
-  0x524dd4,
-  0x52553e,
-  0x52594b,
-  0x5264ea,
-  0x52689f,
-  0x527075,
-  0x527c00,
-  0x5286f1,
-  0x528a84,
-  0x52926e,
-  0x529e1b,
-  0x52a3ba,
-  0x52afcf,
-  0x52b725,
-  0x52bb50,
-  0x52c012,
-  0x52cc67,
-  0x52d48d,
-  0x52d8f8,
-  0x52e559,
-  0x52e92c,
-  0x52f1c6,
-  0x52fdb3,
-  0x530424,
-  0x530851,
-  0x5310bb,
-  0x531cce,
-  0x53216f,
-  0x532d1a,
-  0x5335f0,
-  0x533985,
-  0x5342c7,
-  0x534eb2,
-  0x535658,
-  0x535a2d,
-  0x53678c,
-  0x536bf9,
-  0x537313,
-  0x537f66,
-  0x538597,
-  0x5389e2,
-  0x539108,
-  0x539d7d,
-  0x53a0dc,
-  0x53aca9,
-  0x53b443,
-  0x53b836,
-  0x53c374,
-  0x53cf01,
-  0x53d7eb,
-  0x53db9e,
-  0x53e63f,
-  0x53ea4a,
-  0x53f2a0,
-  0x53fed5,
-  0x540063,
-  0x540c16,
-  0x5414fc,
-  0x541889,
-  0x542528,
-  0x54295d,
-  0x5431b7,
-  0x543dc2,
-  0x544680,
-  0x544af5,
-  0x54521f,
-  0x545e6a,
-  0x5463cb,
-  0x546fbe,
-  0x547754,
-  0x547b21,
-  0x5481d0,
-  0x548da5,
-  0x54954f,
-  0x54993a,
-  0x54a49b,
-  0x54a8ee,
-  0x54b004,
-  0x54bc71,
-  0x54c733,
-  0x54cb46,
-  0x54d3ac,
-  0x54dfd9,
-  0x54e278,
-  0x54ee0d,
-  0x54f6e7,
-  0x54fa92,
-  0x550305,
-  0x550f70,
-  0x55179a,
-  0x551bef,
-  0x55264e,
-  0x552a3b,
-  0x5532d1,
-  0x553ea4,
-  0x5545e6,
-  0x554993,
-  0x555179,
-  0x555d0c,
-  0x5560ad,
-  0x556cd8,
-  0x557432,
-  0x557847,
-  0x5582b6,
-  0x558ec3,
-  0x559629,
-  0x559a5c,
-  0x55a7fd,
-  0x55ab88,
-  0x55b362,
-  0x55bf17,
-  0x55c455,
-  0x55c820,
-  0x55d0ca,
-  0x55dcbf,
-  0x55e11e,
-  0x55ed6b,
-  0x55f581,
-  0x55f9f4,
-  0x5606af,
-  0x560ada,
-  0x561230,
-  0x561e45,
-  0x5623e4,
-  0x562f91,
-  0x56377b,
-  0x563b0e,
-  0x56404c,
-  0x564c39,
-  0x5654d3,
-  0x5658a6,
-  0x566507,
-  0x566972,
-  0x567198,
-  0x567ded,
-  0x56871c,
-  0x568b69,
-  0x569383,
-  0x569ff6,
-  0x56a257,
-  0x56ae22,
-  0x56b6c8,
-  0x56babd,
-  0x56c1ff,
-  0x56cd8a,
-  0x56d560,
-  0x56d915,
-  0x56e4b4,
-  0x56e8c1,
-  0x56f02b,
-  0x56fc5e,
-  0x5705c9,
-  0x5709bc,
-  0x571156,
-  0x571d23,
-  0x572082,
-  0x572cf7,
-  0x57341d,
-  0x573868,
-  0x57432a,
-  0x574f5f,
-  0x5757b5,
-  0x575bc0,
-  0x576661,
-  0x576a14,
-  0x5772fe,
-  0x577e8b,
-  0x57847a,
-  0x57880f,
-  0x5790e5,
-  0x579c90,
-  0x57a131,
-  0x57ad44,
-  0x57b5ae,
-  0x57b9db,
-  0x57c299,
-  0x57ceec,
-  0x57d606,
-  0x57da73,
-  0x57e7d2,
-  0x57eba7,
-  0x57f34d,
-  0x57ff38,
-  0x580254,
-  0x580e21,
-  0x5816cb,
-  0x581abe,
-  0x58271f,
-  0x582b6a,
-  0x583380,
-  0x583ff5,
-  0x5844b7,
-  0x5848c2,
-  0x585028,
-  0x585c5d,
-  0x5861fc,
-  0x586d89,
-  0x587563,
-  0x587916,
-  0x5883e7,
-  0x588f92,
-  0x589778,
-  0x589b0d,
-  0x58a6ac,
-  0x58aad9,
-  0x58b233,
-  0x58be46,
-  0x58c504,
-  0x58c971,
-  0x58d19b,
-  0x58ddee,
-  0x58e04f,
-  0x58ec3a,
-  0x58f4d0,
-  0x58f8a5,
-  0x590132,
-  0x590d47,
-  0x5915ad,
-  0x5919d8,
-  0x592479,
-  0x59280c,
-  0x5930e6,
-  0x593c93,
-  0x5947d1,
-  0x594ba4,
-  0x59534e,
-  0x595f3b,
-  0x59629a,
-  0x596eef,
-  0x597605,
-  0x597a70,
-  0x598081,
-  0x598cf4,
-  0x59941e,
-  0x59986b,
-  0x59a5ca,
-  0x59a9bf,
-  0x59b155,
-  0x59bd20,
-  0x59c662,
-  0x59ca17,
-  0x59d2fd,
-  0x59de88,
-  0x59e329,
-  0x59ef5c,
-  0x59f7b6,
-  0x59fbc3,
-  0x5a0498,
-  0x5a08ed,
-  0x5a1007,
-  0x5a1c72,
-  0x5a21d3,
-  0x5a2da6,
-  0x5a354c,
-  0x5a3939,
-  0x5a427b,
-  0x5a4e0e,
-  0x5a56e4,
-  0x5a5a91,
-  0x5a6730,
-  0x5a6b45,
-  0x5a73af,
-  0x5a7fda,
-  0x5a852b,
-  0x5a895e,
-  0x5a91b4,
-  0x5a9dc1,
-  0x5aa060,
-  0x5aac15,
-  0x5ab4ff,
-  0x5ab88a,
-  0x5ac3c8,
-  0x5acfbd,
-  0x5ad757,
-  0x5adb22,
-  0x5ae683,
-  0x5aeaf6,
-  0x5af21c,
-  0x5afe69,
-  0x5b07fe,
-  0x5b0b8b,
-  0x5b1361,
-  0x5b1f14,
-  0x5b22b5,
-  0x5b2ec0,
-  0x5b362a,
-  0x5b3a5f,
-  0x5b411d,
-  0x5b4d68,
-  0x5b5582,
-  0x5b59f7,
-  0x5b6456,
-  0x5b6823,
-  0x5b70c9,
-  0x5b7cbc,
-  0x5b864d,
-  0x5b8a38,
-  0x5b92d2,
-  0x5b9ea7,
-  0x5ba306,
-  0x5baf73,
-  0x5bb799,
-  0x5bbbec,
-  0x5bc0ae,
-  0x5bccdb,
-  0x5bd431,
-  0x5bd844,
-  0x5be5e5,
-  0x5be990,
-  0x5bf17a,
-  0x5bfd0f,
-  0x5c03b9,
-  0x5c0fcc,
-  0x5c1726,
-  0x5c1b53,
-  0x5c26f2,
-  0x5c2a87,
-  0x5c326d,
-  0x5c3e18,
-  0x5c455a,
-  0x5c492f,
-  0x5c51c5,
-  0x5c5db0,
-  0x5c6011,
-  0x5c6c64,
-  0x5c748e,
-  0x5c78fb,
-  0x5c820a,
-  0x5c8e7f,
-  0x5c9695,
-  0x5c9ae0,
-  0x5ca741,
-  0x5cab34,
-  0x5cb3de,
-  0x5cbfab,
-  0x5cc4e9,
-  0x5cc89c,
-  0x5cd076,
-  0x5cdc03,
-  0x5ce1a2,
-  0x5cedd7,
-  0x5cf53d,
-  0x5cf948,
-  0x5d00df,
-  0x5d0caa,
-  0x5d1440,
-  0x5d1835,
-  0x5d2594,
-  0x5d29e1,
-  0x5d310b,
-  0x5d3d7e,
-  0x5d463c,
-  0x5d4a49,
-  0x5d52a3,
-  0x5d5ed6,
-  0x5d6377,
-  0x5d6f02,
-  0x5d77e8,
-  0x5d7b9d,
-  0x5d816c,
-  0x5d8d19,
-  0x5d95f3,
-  0x5d9986,
-  0x5da427,
-  0x5da852,
-  0x5db0b8,
-  0x5dbccd,
-  0x5dc78f,
-  0x5dcbfa,
-  0x5dd310,
-  0x5ddf65,
-  0x5de2c4,
-  0x5deeb1,
-  0x5df65b,
-  0x5dfa2e,
-  0x5e0575,
-  0x5e0900,
-  0x5e11ea,
-  0x5e1d9f,
-  0x5e203e,
-  0x5e2c4b,
-  0x5e34a1,
-  0x5e38d4,
-  0x5e4396,
-  0x5e4fe3,
-  0x5e5709,
-  0x5e5b7c,
-  0x5e66dd,
-  0x5e6aa8,
-  0x5e7242,
-  0x5e7e37,
-  0x5e84c6,
-  0x5e88b3,
-  0x5e9059,
-  0x5e9c2c,
-  0x5ea18d,
-  0x5eadf8,
-  0x5eb512,
-  0x5eb967,
-  0x5ec225,
-  0x5ece50,
-  0x5ed6ba,
-  0x5edacf,
-  0x5ee76e,
-  0x5eeb1b,
-  0x5ef3f1,
-  0x5eff84,
-  0x5f0613,
-  0x5f0a66,
-  0x5f128c,
-  0x5f1ef9,
-  0x5f2358,
-  0x5f2f2d,
-  0x5f37c7,
-  0x5f3bb2,
-  0x5f40f0,
-  0x5f4c85,
-  0x5f546f,
-  0x5f581a,
-  0x5f65bb,
-  0x5f69ce,
-  0x5f7124,
-  0x5f7d51,
-  0x5f87a0,
-  0x5f8bd5,
-  0x5f933f,
-  0x5f9f4a,
-  0x5fa2eb,
-  0x5fae9e,
-  0x5fb674,
-  0x5fba01,
-  0x5fc143,
-  0x5fcd36,
-  0x5fd5dc,
-  0x5fd9a9,
-  0x5fe408,
-  0x5fe87d,
-  0x5ff097,
-  0x5ffce2,
-  0x600527,
-  0x600952,
-  0x6011b8,
-  0x601dcd,
-  0x60206c,
-  0x602c19,
-  0x6034f3,
-  0x603886,
-  0x6043c4,
-  0x604fb1,
-  0x60575b,
-  0x605b2e,
-  0x60668f,
-  0x606afa,
-  0x607210,
-  0x607e65,
-  0x608494,
-  0x6088e1,
-  0x60900b,
-  0x609c7e,
-  0x60a1df,
-  0x60adaa,
-  0x60b540,
-  0x60b935,
-  0x60c277,
-  0x60ce02,
-  0x60d6e8,
-  0x60da9d,
-  0x60e73c,
-  0x60eb49,
-  0x60f3a3,
-  0x60ffd6,
-  0x610641,
-  0x610a34,
-  0x6112de,
-  0x611eab,
-  0x61230a,
-  0x612f7f,
-  0x613795,
-  0x613be0,
-  0x6140a2,
-  0x614cd7,
-  0x61543d,
-  0x615848,
-  0x6165e9,
-  0x61699c,
-  0x617176,
-  0x617d03,
-  0x6187f2,
-  0x618b87,
-  0x61936d,
-  0x619f18,
-  0x61a2b9,
-  0x61aecc,
-  0x61b626,
-  0x61ba53,
-  0x61c111,
-  0x61cd64,
-  0x61d58e,
-  0x61d9fb,
-  0x61e45a,
-  0x61e82f,
-  0x61f0c5,
-  0x61fcb0,
-  0x6203eb,
-  0x620f9e,
-  0x621774,
-  0x621b01,
-  0x6226a0,
-  0x622ad5,
-  0x62323f,
-  0x623e4a,
-  0x624508,
-  0x62497d,
-  0x625197,
-  0x625de2,
-  0x626043,
-  0x626c36,
-  0x6274dc,
-  0x6278a9,
-  0x628258,
-  0x628e2d,
-  0x6296c7,
-  0x629ab2,
-  0x62a713,
-  0x62ab66,
-  0x62b38c,
-  0x62bff9,
-  0x62c4bb,
-  0x62c8ce,
-  0x62d024,
-  0x62dc51,
-  0x62e1f0,
-  0x62ed85,
-  0x62f56f,
-  0x62f91a,
-  0x63008d,
-  0x630cf8,
-  0x631412,
-  0x631867,
-  0x6325c6,
-  0x6329b3,
-  0x633159,
-  0x633d2c,
-  0x63466e,
-  0x634a1b,
-  0x6352f1,
-  0x635e84,
-  0x636325,
-  0x636f50,
-  0x6377ba,
-  0x637bcf,
-  0x63813e,
-  0x638d4b,
-  0x6395a1,
-  0x6399d4,
-  0x63a475,
-  0x63a800,
-  0x63b0ea,
-  0x63bc9f,
-  0x63c7dd,
-  0x63cba8,
-  0x63d342,
-  0x63df37,
-  0x63e296,
-  0x63eee3,
-  0x63f609,
-  0x63fa7c,
-  0x6404ca,
-  0x6408bf,
-  0x641055,
-  0x641c20,
-  0x642181,
-  0x642df4,
-  0x64351e,
-  0x64396b,
-  0x644229,
-  0x644e5c,
-  0x6456b6,
-  0x645ac3,
-  0x646762,
-  0x646b17,
-  0x6473fd,
-  0x647f88,
-  0x648579,
-  0x64890c,
-  0x6491e6,
-  0x649d93,
-  0x64a032,
-  0x64ac47,
-  0x64b4ad,
-  0x64b8d8,
-  0x64c39a,
-  0x64cfef,
-  0x64d705,
-  0x64db70,
-  0x64e6d1,
-  0x64eaa4,
-  0x64f24e,
-  0x64fe3b,
-  0x6507ac,
-  0x650bd9,
-  0x651333,
-  0x651f46,
-  0x6522e7,
-  0x652e92,
-  0x653678,
-  0x653a0d,
-  0x65414f,
-  0x654d3a,
-  0x6555d0,
-  0x6559a5,
-  0x656404,
-  0x656871,
-  0x65709b,
-  0x657cee,
-  0x65861f,
-  0x658a6a,
-  0x659280,
-  0x659ef5,
-  0x65a354,
-  0x65af21,
-  0x65b7cb,
-  0x65bbbe,
-  0x65c0fc,
-  0x65cc89,
-  0x65d463,
-  0x65d816,
-  0x65e5b7,
-  0x65e9c2,
-  0x65f128,
-  0x65fd5d,
-  0x660206,
-  0x660e73,
-  0x661699,
-  0x661aec,
-  0x66274d,
-  0x662b38,
-  0x6633d2,
-  0x663fa7,
-  0x6644e5,
-  0x664890,
-  0x66507a,
-  0x665c0f,
-  0x6661ae,
-  0x666ddb,
-  0x667531,
-  0x667944,
-  0x6683b5,
-  0x668fc0,
-  0x66972a,
-  0x669b5f,
-  0x66a6fe,
-  0x66aa8b,
-  0x66b261,
-  0x66be14,
-  0x66c556,
-  0x66c923,
-  0x66d1c9,
-  0x66ddbc,
-  0x66e01d,
-  0x66ec68,
-  0x66f482,
-  0x66f8f7,
-  0x670160,
-  0x670d15,
-  0x6715ff,
-  0x67198a,
-  0x67242b,
-  0x67285e,
-  0x6730b4,
-  0x673cc1,
-  0x674783,
-  0x674bf6,
-  0x67531c,
-  0x675f69,
-  0x6762c8,
-  0x676ebd,
-  0x677657,
-  0x677a22,
-  0x6780d3,
-  0x678ca6,
-  0x67944c,
-  0x679839,
-  0x67a598,
-  0x67a9ed,
-  0x67b107,
-  0x67bd72,
-  0x67c630,
-  0x67ca45,
-  0x67d2af,
-  0x67deda,
-  0x67e37b,
-  0x67ef0e,
-  0x67f7e4,
-  0x67fb91,
-  0x6806fd,
-  0x680a88,
-  0x681262,
-  0x681e17,
-  0x6823b6,
-  0x682fc3,
-  0x683729,
-  0x683b5c,
-  0x68401e,
-  0x684c6b,
-  0x685481,
-  0x6858f4,
-  0x686555,
-  0x686920,
-  0x6871ca,
-  0x687dbf,
-  0x68874e,
-  0x688b3b,
-  0x6893d1,
-  0x689fa4,
-  0x68a205,
-  0x68ae70,
-  0x68b69a,
-  0x68baef,
-  0x68c1ad,
-  0x68cdd8,
-  0x68d532,
-  0x68d947,
-  0x68e4e6,
-  0x68e893,
-  0x68f079,
-  0x68fc0c,
-  0x69059b,
-  0x6909ee,
-  0x691104,
-  0x691d71,
-  0x6920d0,
-  0x692ca5,
-  0x69344f,
-  0x69383a,
-  0x694378,
-  0x694f0d,
-  0x6957e7,
-  0x695b92,
-  0x696633,
-  0x696a46,
-  0x6972ac,
-  0x697ed9,
-  0x698428,
-  0x69885d,
-  0x6990b7,
-  0x699cc2,
-  0x69a163,
-  0x69ad16,
-  0x69b5fc,
-  0x69b989,
-  0x69c2cb,
-  0x69cebe,
-  0x69d654,
-  0x69da21,
-  0x69e780,
-  0x69ebf5,
-  0x69f31f,
-  0x69ff6a,
-  0x6a0031,
-  0x6a0c44,
-  0x6a14ae,
-  0x6a18db,
-  0x6a257a,
-  0x6a290f,
-  0x6a31e5,
-  0x6a3d90,
-  0x6a46d2,
-  0x6a4aa7,
-  0x6a524d,
-  0x6a5e38,
-  0x6a6399,
-  0x6a6fec,
-  0x6a7706,
-  0x6a7b73,
-  0x6a8182,
-  0x6a8df7,
-  0x6a951d,
-  0x6a9968,
-  0x6aa4c9,
-  0x6aa8bc,
-  0x6ab056,
-  0x6abc23,
-  0x6ac761,
-  0x6acb14,
-  0x6ad3fe,
-  0x6adf8b,
-  0x6ae22a,
-  0x6aee5f,
-  0x6af6b5,
-  0x6afac0,
-  0x6b0357,
-  0x6b0f22,
-  0x6b17c8,
-  0x6b1bbd,
-  0x6b261c,
-  0x6b2a69,
-  0x6b3283,
-  0x6b3ef6,
-  0x6b45b4,
-  0x6b49c1,
-  0x6b512b,
-  0x6b5d5e,
-  0x6b60ff,
-  0x6b6c8a,
-  0x6b7460,
-  0x6b7815,
-  0x6b82e4,
-  0x6b8e91,
-  0x6b967b,
-  0x6b9a0e,
-  0x6ba7af,
-  0x6babda,
-  0x6bb330,
-  0x6bbf45,
-  0x6bc407,
-  0x6bc872,
-  0x6bd098,
-  0x6bdced,
-  0x6be14c,
-  0x6bed39,
-  0x6bf5d3,
-  0x6bf9a6,
-  0x6c0710,
-  0x6c0b65,
-  0x6c138f,
-  0x6c1ffa,
-  0x6c225b,
-  0x6c2e2e,
-  0x6c36c4,
-  0x6c3ab1,
-  0x6c41f3,
-  0x6c4d86,
-  0x6c556c,
-  0x6c5919,
-  0x6c64b8,
-  0x6c68cd,
-  0x6c7027,
-  0x6c7c52,
-  0x6c86a3,
-  0x6c8ad6,
-  0x6c923c,
-  0x6c9e49,
-  0x6ca3e8,
-  0x6caf9d,
-  0x6cb777,
-  0x6cbb02,
-  0x6cc040,
-  0x6ccc35,
-  0x6cd4df,
-  0x6cd8aa,
-  0x6ce50b,
-  0x6ce97e,
-  0x6cf194,
-  0x6cfde1,
-  0x6d0476,
-  0x6d0803,
-  0x6d10e9,
-  0x6d1c9c,
-  0x6d213d,
-  0x6d2d48,
-  0x6d35a2,
-  0x6d39d7,
-  0x6d4295,
-  0x6d4ee0,
-  0x6d560a,
-  0x6d5a7f,
-  0x6d67de,
-  0x6d6bab,
-  0x6d7341,
-  0x6d7f34,
-  0x6d85c5,
-  0x6d89b0,
-  0x6d915a,
-  0x6d9d2f,
-  0x6da08e,
-  0x6dacfb,
-  0x6db411,
-  0x6db864,
-  0x6dc326,
-  0x6dcf53,
-  0x6dd7b9,
-  0x6ddbcc,
-  0x6de66d,
-  0x6dea18,
-  0x6df2f2,
-  0x6dfe87,
-  0x6e01dc,
-  0x6e0da9,
-  0x6e1543,
-  0x6e1936,
-  0x6e2497,
-  0x6e28e2,
-  0x6e3008,
-  0x6e3c7d,
-  0x6e473f,
-  0x6e4b4a,
-  0x6e53a0,
-  0x6e5fd5,
-  0x6e6274,
-  0x6e6e01,
-  0x6e76eb,
-  0x6e7a9e,
-  0x6e806f,
-  0x6e8c1a,
-  0x6e94f0,
-  0x6e9885,
-  0x6ea524,
-  0x6ea951,
-  0x6eb1bb,
-  0x6ebdce,
-  0x6ec68c,
-  0x6ecaf9,
-  0x6ed213,
-  0x6ede66,
-  0x6ee3c7,
-  0x6eefb2,
-  0x6ef758,
-  0x6efb2d,
-  0x6f02ba,
-  0x6f0ecf,
-  0x6f1625,
-  0x6f1a50,
-  0x6f27f1,
-  0x6f2b84,
-  0x6f336e,
-  0x6f3f1b,
-  0x6f4459,
-  0x6f482c,
-  0x6f50c6,
-  0x6f5cb3,
-  0x6f6112,
-  0x6f6d67,
-  0x6f758d,
-  0x6f79f8,
-  0x6f8309,
-  0x6f8f7c,
-  0x6f9796,
-  0x6f9be3,
-  0x6fa642,
-  0x6faa37,
-  0x6fb2dd,
-  0x6fbea8,
-  0x6fc5ea,
-  0x6fc99f,
-  0x6fd175,
-  0x6fdd00,
-  0x6fe0a1,
-  0x6fecd4,
-  0x6ff43e,
-  0x6ff84b,
-  0x700293,
-  0x700ee6,
-  0x70160c,
-  0x701a79,
-  0x7027d8,
-  0x702bad,
-  0x703347,
-  0x703f32,
-  0x704470,
-  0x704805,
-  0x7050ef,
-  0x705c9a,
-  0x70613b,
-  0x706d4e,
-  0x7075a4,
-  0x7079d1,
-  0x708320,
-  0x708f55,
-  0x7097bf,
-  0x709bca,
-  0x70a66b,
-  0x70aa1e,
-  0x70b2f4,
-  0x70be81,
-  0x70c5c3,
-  0x70c9b6,
-  0x70d15c,
-  0x70dd29,
-  0x70e088,
-  0x70ecfd,
-  0x70f417,
-  0x70f862,
-  0x7101f5,
-  0x710d80,
-  0x71156a,
-  0x71191f,
-  0x7124be,
-  0x7128cb,
-  0x713021,
-  0x713c54,
-  0x714716,
-  0x714b63,
-  0x715389,
-  0x715ffc,
-  0x71625d,
-  0x716e28,
-  0x7176c2,
-  0x717ab7,
-  0x718046,
-  0x718c33,
-  0x7194d9,
-  0x7198ac,
-  0x71a50d,
-  0x71a978,
-  0x71b192,
-  0x71bde7,
-  0x71c6a5,
-  0x71cad0,
-  0x71d23a,
-  0x71de4f,
-  0x71e3ee,
-  0x71ef9b,
-  0x71f771,
-  0x71fb04,
-  0x72045f,
-  0x72082a,
-  0x7210c0,
-  0x721cb5,
-  0x722114,
-  0x722d61,
-  0x72358b,
-  0x7239fe,
-  0x7242bc,
-  0x724ec9,
-  0x725623,
-  0x725a56,
-  0x7267f7,
-  0x726b82,
-  0x727368,
-  0x727f1d,
-  0x7285ec,
-  0x728999,
-  0x729173,
-  0x729d06,
-  0x72a0a7,
-  0x72acd2,
-  0x72b438,
-  0x72b84d,
-  0x72c30f,
-  0x72cf7a,
-  0x72d790,
-  0x72dbe5,
-  0x72e644,
-  0x72ea31,
-  0x72f2db,
-  0x72feae,
-  0x730739,
-  0x730b4c,
-  0x7313a6,
-  0x731fd3,
-  0x732272,
-  0x732e07,
-  0x7336ed,
-  0x733a98,
-  0x7341da,
-  0x734daf,
-  0x735545,
-  0x735930,
-  0x736491,
-  0x7368e4,
-  0x73700e,
-  0x737c7b,
-  0x73868a,
-  0x738aff,
-  0x739215,
-  0x739e60,
-  0x73a3c1,
-  0x73afb4,
-  0x73b75e,
-  0x73bb2b,
-  0x73c069,
-  0x73cc1c,
-  0x73d4f6,
-  0x73d883,
-  0x73e522,
-  0x73e957,
-  0x73f1bd,
-  0x73fdc8,
-  0x74037e,
-  0x740f0b,
-  0x7417e1,
-  0x741b94,
-  0x742635,
-  0x742a40,
-  0x7432aa,
-  0x743edf,
-  0x74459d,
-  0x7449e8,
-  0x745102,
-  0x745d77,
-  0x7460d6,
-  0x746ca3,
-  0x747449,
-  0x74783c,
-  0x7482cd,
-  0x748eb8,
-  0x749652,
-  0x749a27,
-  0x74a786,
-  0x74abf3,
-  0x74b319,
-  0x74bf6c,
-  0x74c42e,
-  0x74c85b,
-  0x74d0b1,
-  0x74dcc4,
-  0x74e165,
-  0x74ed10,
-  0x74f5fa,
-  0x74f98f,
-  0x750018,
-  0x750c6d,
-  0x751487,
-  0x7518f2,
-  0x752553,
-  0x752926,
-  0x7531cc,
-  0x753db9,
-  0x7546fb,
-  0x754a8e,
-  0x755264,
-  0x755e11,
-  0x7563b0,
-  0x756fc5,
-  0x75772f,
-  0x757b5a,
-  0x7581ab,
-  0x758dde,
-  0x759534,
-  0x759941,
-  0x75a4e0,
-  0x75a895,
-  0x75b07f,
-  0x75bc0a,
-  0x75c748,
-  0x75cb3d,
-  0x75d3d7,
-  0x75dfa2,
-  0x75e203,
-  0x75ee76,
-  0x75f69c,
-  0x75fae9,
-  0x7605b2,
-  0x7609c7,
-  0x76112d,
-  0x761d58,
-  0x7620f9,
-  0x762c8c,
-  0x763466,
-  0x763813,
-  0x764351,
-  0x764f24,
-  0x7657ce,
-  0x765bbb,
-  0x76661a,
-  0x766a6f,
-  0x767285,
-  0x767ef0,
-  0x768401,
-  0x768874,
-  0x76909e,
-  0x769ceb,
-  0x76a14a,
-  0x76ad3f,
-  0x76b5d5,
-  0x76b9a0,
-  0x76c2e2,
-  0x76ce97,
-  0x76d67d,
-  0x76da08,
-  0x76e7a9,
-  0x76ebdc,
-  0x76f336,
-  0x76ff43,
-  0x7706d4,
-  0x770aa1,
-  0x77124b,
-  0x771e3e,
-  0x77239f,
-  0x772fea,
-  0x773700,
-  0x773b75,
-  0x774037,
-  0x774c42,
-  0x7754a8,
-  0x7758dd,
-  0x77657c,
-  0x776909,
-  0x7771e3,
-  0x777d96,
-  0x778767,
-  0x778b12,
-  0x7793f8,
-  0x779f8d,
-  0x77a22c,
-  0x77ae59,
-  0x77b6b3,
-  0x77bac6,
-  0x77c184,
-  0x77cdf1,
-  0x77d51b,
-  0x77d96e,
-  0x77e4cf,
-  0x77e8ba,
-  0x77f050,
-  0x77fc25,
-  0x780149,
-  0x780d3c,
-  0x7815d6,
-  0x7819a3,
-  0x782402,
-  0x782877,
-  0x78309d,
-  0x783ce8,
-  0x7847aa,
-  0x784bdf,
-  0x785335,
-  0x785f40,
-  0x7862e1,
-  0x786e94,
-  0x78767e,
-  0x787a0b,
-  0x7880fa,
-  0x788c8f,
-  0x789465,
-  0x789810,
-  0x78a5b1,
-  0x78a9c4,
-  0x78b12e,
-  0x78bd5b,
-  0x78c619,
-  0x78ca6c,
-  0x78d286,
-  0x78def3,
-  0x78e352,
-  0x78ef27,
-  0x78f7cd,
-  0x78fbb8,
-  0x79022f,
-  0x790e5a,
-  0x7916b0,
-  0x791ac5,
-  0x792764,
-  0x792b11,
-  0x7933fb,
-  0x793f8e,
-  0x7944cc,
-  0x7948b9,
-  0x795053,
-  0x795c26,
-  0x796187,
-  0x796df2,
-  0x797518,
-  0x79796d,
-  0x79839c,
-  0x798fe9,
-  0x799703,
-  0x799b76,
-  0x79a6d7,
-  0x79aaa2,
-  0x79b248,
-  0x79be3d,
-  0x79c57f,
-  0x79c90a,
-  0x79d1e0,
-  0x79dd95,
-  0x79e034,
-  0x79ec41,
-  0x79f4ab,
-  0x79f8de,
-  0x7a0785,
-  0x7a0bf0,
-  0x7a131a,
-  0x7a1f6f,
-  0x7a22ce,
-  0x7a2ebb,
-  0x7a3651,
-  0x7a3a24,
-  0x7a4166,
-  0x7a4d13,
-  0x7a55f9,
-  0x7a598c,
-  0x7a642d,
-  0x7a6858,
-  0x7a70b2,
-  0x7a7cc7,
-  0x7a8636,
-  0x7a8a43,
-  0x7a92a9,
-  0x7a9edc,
-  0x7aa37d,
-  0x7aaf08,
-  0x7ab7e2,
-  0x7abb97,
-  0x7ac0d5,
-  0x7acca0,
-  0x7ad44a,
-  0x7ad83f,
-  0x7ae59e,
-  0x7ae9eb,
-  0x7af101,
-  0x7afd74,
-  0x7b04e3,
-  0x7b0896,
-  0x7b107c,
-  0x7b1c09,
-  0x7b21a8,
-  0x7b2ddd,
-  0x7b3537,
-  0x7b3942,
-  0x7b4200,
-  0x7b4e75,
-  0x7b569f,
-  0x7b5aea,
-  0x7b674b,
-  0x7b6b3e,
-  0x7b73d4,
-  0x7b7fa1,
-  0x7b8550,
-  0x7b8925,
-  0x7b91cf,
-  0x7b9dba,
-  0x7ba01b,
-  0x7bac6e,
-  0x7bb484,
-  0x7bb8f1,
-  0x7bc3b3,
-  0x7bcfc6,
-  0x7bd72c,
-  0x7bdb59,
-  0x7be6f8,
-  0x7bea8d,
-  0x7bf267,
-  0x7bfe12,
-  0x7c00a4,
-  0x7c0cd1,
-  0x7c143b,
-  0x7c184e,
-  0x7c25ef,
-  0x7c299a,
-  0x7c3170,
-  0x7c3d05,
-  0x7c4647,
-  0x7c4a32,
-  0x7c52d8,
-  0x7c5ead,
-  0x7c630c,
-  0x7c6f79,
-  0x7c7793,
-  0x7c7be6,
-  0x7c8117,
-  0x7c8d62,
-  0x7c9588,
-  0x7c99fd,
-  0x7ca45c,
-  0x7ca829,
-  0x7cb0c3,
-  0x7cbcb6,
-  0x7cc7f4,
-  0x7ccb81,
-  0x7cd36b,
-  0x7cdf1e,
-  0x7ce2bf,
-  0x7ceeca,
-  0x7cf620,
-  0x7cfa55,
-  0x7d03c2,
-  0x7d0fb7,
-  0x7d175d,
-  0x7d1b28,
-  0x7d2689,
-  0x7d2afc,
-  0x7d3216,
-  0x7d3e63,
-  0x7d4521,
-  0x7d4954,
-  0x7d51be,
-  0x7d5dcb,
-  0x7d606a,
-  0x7d6c1f,
-  0x7d74f5,
-  0x7d7880,
-  0x7d8271,
-  0x7d8e04,
-  0x7d96ee,
-  0x7d9a9b,
-  0x7da73a,
-  0x7dab4f,
-  0x7db3a5,
-  0x7dbfd0,
-  0x7dc492,
-  0x7dc8e7,
-  0x7dd00d,
-  0x7ddc78,
-  0x7de1d9,
-  0x7dedac,
-  0x7df546,
-  0x7df933,
-  0x7e0668,
-  0x7e0a1d,
-  0x7e12f7,
-  0x7e1e82,
-  0x7e2323,
-  0x7e2f56,
-  0x7e37bc,
-  0x7e3bc9,
-  0x7e408b,
-  0x7e4cfe,
-  0x7e5414,
-  0x7e5861,
-  0x7e65c0,
-  0x7e69b5,
-  0x7e715f,
-  0x7e7d2a,
-  0x7e87db,
-  0x7e8bae,
-  0x7e9344,
-  0x7e9f31,
-  0x7ea290,
-  0x7eaee5,
-  0x7eb60f,
-  0x7eba7a,
-  0x7ec138,
-  0x7ecd4d,
-  0x7ed5a7,
-  0x7ed9d2,
-  0x7ee473,
-  0x7ee806,
-  0x7ef0ec,
-  0x7efc99,
-  0x7f050e,
-  0x7f097b,
-  0x7f1191,
-  0x7f1de4,
-  0x7f2045,
-  0x7f2c30,
-  0x7f34da,
-  0x7f38af,
-  0x7f43ed,
-  0x7f4f98,
-  0x7f5772,
-  0x7f5b07,
-  0x7f66a6,
-  0x7f6ad3,
-  0x7f7239,
-  0x7f7e4c,
-  0x7f84bd,
-  0x7f88c8,
-  0x7f9022,
-  0x7f9c57,
-  0x7fa1f6,
-  0x7fad83,
-  0x7fb569,
-  0x7fb91c,
-  0x7fc25e,
-  0x7fce2b,
-  0x7fd6c1,
-  0x7fdab4,
-  0x7fe715,
-  0x7feb60,
-  0x7ff38a,
-  0x7fffff
-};
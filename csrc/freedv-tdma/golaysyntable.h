@@ -0,0 +1,778 @@
+/* Generated by golay23.c -DGOLAY23_MAKETABLES */
+
+static const uint16_t syndrome_table[3][256]={
+  {
+    0x0,
+    0x1,
+    0x2,
+    0x3,
+    0x4,
+    0x5,
+    0x6,
+    0x7,
+    0x8,
+    0x9,
+    0xa,
+    0xb,
+    0xc,
+    0xd,
+    0xe,
+    0xf,
+    0x10,
+    0x11,
+    0x12,
+    0x13,
+    0x14,
+    0x15,
+    0x16,
+    0x17,
+    0x18,
+    0x19,
+    0x1a,
+    0x1b,
+    0x1c,
+    0x1d,
+    0x1e,
+    0x1f,
+    0x20,
+    0x21,
+    0x22,
+    0x23,
+    0x24,
+    0x25,
+    0x26,
+    0x27,
+    0x28,
+    0x29,
+    0x2a,
+    0x2b,
+    0x2c,
+    0x2d,
+    0x2e,
+    0x2f,
+    0x30,
+    0x31,
+    0x32,
+    0x33,
+    0x34,
+    0x35,
+    0x36,
+    0x37,
+    0x38,
+    0x39,
+    0x3a,
+    0x3b,
+    0x3c,
+    0x3d,
+    0x3e,
+    0x3f,
+    0x40,
+    0x41,
+    0x42,
+    0x43,
+    0x44,
+    0x45,
+    0x46,
+    0x47,
+    0x48,
+    0x49,
+    0x4a,
+    0x4b,
+    0x4c,
+    0x4d,
+    0x4e,
+    0x4f,
+    0x50,
+    0x51,
+    0x52,
+    0x53,
+    0x54,
+    0x55,
+    0x56,
+    0x57,
+    0x58,
+    0x59,
+    0x5a,
+    0x5b,
+    0x5c,
+    0x5d,
+    0x5e,
+    0x5f,
+    0x60,
+    0x61,
+    0x62,
+    0x63,
+    0x64,
+    0x65,
+    0x66,
+    0x67,
+    0x68,
+    0x69,
+    0x6a,
+    0x6b,
+    0x6c,
+    0x6d,
+    0x6e,
+    0x6f,
+    0x70,
+    0x71,
+    0x72,
+    0x73,
+    0x74,
+    0x75,
+    0x76,
+    0x77,
+    0x78,
+    0x79,
+    0x7a,
+    0x7b,
+    0x7c,
+    0x7d,
+    0x7e,
+    0x7f,
+    0x80,
+    0x81,
+    0x82,
+    0x83,
+    0x84,
+    0x85,
+    0x86,
+    0x87,
+    0x88,
+    0x89,
+    0x8a,
+    0x8b,
+    0x8c,
+    0x8d,
+    0x8e,
+    0x8f,
+    0x90,
+    0x91,
+    0x92,
+    0x93,
+    0x94,
+    0x95,
+    0x96,
+    0x97,
+    0x98,
+    0x99,
+    0x9a,
+    0x9b,
+    0x9c,
+    0x9d,
+    0x9e,
+    0x9f,
+    0xa0,
+    0xa1,
+    0xa2,
+    0xa3,
+    0xa4,
+    0xa5,
+    0xa6,
+    0xa7,
+    0xa8,
+    0xa9,
+    0xaa,
+    0xab,
+    0xac,
+    0xad,
+    0xae,
+    0xaf,
+    0xb0,
+    0xb1,
+    0xb2,
+    0xb3,
+    0xb4,
+    0xb5,
+    0xb6,
+    0xb7,
+    0xb8,
+    0xb9,
+    0xba,
+    0xbb,
+    0xbc,
+    0xbd,
+    0xbe,
+    0xbf,
+    0xc0,
+    0xc1,
+    0xc2,
+    0xc3,
+    0xc4,
+    0xc5,
+    0xc6,
+    0xc7,
+    0xc8,
+    0xc9,
+    0xca,
+    0xcb,
+    0xcc,
+    0xcd,
+    0xce,
+    0xcf,
+    0xd0,
+    0xd1,
+    0xd2,
+    0xd3,
+    0xd4,
+    0xd5,
+    0xd6,
+    0xd7,
+    0xd8,
+    0xd9,
+    0xda,
+    0xdb,
+    0xdc,
+    0xdd,
+    0xde,
+    0xdf,
+    0xe0,
+    0xe1,
+    0xe2,
+    0xe3,
+    0xe4,
+    0xe5,
+    0xe6,
+    0xe7,
+    0xe8,
+    0xe9,
+    0xea,
+    0xeb,
+    0xec,
+    0xed,
+    0xee,
+    0xef,
+    0xf0,
+    0xf1,
+    0xf2,
+    0xf3,
+    0xf4,
+    0xf5,
+    0xf6,
+    0xf7,
+    0xf8,
+    0xf9,
+    0xfa,
+    0xfb,
+    0xfc,
+    0xfd,
+    0xfe,
+    0xff
+  },
+  {
+    0x0,
+    0x100,
+    0x200,
+    0x300,
+    0x400,
+    0x500,
+    0x600,
+    0x700,
+    0x475,
+    0x575,
+    0x675,
+    0x775,
+    0x75,
+    0x175,
+    0x275,
+    0x375,
+    0x49f,
+    0x59f,
+    0x69f,
+    0x79f,
+    0x9f,
+    0x19f,
+    0x29f,
+    0x39f,
+    0xea,
+    0x1ea,
+    0x2ea,
+    0x3ea,
+    0x4ea,
+    0x5ea,
+    0x6ea,
+    0x7ea,
+    0x54b,
+    0x44b,
+    0x74b,
+    0x64b,
+    0x14b,
+    0x4b,
+    0x34b,
+    0x24b,
+    0x13e,
+    0x3e,
+    0x33e,
+    0x23e,
+    0x53e,
+    0x43e,
+    0x73e,
+    0x63e,
+    0x1d4,
+    0xd4,
+    0x3d4,
+    0x2d4,
+    0x5d4,
+    0x4d4,
+    0x7d4,
+    0x6d4,
+    0x5a1,
+    0x4a1,
+    0x7a1,
+    0x6a1,
+    0x1a1,
+    0xa1,
+    0x3a1,
+    0x2a1,
+    0x6e3,
+    0x7e3,
+    0x4e3,
+    0x5e3,
+    0x2e3,
+    0x3e3,
+    0xe3,
+    0x1e3,
+    0x296,
+    0x396,
+    0x96,
+    0x196,
+    0x696,
+    0x796,
+    0x496,
+    0x596,
+    0x27c,
+    0x37c,
+    0x7c,
+    0x17c,
+    0x67c,
+    0x77c,
+    0x47c,
+    0x57c,
+    0x609,
+    0x709,
+    0x409,
+    0x509,
+    0x209,
+    0x309,
+    0x9,
+    0x109,
+    0x3a8,
+    0x2a8,
+    0x1a8,
+    0xa8,
+    0x7a8,
+    0x6a8,
+    0x5a8,
+    0x4a8,
+    0x7dd,
+    0x6dd,
+    0x5dd,
+    0x4dd,
+    0x3dd,
+    0x2dd,
+    0x1dd,
+    0xdd,
+    0x737,
+    0x637,
+    0x537,
+    0x437,
+    0x337,
+    0x237,
+    0x137,
+    0x37,
+    0x342,
+    0x242,
+    0x142,
+    0x42,
+    0x742,
+    0x642,
+    0x542,
+    0x442,
+    0x1b3,
+    0xb3,
+    0x3b3,
+    0x2b3,
+    0x5b3,
+    0x4b3,
+    0x7b3,
+    0x6b3,
+    0x5c6,
+    0x4c6,
+    0x7c6,
+    0x6c6,
+    0x1c6,
+    0xc6,
+    0x3c6,
+    0x2c6,
+    0x52c,
+    0x42c,
+    0x72c,
+    0x62c,
+    0x12c,
+    0x2c,
+    0x32c,
+    0x22c,
+    0x159,
+    0x59,
+    0x359,
+    0x259,
+    0x559,
+    0x459,
+    0x759,
+    0x659,
+    0x4f8,
+    0x5f8,
+    0x6f8,
+    0x7f8,
+    0xf8,
+    0x1f8,
+    0x2f8,
+    0x3f8,
+    0x8d,
+    0x18d,
+    0x28d,
+    0x38d,
+    0x48d,
+    0x58d,
+    0x68d,
+    0x78d,
+    0x67,
+    0x167,
+    0x267,
+    0x367,
+    0x467,
+    0x567,
+    0x667,
+    0x767,
+    0x412,
+    0x512,
+    0x612,
+    0x712,
+    0x12,
+    0x112,
+    0x212,
+    0x312,
+    0x750,
+    0x650,
+    0x550,
+    0x450,
+    0x350,
+    0x250,
+    0x150,
+    0x50,
+    0x325,
+    0x225,
+    0x125,
+    0x25,
+    0x725,
+    0x625,
+    0x525,
+    0x425,
+    0x3cf,
+    0x2cf,
+    0x1cf,
+    0xcf,
+    0x7cf,
+    0x6cf,
+    0x5cf,
+    0x4cf,
+    0x7ba,
+    0x6ba,
+    0x5ba,
+    0x4ba,
+    0x3ba,
+    0x2ba,
+    0x1ba,
+    0xba,
+    0x21b,
+    0x31b,
+    0x1b,
+    0x11b,
+    0x61b,
+    0x71b,
+    0x41b,
+    0x51b,
+    0x66e,
+    0x76e,
+    0x46e,
+    0x56e,
+    0x26e,
+    0x36e,
+    0x6e,
+    0x16e,
+    0x684,
+    0x784,
+    0x484,
+    0x584,
+    0x284,
+    0x384,
+    0x84,
+    0x184,
+    0x2f1,
+    0x3f1,
+    0xf1,
+    0x1f1,
+    0x6f1,
+    0x7f1,
+    0x4f1,
+    0x5f1
+  },
+  {
+    0x0,
+    0x366,
+    0x6cc,
+    0x5aa,
+    0x1ed,
+    0x28b,
+    0x721,
+    0x447,
+    0x3da,
+    0xbc,
+    0x516,
+    0x670,
+    0x237,
+    0x151,
+    0x4fb,
+    0x79d,
+    0x7b4,
+    0x4d2,
+    0x178,
+    0x21e,
+    0x659,
+    0x53f,
+    0x95,
+    0x3f3,
+    0x46e,
+    0x708,
+    0x2a2,
+    0x1c4,
+    0x583,
+    0x6e5,
+    0x34f,
+    0x29,
+    0x31d,
+    0x7b,
+    0x5d1,
+    0x6b7,
+    0x2f0,
+    0x196,
+    0x43c,
+    0x75a,
+    0xc7,
+    0x3a1,
+    0x60b,
+    0x56d,
+    0x12a,
+    0x24c,
+    0x7e6,
+    0x480,
+    0x4a9,
+    0x7cf,
+    0x265,
+    0x103,
+    0x544,
+    0x622,
+    0x388,
+    0xee,
+    0x773,
+    0x415,
+    0x1bf,
+    0x2d9,
+    0x69e,
+    0x5f8,
+    0x52,
+    0x334,
+    0x63a,
+    0x55c,
+    0xf6,
+    0x390,
+    0x7d7,
+    0x4b1,
+    0x11b,
+    0x27d,
+    0x5e0,
+    0x686,
+    0x32c,
+    0x4a,
+    0x40d,
+    0x76b,
+    0x2c1,
+    0x1a7,
+    0x18e,
+    0x2e8,
+    0x742,
+    0x424,
+    0x63,
+    0x305,
+    0x6af,
+    0x5c9,
+    0x254,
+    0x132,
+    0x498,
+    0x7fe,
+    0x3b9,
+    0xdf,
+    0x575,
+    0x613,
+    0x527,
+    0x641,
+    0x3eb,
+    0x8d,
+    0x4ca,
+    0x7ac,
+    0x206,
+    0x160,
+    0x6fd,
+    0x59b,
+    0x31,
+    0x357,
+    0x710,
+    0x476,
+    0x1dc,
+    0x2ba,
+    0x293,
+    0x1f5,
+    0x45f,
+    0x739,
+    0x37e,
+    0x18,
+    0x5b2,
+    0x6d4,
+    0x149,
+    0x22f,
+    0x785,
+    0x4e3,
+    0xa4,
+    0x3c2,
+    0x668,
+    0x50e,
+    0x0,
+    0x366,
+    0x6cc,
+    0x5aa,
+    0x1ed,
+    0x28b,
+    0x721,
+    0x447,
+    0x3da,
+    0xbc,
+    0x516,
+    0x670,
+    0x237,
+    0x151,
+    0x4fb,
+    0x79d,
+    0x7b4,
+    0x4d2,
+    0x178,
+    0x21e,
+    0x659,
+    0x53f,
+    0x95,
+    0x3f3,
+    0x46e,
+    0x708,
+    0x2a2,
+    0x1c4,
+    0x583,
+    0x6e5,
+    0x34f,
+    0x29,
+    0x31d,
+    0x7b,
+    0x5d1,
+    0x6b7,
+    0x2f0,
+    0x196,
+    0x43c,
+    0x75a,
+    0xc7,
+    0x3a1,
+    0x60b,
+    0x56d,
+    0x12a,
+    0x24c,
+    0x7e6,
+    0x480,
+    0x4a9,
+    0x7cf,
+    0x265,
+    0x103,
+    0x544,
+    0x622,
+    0x388,
+    0xee,
+    0x773,
+    0x415,
+    0x1bf,
+    0x2d9,
+    0x69e,
+    0x5f8,
+    0x52,
+    0x334,
+    0x63a,
+    0x55c,
+    0xf6,
+    0x390,
+    0x7d7,
+    0x4b1,
+    0x11b,
+    0x27d,
+    0x5e0,
+    0x686,
+    0x32c,
+    0x4a,
+    0x40d,
+    0x76b,
+    0x2c1,
+    0x1a7,
+    0x18e,
+    0x2e8,
+    0x742,
+    0x424,
+    0x63,
+    0x305,
+    0x6af,
+    0x5c9,
+    0x254,
+    0x132,
+    0x498,
+    0x7fe,
+    0x3b9,
+    0xdf,
+    0x575,
+    0x613,
+    0x527,
+    0x641,
+    0x3eb,
+    0x8d,
+    0x4ca,
+    0x7ac,
+    0x206,
+    0x160,
+    0x6fd,
+    0x59b,
+    0x31,
+    0x357,
+    0x710,
+    0x476,
+    0x1dc,
+    0x2ba,
+    0x293,
+    0x1f5,
+    0x45f,
+    0x739,
+    0x37e,
+    0x18,
+    0x5b2,
+    0x6d4,
+    0x149,
+    0x22f,
+    0x785,
+    0x4e3,
+    0xa4,
+    0x3c2,
+    0x668,
+    0x50e
+  }
+};
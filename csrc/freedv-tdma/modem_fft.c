@@ -0,0 +1,298 @@
+/*---------------------------------------------------------------------------*\
+
+  FILE........: modem_fft.c
+  AUTHOR......: Brady O'Brien
+  DATE CREATED: 19 October 2026
+
+  Shared FFT plans over FFTW or kiss_fft
+
+\*---------------------------------------------------------------------------*/
+
+/*
+  Copyright (C) 2026 Brady O'Brien
+
+  All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License version 2.1, as
+  published by the Free Software Foundation.  This program is
+  distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include "modem_fft.h"
+#include "kiss_fft.h"
+#include "kiss_fftr.h"
+
+#ifndef MODEM_FFT_NO_FFTW
+#include <fftw3.h>
+#endif
+
+/* Alignment of modem_fft_malloc memory; enough for AVX */
+#define MODEM_FFT_ALIGN 32
+
+struct MODEM_FFT {
+    int n;
+    enum modem_fft_type type;
+    enum modem_fft_backend backend;
+    int refs;
+    bool shared;                    /* In the cache */
+    #ifndef MODEM_FFT_NO_FFTW
+    fftwf_plan plan;
+    #endif
+    kiss_fft_cfg kiss_cfg;
+    kiss_fftr_cfg kissr_cfg;
+    struct MODEM_FFT * next;
+};
+
+/* Guards everything below, and the FFTW planner, which isn't thread safe */
+static pthread_mutex_t modem_fft_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct MODEM_FFT * modem_fft_cache = NULL;
+static bool modem_fft_inited = false;
+static enum modem_fft_backend modem_fft_backend;
+static enum modem_fft_planning modem_fft_planning = MODEM_FFT_ESTIMATE;
+static bool modem_fft_planning_set = false;
+
+static int modem_fft_load_wisdom_locked(const char * path){
+    #ifndef MODEM_FFT_NO_FFTW
+    if(!fftwf_import_wisdom_from_filename(path))
+        return -1;
+    if(!modem_fft_planning_set)
+        modem_fft_planning = MODEM_FFT_WISDOM_ONLY;
+    return 0;
+    #else
+    return -1;
+    #endif
+}
+
+/* Pick up the defaults from the environment, once */
+static void modem_fft_init_locked(void){
+    const char * env;
+    if(modem_fft_inited) return;
+    modem_fft_inited = true;
+
+    #ifndef MODEM_FFT_NO_FFTW
+    modem_fft_backend = MODEM_FFT_FFTW;
+    #else
+    modem_fft_backend = MODEM_FFT_KISS;
+    #endif
+    env = getenv("MODEM_FFT");
+    if(env != NULL && strcmp(env, "kiss") == 0)
+        modem_fft_backend = MODEM_FFT_KISS;
+
+    env = getenv("MODEM_FFT_WISDOM");
+    if(env != NULL && env[0] != 0)
+        modem_fft_load_wisdom_locked(env);
+}
+
+int modem_fft_set_backend(enum modem_fft_backend backend){
+    #ifdef MODEM_FFT_NO_FFTW
+    if(backend == MODEM_FFT_FFTW) return -1;
+    #endif
+    pthread_mutex_lock(&modem_fft_lock);
+    modem_fft_init_locked();
+    modem_fft_backend = backend;
+    pthread_mutex_unlock(&modem_fft_lock);
+    return 0;
+}
+
+enum modem_fft_backend modem_fft_get_backend(void){
+    enum modem_fft_backend backend;
+    pthread_mutex_lock(&modem_fft_lock);
+    modem_fft_init_locked();
+    backend = modem_fft_backend;
+    pthread_mutex_unlock(&modem_fft_lock);
+    return backend;
+}
+
+void modem_fft_set_planning(enum modem_fft_planning planning){
+    pthread_mutex_lock(&modem_fft_lock);
+    modem_fft_planning = planning;
+    modem_fft_planning_set = true;
+    pthread_mutex_unlock(&modem_fft_lock);
+}
+
+int modem_fft_load_wisdom(const char * path){
+    int ret;
+    pthread_mutex_lock(&modem_fft_lock);
+    modem_fft_init_locked();
+    ret = modem_fft_load_wisdom_locked(path);
+    pthread_mutex_unlock(&modem_fft_lock);
+    return ret;
+}
+
+int modem_fft_save_wisdom(const char * path){
+    #ifndef MODEM_FFT_NO_FFTW
+    int ok;
+    pthread_mutex_lock(&modem_fft_lock);
+    ok = fftwf_export_wisdom_to_filename(path);
+    pthread_mutex_unlock(&modem_fft_lock);
+    return ok ? 0 : -1;
+    #else
+    return -1;
+    #endif
+}
+
+#ifndef MODEM_FFT_NO_FFTW
+static fftwf_plan modem_fft_plan_fftw(int n, enum modem_fft_type type, unsigned flags){
+    fftwf_plan plan;
+    /* Measuring scribbles on the arrays, so plan on scratch ones */
+    void * in = fftwf_malloc(sizeof(fftwf_complex)*n);
+    void * out = fftwf_malloc(sizeof(fftwf_complex)*n);
+    if(in == NULL || out == NULL){
+        fftwf_free(in);
+        fftwf_free(out);
+        return NULL;
+    }
+    if(type == MODEM_FFT_C2C)
+        plan = fftwf_plan_dft_1d(n, (fftwf_complex*)in, (fftwf_complex*)out, FFTW_FORWARD, flags);
+    else
+        plan = fftwf_plan_dft_r2c_1d(n, (float*)in, (fftwf_complex*)out, flags);
+    fftwf_free(in);
+    fftwf_free(out);
+    return plan;
+}
+#endif
+
+static struct MODEM_FFT * modem_fft_make(int n, enum modem_fft_type type){
+    struct MODEM_FFT * fft = (struct MODEM_FFT*) calloc(1, sizeof(struct MODEM_FFT));
+    if(fft == NULL) return NULL;
+    fft->n = n;
+    fft->type = type;
+    fft->backend = modem_fft_backend;
+    fft->refs = 1;
+
+    #ifndef MODEM_FFT_NO_FFTW
+    if(fft->backend == MODEM_FFT_FFTW){
+        if(modem_fft_planning == MODEM_FFT_WISDOM_ONLY){
+            fft->plan = modem_fft_plan_fftw(n, type, FFTW_MEASURE | FFTW_WISDOM_ONLY);
+            if(fft->plan == NULL)
+                fft->plan = modem_fft_plan_fftw(n, type, FFTW_ESTIMATE);
+        }else{
+            fft->plan = modem_fft_plan_fftw(n, type, modem_fft_planning == MODEM_FFT_MEASURE ? FFTW_MEASURE : FFTW_ESTIMATE);
+        }
+        if(fft->plan == NULL){
+            free(fft);
+            return NULL;
+        }
+        fft->shared = true;
+        return fft;
+    }
+    #endif
+
+    if(type == MODEM_FFT_C2C){
+        fft->kiss_cfg = kiss_fft_alloc(n, 0, NULL, NULL);
+        fft->shared = true;
+    }else{
+        fft->kissr_cfg = kiss_fftr_alloc(n, 0, NULL, NULL);
+    }
+    if(fft->kiss_cfg == NULL && fft->kissr_cfg == NULL){
+        free(fft);
+        return NULL;
+    }
+    return fft;
+}
+
+modem_fft_t * modem_fft_get(int n, enum modem_fft_type type){
+    struct MODEM_FFT * fft;
+
+    pthread_mutex_lock(&modem_fft_lock);
+    modem_fft_init_locked();
+    for(fft = modem_fft_cache; fft != NULL; fft = fft->next){
+        if(fft->n == n && fft->type == type && fft->backend == modem_fft_backend){
+            fft->refs++;
+            pthread_mutex_unlock(&modem_fft_lock);
+            return fft;
+        }
+    }
+    fft = modem_fft_make(n, type);
+    if(fft != NULL && fft->shared){
+        fft->next = modem_fft_cache;
+        modem_fft_cache = fft;
+    }
+    pthread_mutex_unlock(&modem_fft_lock);
+    return fft;
+}
+
+static void modem_fft_destroy(struct MODEM_FFT * fft){
+    #ifndef MODEM_FFT_NO_FFTW
+    if(fft->plan != NULL)
+        fftwf_destroy_plan(fft->plan);
+    #endif
+    KISS_FFT_FREE(fft->kiss_cfg);
+    KISS_FFT_FREE(fft->kissr_cfg);
+    free(fft);
+}
+
+void modem_fft_put(modem_fft_t * fft){
+    if(fft == NULL) return;
+
+    /* Shared plans stay cached after their last user, ready for the next modem */
+    pthread_mutex_lock(&modem_fft_lock);
+    if(--fft->refs == 0 && !fft->shared)
+        modem_fft_destroy(fft);
+    pthread_mutex_unlock(&modem_fft_lock);
+}
+
+void modem_fft_cleanup(void){
+    struct MODEM_FFT ** p = &modem_fft_cache;
+    struct MODEM_FFT * fft;
+
+    pthread_mutex_lock(&modem_fft_lock);
+    while((fft = *p) != NULL){
+        if(fft->refs == 0){
+            *p = fft->next;
+            modem_fft_destroy(fft);
+        }else{
+            p = &fft->next;
+        }
+    }
+    pthread_mutex_unlock(&modem_fft_lock);
+}
+
+void modem_fft_c2c(modem_fft_t * fft, COMP in[], COMP out[]){
+    #ifndef MODEM_FFT_NO_FFTW
+    if(fft->backend == MODEM_FFT_FFTW){
+        fftwf_execute_dft(fft->plan, (fftwf_complex*)in, (fftwf_complex*)out);
+        return;
+    }
+    #endif
+    kiss_fft(fft->kiss_cfg, (kiss_fft_cpx*)in, (kiss_fft_cpx*)out);
+}
+
+void modem_fft_r2c(modem_fft_t * fft, float in[], COMP out[]){
+    #ifndef MODEM_FFT_NO_FFTW
+    if(fft->backend == MODEM_FFT_FFTW){
+        fftwf_execute_dft_r2c(fft->plan, in, (fftwf_complex*)out);
+        return;
+    }
+    #endif
+    kiss_fftr(fft->kissr_cfg, in, (kiss_fft_cpx*)out);
+}
+
+void * modem_fft_malloc(size_t n){
+    #ifndef MODEM_FFT_NO_FFTW
+    return fftwf_malloc(n);
+    #else
+    void * p;
+    if(posix_memalign(&p, MODEM_FFT_ALIGN, n) != 0) return NULL;
+    return p;
+    #endif
+}
+
+void modem_fft_free(void * p){
+    #ifndef MODEM_FFT_NO_FFTW
+    fftwf_free(p);
+    #else
+    free(p);
+    #endif
+}
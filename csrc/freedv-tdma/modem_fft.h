@@ -0,0 +1,101 @@
+/*---------------------------------------------------------------------------*\
+
+  FILE........: modem_fft.h
+  AUTHOR......: Brady O'Brien
+  DATE CREATED: 19 October 2026
+
+  FFTs for the modem, done by FFTW or kiss_fft as picked at run time.
+  Plans are cached by size and shared, so starting many identical modems
+  plans each size once. FFTW wisdom can be loaded and saved so measured
+  plans don't have to be measured again at every start.
+
+  Define MODEM_FFT_NO_FFTW to build without FFTW.
+
+\*---------------------------------------------------------------------------*/
+
+/*
+  Copyright (C) 2026 Brady O'Brien
+
+  All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License version 2.1, as
+  published by the Free Software Foundation.  This program is
+  distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __MODEM_FFT_H
+#define __MODEM_FFT_H
+
+#include <stddef.h>
+#include "comp.h"
+
+typedef struct MODEM_FFT modem_fft_t;
+
+enum modem_fft_backend {
+    MODEM_FFT_KISS = 0,
+    MODEM_FFT_FFTW
+};
+
+enum modem_fft_type {
+    MODEM_FFT_C2C = 0,              /* Forward complex FFT, n complex out */
+    MODEM_FFT_R2C                   /* Forward real FFT, n/2+1 complex out */
+};
+
+/* How hard FFTW tries when making a plan */
+enum modem_fft_planning {
+    MODEM_FFT_ESTIMATE = 0,         /* Guess; no time spent */
+    MODEM_FFT_MEASURE,              /* Time candidate plans; tens of ms per new size */
+    MODEM_FFT_WISDOM_ONLY           /* Measured plans from loaded wisdom, else estimate */
+};
+
+/*
+ * Choose the backend for plans made from now on. The default is FFTW if it's
+ * built in, unless the MODEM_FFT environment variable is "kiss". Returns -1 if
+ * the backend isn't built in. If MODEM_FFT_WISDOM names a file, it's loaded
+ * before the first plan is made
+ */
+int modem_fft_set_backend(enum modem_fft_backend backend);
+enum modem_fft_backend modem_fft_get_backend(void);
+
+/* Set FFTW planning effort for plans made from now on. Default MODEM_FFT_ESTIMATE */
+void modem_fft_set_planning(enum modem_fft_planning planning);
+
+/*
+ * Load/save FFTW wisdom. Loading switches planning to MODEM_FFT_WISDOM_ONLY
+ * if it's still at the default. Return 0, or -1 on failure or without FFTW
+ */
+int modem_fft_load_wisdom(const char * path);
+int modem_fft_save_wisdom(const char * path);
+
+/*
+ * Get a forward FFT of size n, shared with every other user of the same size,
+ * type and backend. kiss real FFTs aren't shared, as kiss_fftr keeps scratch
+ * space in its state. Returns NULL if it can't be made. Safe to call from any thread
+ */
+modem_fft_t * modem_fft_get(int n, enum modem_fft_type type);
+
+/* Give back an FFT from modem_fft_get. Shared plans are kept for reuse */
+void modem_fft_put(modem_fft_t * fft);
+
+/* Free cached plans that nobody is using */
+void modem_fft_cleanup(void);
+
+/*
+ * Run an FFT. in and out must come from modem_fft_malloc and be different.
+ * Several threads may run the same FFT at once on their own buffers
+ */
+void modem_fft_c2c(modem_fft_t * fft, COMP in[], COMP out[]);
+void modem_fft_r2c(modem_fft_t * fft, float in[], COMP out[]);
+
+/* Memory aligned to suit either backend */
+void * modem_fft_malloc(size_t n);
+void modem_fft_free(void * p);
+
+#endif
@@ -30,6 +30,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include <pthread.h>
 #include "comp.h"
 #include "octave.h"
 
@@ -55,16 +56,22 @@ struct probe_trace_info_s{
 	probe_trace_info *next;
 };
 
+/* One session per process; probe_lock guards it, so modems on any thread can probe */
+static pthread_mutex_t probe_lock = PTHREAD_MUTEX_INITIALIZER;
 static char *run = NULL;
 static char *mod = NULL;
 static probe_trace_info *first_trace = NULL;
 
 /* Init the probing library */
 void modem_probe_init_int(char *modname, char *runname){
-	mod = malloc((strlen(modname)+1)*sizeof(char));
-	run = malloc((strlen(runname)+1)*sizeof(char));
-	strcpy(run,runname);
-	strcpy(mod,modname);
+	pthread_mutex_lock(&probe_lock);
+	if(run == NULL){
+		mod = malloc((strlen(modname)+1)*sizeof(char));
+		run = malloc((strlen(runname)+1)*sizeof(char));
+		strcpy(run,runname);
+		strcpy(mod,modname);
+	}
+	pthread_mutex_unlock(&probe_lock);
 }
 
 /* 
@@ -76,7 +83,7 @@ void * gather_data(datlink * d,size_t * len){
 	datlink * cur = d;
 	datlink * next;
 	while(cur!=NULL){
-		size += d->len;
+		size += cur->len;
 		cur = cur->next;
 	}
 	cur = d;
@@ -97,8 +104,11 @@ void * gather_data(datlink * d,size_t * len){
 
 /* Dump all of the traces into a nice octave-able dump file */
 void modem_probe_close_int(){
-	if(run==NULL)
+	pthread_mutex_lock(&probe_lock);
+	if(run==NULL){
+		pthread_mutex_unlock(&probe_lock);
 		return;
+	}
 	
 	probe_trace_info *cur,*next;
 	cur = first_trace;
@@ -128,10 +138,18 @@ void modem_probe_close_int(){
 	fclose(dumpfile);
 	free(run);
 	free(mod);
+	run = NULL;
+	mod = NULL;
+	first_trace = NULL;
+	pthread_mutex_unlock(&probe_lock);
+}
+
+/* Nothing to set up per thread here */
+void modem_probe_thread_init_int(void){
 }
 
-/* Look up or create a trace by name */
-probe_trace_info * modem_probe_get_trace(char * tracename){
+/* Look up or create a trace by name. Called with probe_lock held */
+static probe_trace_info * modem_probe_get_trace(char * tracename){
 	probe_trace_info *cur,*npti;
 	
 	/* Make sure probe session is open */
@@ -165,9 +183,12 @@ void modem_probe_samp_i_int(char * tracename,int32_t samp[],size_t cnt){
 	probe_trace_info *pti;
 	datlink *ndat;
 	
+	pthread_mutex_lock(&probe_lock);
 	pti = modem_probe_get_trace(tracename);
-	if(pti == NULL)
+	if(pti == NULL){
+		pthread_mutex_unlock(&probe_lock);
 		return;
+	}
 	
 	pti->type = TRACE_I;
 	
@@ -185,6 +206,7 @@ void modem_probe_samp_i_int(char * tracename,int32_t samp[],size_t cnt){
 		pti->data = ndat;
 		pti->last = ndat;
 	}
+	pthread_mutex_unlock(&probe_lock);
 	
 }
 
@@ -192,9 +214,12 @@ void modem_probe_samp_f_int(char * tracename,float samp[],size_t cnt){
 	probe_trace_info *pti;
 	datlink *ndat;
 	
+	pthread_mutex_lock(&probe_lock);
 	pti = modem_probe_get_trace(tracename);
-	if(pti == NULL)
+	if(pti == NULL){
+		pthread_mutex_unlock(&probe_lock);
 		return;
+	}
 	
 	pti->type = TRACE_F;
 	
@@ -212,15 +237,19 @@ void modem_probe_samp_f_int(char * tracename,float samp[],size_t cnt){
 		pti->data = ndat;
 		pti->last = ndat;
 	}
+	pthread_mutex_unlock(&probe_lock);
 }
 	
 void modem_probe_samp_c_int(char * tracename,COMP samp[],size_t cnt){
 	probe_trace_info *pti;
 	datlink *ndat;
 	
+	pthread_mutex_lock(&probe_lock);
 	pti = modem_probe_get_trace(tracename);
-	if(pti == NULL)
+	if(pti == NULL){
+		pthread_mutex_unlock(&probe_lock);
 		return;
+	}
 	
 	pti->type = TRACE_C;
 	
@@ -238,4 +267,5 @@ void modem_probe_samp_c_int(char * tracename,COMP samp[],size_t cnt){
 		pti->data = ndat;
 		pti->last = ndat;
 	}
+	pthread_mutex_unlock(&probe_lock);
 }
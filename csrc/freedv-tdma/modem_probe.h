@@ -41,6 +41,7 @@ void modem_probe_close_int();
 void modem_probe_samp_i_int(char * tracename,int samp[],size_t cnt);
 void modem_probe_samp_f_int(char * tracename,float samp[],size_t cnt);
 void modem_probe_samp_c_int(char * tracename,COMP samp[],size_t cnt);
+void modem_probe_thread_init_int(void);
 
 /* 
  * Init the probe library.
@@ -58,9 +59,21 @@ static inline void modem_probe_close(){
         modem_probe_close_int();
 }
 
+/*
+ * Set up probe buffers for the calling thread. The binary backend allocates
+ * them on a thread's first probe otherwise; call this first from real time
+ * threads. Does nothing in the text backend.
+ */
+static inline void modem_probe_thread_init(){
+        modem_probe_thread_init_int();
+}
+
 /*
  * Save some number of int samples to a named trace
- * char *tracename - name of trace being saved to
+ * char *tracename - name of trace being saved to. The binary backend looks
+ *                   names up by pointer first, so a string literal is cheapest;
+ *                   a buffer that is rewritten with other names still works,
+ *                   but costs a locked lookup whenever the name changes
  * int samp[] - int samples
  * size_t cnt - how many samples to save
  */
@@ -108,6 +121,10 @@ static inline void modem_probe_close(){
         return;
 }
 
+static inline void modem_probe_thread_init(){
+        return;
+}
+
 static inline void modem_probe_samp_i(char *name,int samp[],size_t sampcnt){
         return;
 }
@@ -0,0 +1,416 @@
+/*---------------------------------------------------------------------------*\
+
+  FILE........: modem_probe_bin.c
+  AUTHOR......: Brady O'Brien
+  DATE CREATED: 19 October 2026
+
+  Binary backend for modem_probe, light enough to leave on in the field.
+  Build this instead of modem_probe.c, with MODEMPROBE_ENABLE and
+  MODEMPROBE_BINARY defined.
+
+  Trace names are interned once. Lookups after the first are lock-free and
+  keyed on the name pointer, so passing string constants costs no string
+  compares. Each thread writes typed records into its own preallocated
+  chunks; a flusher thread copies full chunks into a memory-mapped file.
+  A probe call never blocks or allocates once its thread is set up. If
+  the flusher falls behind, records are dropped and counted.
+
+  File layout, all little endian:
+    struct MPB_FILE_HDR
+    a series of blocks, each a struct MPB_BLOCK_HDR then len bytes:
+      MPB_BLOCK_NAMES - struct MPB_NAME entries for newly interned traces
+      MPB_BLOCK_DATA  - records from one thread; each is a struct MPB_REC
+                        then count samples of the trace's type
+      MPB_BLOCK_END   - written on a clean close
+  modem_probe_dump converts a file to text.
+
+\*---------------------------------------------------------------------------*/
+
+/*
+  Copyright (C) 2026 Brady O'Brien
+
+  All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License version 2.1, as
+  published by the Free Software Foundation.  This program is
+  distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "comp.h"
+#include "modem_probe.h"
+#include "modem_probe_bin.h"
+
+/* Most traces that can be interned */
+#define MPB_MAX_TRACES 256
+
+/* Entries in the name pointer cache; power of 2, well above MPB_MAX_TRACES */
+#define MPB_PTR_CACHE 1024
+
+/* Per-thread buffering */
+#define MPB_CHUNK_SIZE (64*1024)
+#define MPB_CHUNKS 8
+
+/* How often the flusher looks for full chunks */
+#define MPB_FLUSH_NS 10000000
+
+/* File size if MODEMPROBE_BIN_MB isn't set in the environment */
+#define MPB_DEFAULT_MB 64
+
+#define MPB_CHUNK_FREE 0            /* Owned by the writing thread */
+#define MPB_CHUNK_READY 1           /* Full, owned by the flusher */
+
+struct mpb_chunk {
+    atomic_int state;
+    uint32_t len;
+    uint32_t seq;
+    uint8_t data[MPB_CHUNK_SIZE];
+};
+
+struct mpb_thread {
+    struct mpb_chunk chunks[MPB_CHUNKS];
+    int cur;                        /* Chunk being written */
+    uint32_t idx;                   /* Thread number in the file */
+    uint32_t chunk_seq;
+    atomic_uint_fast64_t dropped;   /* Records dropped by this thread */
+    struct mpb_thread * next;
+};
+
+struct mpb_ptr_ent {
+    _Atomic(const char *) name;
+    atomic_int id;
+};
+
+static struct {
+    atomic_bool active;
+    unsigned gen;                   /* Bumped at every init, to spot stale thread buffers */
+    pthread_mutex_t lock;           /* Interning, thread list, file writes */
+    struct MPB_NAME traces[MPB_MAX_TRACES];
+    int n_traces;
+    int n_traces_written;
+    struct mpb_ptr_ent ptr_cache[MPB_PTR_CACHE];
+    struct mpb_thread * threads;
+    uint32_t n_threads;
+
+    int fd;
+    uint8_t * map;
+    size_t map_len;
+    size_t used;
+    uint64_t file_dropped;          /* Chunks that didn't fit in the file */
+
+    pthread_t flusher;
+    atomic_bool flusher_run;
+} mpb = { .lock = PTHREAD_MUTEX_INITIALIZER, .fd = -1 };
+
+static _Thread_local struct mpb_thread * mpb_tls = NULL;
+static _Thread_local unsigned mpb_tls_gen = 0;
+
+/* Append a block to the file. Call with mpb.lock held */
+static void mpb_write_block(uint32_t kind, uint32_t thread, uint32_t seq, const void * data, uint32_t len){
+    struct MPB_BLOCK_HDR hdr;
+    if(mpb.used + sizeof(hdr) + len > mpb.map_len){
+        mpb.file_dropped++;
+        return;
+    }
+    hdr.magic = MPB_BLOCK_MAGIC;
+    hdr.kind = kind;
+    hdr.thread = thread;
+    hdr.seq = seq;
+    hdr.len = len;
+    hdr.rsvd = 0;
+    memcpy(&mpb.map[mpb.used], &hdr, sizeof(hdr));
+    if(len > 0)
+        memcpy(&mpb.map[mpb.used + sizeof(hdr)], data, len);
+    mpb.used += sizeof(hdr) + ((len+7) & ~7U);
+}
+
+/* Move everything that's ready into the file. If final, take partly filled chunks as well */
+static void mpb_flush(bool final){
+    struct mpb_thread * t;
+    int i;
+
+    pthread_mutex_lock(&mpb.lock);
+    if(mpb.n_traces_written < mpb.n_traces){
+        mpb_write_block(MPB_BLOCK_NAMES, 0, 0, &mpb.traces[mpb.n_traces_written],
+            (mpb.n_traces - mpb.n_traces_written)*sizeof(struct MPB_NAME));
+        mpb.n_traces_written = mpb.n_traces;
+    }
+    for(t = mpb.threads; t != NULL; t = t->next){
+        /* Chunks can go out of order; the reader sorts them by seq */
+        for(i = 0; i < MPB_CHUNKS; i++){
+            struct mpb_chunk * c = &t->chunks[i];
+            int st = atomic_load_explicit(&c->state, memory_order_acquire);
+            if(st != MPB_CHUNK_READY && final && c->len > 0)
+                c->seq = t->chunk_seq++;
+            if(st == MPB_CHUNK_READY || (final && c->len > 0)){
+                mpb_write_block(MPB_BLOCK_DATA, t->idx, c->seq, c->data, c->len);
+                c->len = 0;
+                atomic_store_explicit(&c->state, MPB_CHUNK_FREE, memory_order_release);
+            }
+        }
+    }
+    pthread_mutex_unlock(&mpb.lock);
+}
+
+static void * mpb_flusher(void * arg){
+    struct timespec ts = {0, MPB_FLUSH_NS};
+    (void)arg;
+    while(atomic_load_explicit(&mpb.flusher_run, memory_order_relaxed)){
+        nanosleep(&ts, NULL);
+        mpb_flush(false);
+    }
+    return NULL;
+}
+
+/* Set up this thread's buffers. Allocates, so do it before real time work with modem_probe_thread_init */
+static struct mpb_thread * mpb_thread_get(void){
+    struct mpb_thread * t;
+    int i;
+
+    if(mpb_tls != NULL && mpb_tls_gen == mpb.gen)
+        return mpb_tls;
+
+    t = (struct mpb_thread*) calloc(1, sizeof(struct mpb_thread));
+    if(t == NULL) return NULL;
+    for(i = 0; i < MPB_CHUNKS; i++)
+        atomic_init(&t->chunks[i].state, MPB_CHUNK_FREE);
+    atomic_init(&t->dropped, 0);
+
+    pthread_mutex_lock(&mpb.lock);
+    t->idx = mpb.n_threads++;
+    t->next = mpb.threads;
+    mpb.threads = t;
+    pthread_mutex_unlock(&mpb.lock);
+
+    mpb_tls = t;
+    mpb_tls_gen = mpb.gen;
+    return t;
+}
+
+/* Find the id of a trace, interning it on first use. Returns -1 if the table is full */
+static int mpb_intern(const char * name, uint8_t type){
+    size_t mask = MPB_PTR_CACHE-1;
+    size_t h = (((uintptr_t)name >> 3) * 0x9E3779B97F4A7C15ULL) >> 54;
+    size_t k;
+    int id = -1, i;
+
+    /* Fast path: we've seen this exact pointer before. A buffer can be reused for
+       another name, so the name has to still match too */
+    for(k = 0; k < MPB_PTR_CACHE; k++){
+        struct mpb_ptr_ent * e = &mpb.ptr_cache[(h+k) & mask];
+        const char * p = atomic_load_explicit(&e->name, memory_order_acquire);
+        if(p == name){
+            id = atomic_load_explicit(&e->id, memory_order_acquire);
+            if(strncmp(mpb.traces[id].name, name, MPB_NAME_LEN-1) == 0)
+                return id;
+            id = -1;
+            break;
+        }
+        if(p == NULL) break;
+    }
+
+    pthread_mutex_lock(&mpb.lock);
+    for(i = 0; i < mpb.n_traces; i++){
+        if(strncmp(mpb.traces[i].name, name, MPB_NAME_LEN-1) == 0){
+            id = i;
+            break;
+        }
+    }
+    if(id < 0 && mpb.n_traces < MPB_MAX_TRACES){
+        id = mpb.n_traces;
+        mpb.traces[id].id = id;
+        mpb.traces[id].type = type;
+        strncpy(mpb.traces[id].name, name, MPB_NAME_LEN-1);
+        mpb.traces[id].name[MPB_NAME_LEN-1] = 0;
+        mpb.n_traces++;
+    }
+    /* Remember the pointer. Names built on the stack would fill this up, hence the limit */
+    if(id >= 0){
+        for(k = 0; k < MPB_PTR_CACHE/2; k++){
+            struct mpb_ptr_ent * e = &mpb.ptr_cache[(h+k) & mask];
+            const char * p = atomic_load_explicit(&e->name, memory_order_relaxed);
+            if(p == name){
+                atomic_store_explicit(&e->id, id, memory_order_release);
+                break;
+            }
+            if(p == NULL){
+                atomic_store_explicit(&e->id, id, memory_order_relaxed);
+                atomic_store_explicit(&e->name, name, memory_order_release);
+                break;
+            }
+        }
+    }
+    pthread_mutex_unlock(&mpb.lock);
+    return id;
+}
+
+/* Write one record into this thread's buffer */
+static void mpb_put(const char * name, uint8_t type, const void * samps, size_t cnt, size_t samp_size){
+    struct mpb_thread * t;
+    struct mpb_chunk * c;
+    struct MPB_REC rec;
+    size_t need = sizeof(rec) + cnt*samp_size;
+
+    if(!atomic_load_explicit(&mpb.active, memory_order_relaxed))
+        return;
+    t = mpb_thread_get();
+    if(t == NULL) return;
+
+    int id = mpb_intern(name, type);
+    if(id < 0 || need > MPB_CHUNK_SIZE){
+        atomic_fetch_add_explicit(&t->dropped, 1, memory_order_relaxed);
+        return;
+    }
+
+    c = &t->chunks[t->cur];
+    if(atomic_load_explicit(&c->state, memory_order_acquire) != MPB_CHUNK_FREE){
+        atomic_fetch_add_explicit(&t->dropped, 1, memory_order_relaxed);
+        return;
+    }
+    /* Hand a full chunk to the flusher and move on */
+    if(c->len + need > MPB_CHUNK_SIZE){
+        c->seq = t->chunk_seq++;
+        atomic_store_explicit(&c->state, MPB_CHUNK_READY, memory_order_release);
+        t->cur = (t->cur + 1) % MPB_CHUNKS;
+        c = &t->chunks[t->cur];
+        if(atomic_load_explicit(&c->state, memory_order_acquire) != MPB_CHUNK_FREE){
+            atomic_fetch_add_explicit(&t->dropped, 1, memory_order_relaxed);
+            return;
+        }
+    }
+
+    rec.id = (uint16_t)id;
+    rec.type = type;
+    rec.rsvd = 0;
+    rec.count = (uint32_t)cnt;
+    memcpy(&c->data[c->len], &rec, sizeof(rec));
+    memcpy(&c->data[c->len + sizeof(rec)], samps, cnt*samp_size);
+    c->len += need;
+}
+
+void modem_probe_init_int(char *modname, char *runname){
+    struct MPB_FILE_HDR hdr;
+    const char * mb_env = getenv("MODEMPROBE_BIN_MB");
+    size_t mb = mb_env != NULL ? strtoul(mb_env, NULL, 0) : MPB_DEFAULT_MB;
+
+    if(atomic_load(&mpb.active) || mb == 0)
+        return;
+
+    mpb.fd = open(runname, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if(mpb.fd < 0){
+        perror("modem_probe: open");
+        return;
+    }
+    mpb.map_len = mb << 20;
+    if(ftruncate(mpb.fd, mpb.map_len) != 0){
+        perror("modem_probe: ftruncate");
+        close(mpb.fd);
+        mpb.fd = -1;
+        return;
+    }
+    mpb.map = (uint8_t*) mmap(NULL, mpb.map_len, PROT_READ | PROT_WRITE, MAP_SHARED, mpb.fd, 0);
+    if(mpb.map == MAP_FAILED){
+        perror("modem_probe: mmap");
+        close(mpb.fd);
+        mpb.fd = -1;
+        mpb.map = NULL;
+        return;
+    }
+
+    memset(&hdr, 0, sizeof(hdr));
+    memcpy(hdr.magic, MPB_FILE_MAGIC, sizeof(hdr.magic));
+    hdr.version = MPB_VERSION;
+    strncpy(hdr.modname, modname, sizeof(hdr.modname)-1);
+    memcpy(mpb.map, &hdr, sizeof(hdr));
+    mpb.used = sizeof(hdr);
+
+    mpb.n_traces = 0;
+    mpb.n_traces_written = 0;
+    memset(mpb.ptr_cache, 0, sizeof(mpb.ptr_cache));
+    mpb.threads = NULL;
+    mpb.n_threads = 0;
+    mpb.file_dropped = 0;
+    mpb.gen++;
+
+    atomic_store(&mpb.flusher_run, true);
+    if(pthread_create(&mpb.flusher, NULL, mpb_flusher, NULL) != 0){
+        munmap(mpb.map, mpb.map_len);
+        close(mpb.fd);
+        mpb.fd = -1;
+        mpb.map = NULL;
+        return;
+    }
+    atomic_store(&mpb.active, true);
+}
+
+void modem_probe_close_int(){
+    struct mpb_thread * t, * next;
+    uint64_t dropped = 0;
+
+    if(!atomic_load(&mpb.active))
+        return;
+
+    /* Nothing may still be probing by now */
+    atomic_store(&mpb.active, false);
+    atomic_store(&mpb.flusher_run, false);
+    pthread_join(mpb.flusher, NULL);
+    mpb_flush(true);
+
+    for(t = mpb.threads; t != NULL; t = t->next)
+        dropped += atomic_load(&t->dropped);
+    pthread_mutex_lock(&mpb.lock);
+    mpb_write_block(MPB_BLOCK_END, 0, 0, &dropped, sizeof(dropped));
+    pthread_mutex_unlock(&mpb.lock);
+
+    msync(mpb.map, mpb.used, MS_SYNC);
+    munmap(mpb.map, mpb.map_len);
+    if(ftruncate(mpb.fd, mpb.used) != 0)
+        perror("modem_probe: ftruncate");
+    close(mpb.fd);
+    mpb.fd = -1;
+    mpb.map = NULL;
+
+    if(dropped > 0 || mpb.file_dropped > 0)
+        fprintf(stderr,"modem_probe: dropped %llu records, %llu blocks\n",
+            (unsigned long long)dropped,(unsigned long long)mpb.file_dropped);
+
+    for(t = mpb.threads; t != NULL; t = next){
+        next = t->next;
+        free(t);
+    }
+    mpb.threads = NULL;
+}
+
+void modem_probe_thread_init_int(void){
+    if(atomic_load_explicit(&mpb.active, memory_order_relaxed))
+        mpb_thread_get();
+}
+
+void modem_probe_samp_i_int(char * tracename,int32_t samp[],size_t cnt){
+    mpb_put(tracename, MPB_TYPE_I, samp, cnt, sizeof(int32_t));
+}
+
+void modem_probe_samp_f_int(char * tracename,float samp[],size_t cnt){
+    mpb_put(tracename, MPB_TYPE_F, samp, cnt, sizeof(float));
+}
+
+void modem_probe_samp_c_int(char * tracename,COMP samp[],size_t cnt){
+    mpb_put(tracename, MPB_TYPE_C, samp, cnt, sizeof(COMP));
+}
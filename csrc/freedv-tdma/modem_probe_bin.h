@@ -0,0 +1,81 @@
+/*---------------------------------------------------------------------------*\
+
+  FILE........: modem_probe_bin.h
+  AUTHOR......: Brady O'Brien
+  DATE CREATED: 19 October 2026
+
+  File format written by the binary modem_probe backend
+
+\*---------------------------------------------------------------------------*/
+
+/*
+  Copyright (C) 2026 Brady O'Brien
+
+  All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License version 2.1, as
+  published by the Free Software Foundation.  This program is
+  distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __MODEMPROBE_BIN_H
+#define __MODEMPROBE_BIN_H
+
+#include <stdint.h>
+
+#define MPB_FILE_MAGIC "MPROBEB1"
+#define MPB_VERSION 1
+#define MPB_BLOCK_MAGIC 0x4B4C424DU    /* "MBLK" */
+
+/* Block kinds */
+#define MPB_BLOCK_NAMES 1
+#define MPB_BLOCK_DATA 2
+#define MPB_BLOCK_END 3
+
+/* Sample types */
+#define MPB_TYPE_I 1                    /* int32_t */
+#define MPB_TYPE_F 2                    /* float */
+#define MPB_TYPE_C 3                    /* COMP; float real, imag */
+
+#define MPB_NAME_LEN 32
+
+struct MPB_FILE_HDR {
+    char magic[8];
+    uint32_t version;
+    uint32_t rsvd;
+    char modname[48];
+};
+
+/* Blocks start 8 byte aligned; len doesn't include padding */
+struct MPB_BLOCK_HDR {
+    uint32_t magic;
+    uint32_t kind;
+    uint32_t thread;                    /* Writing thread, for data blocks */
+    uint32_t seq;                       /* Per-thread block order, for data blocks */
+    uint32_t len;
+    uint32_t rsvd;
+};
+
+struct MPB_NAME {
+    uint16_t id;
+    uint8_t type;
+    uint8_t rsvd;
+    char name[MPB_NAME_LEN];
+};
+
+/* Record header in a data block; count samples follow */
+struct MPB_REC {
+    uint16_t id;
+    uint8_t type;
+    uint8_t rsvd;
+    uint32_t count;
+};
+
+#endif
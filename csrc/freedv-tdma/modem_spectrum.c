@@ -0,0 +1,303 @@
+/*---------------------------------------------------------------------------*\
+
+  FILE........: modem_spectrum.c
+  AUTHOR......: Brady O'Brien
+  DATE CREATED: 19 October 2026
+
+  Streaming spectrum for waterfall displays
+
+\*---------------------------------------------------------------------------*/
+
+/*
+  Copyright (C) 2026 Brady O'Brien
+
+  All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License version 2.1, as
+  published by the Free Software Foundation.  This program is
+  distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <stdatomic.h>
+#include "modem_spectrum.h"
+#include "codec2_fdmdv.h"
+#include "tdma_ring.h"
+#include "modem_fft.h"
+
+/* Samples per block handed to the worker thread */
+#define SPEC_BLOCK_LEN 256
+
+struct SPEC_BLOCK {
+    int n;
+    COMP samp[SPEC_BLOCK_LEN];
+};
+
+struct MODEM_SPECTRUM {
+    struct MODEM_SPECTRUM_CONFIG cfg;
+    int nbins_fft;                  /* Useful FFT bins: nfft complex, nfft/2 real */
+    int nbins;                      /* Output bins, nbins_fft/decim */
+    float full_scale_dB;
+
+    float * window;                 /* Hann window, nfft */
+    COMP * hist;                    /* Last nfft input samples, oldest at hist_pos */
+    int hist_pos;
+    int since_fft;                  /* Samples pushed since the last FFT */
+    float * avg;                    /* Summed power of this line so far, nbins_fft */
+    int n_summed;
+
+    modem_fft_t * fft;
+    void * fft_in;                  /* float[nfft] for real input, complex otherwise */
+    COMP * fft_out;
+
+    tdma_ring_t * lines;            /* Finished lines, nbins floats each */
+    atomic_uint_fast64_t dropped_lines;
+
+    /* Worker thread */
+    tdma_ring_t * blocks;
+    sem_t wake;
+    pthread_t worker;
+    atomic_bool stop;
+    atomic_uint_fast64_t dropped_samps;
+};
+
+/* log2 to about 0.005, good for a display and much cheaper than log10f */
+static inline float spec_log2f(float x){
+    union { float f; uint32_t i; } v = { .f = x };
+    float e = (float)((int)((v.i >> 23) & 0xff) - 127);
+    v.i = (v.i & 0x007fffff) | 0x3f800000;
+    return e + (-0.34484843f*v.f + 2.02466578f)*v.f - 0.67487759f;
+}
+
+void modem_spectrum_default_config(struct MODEM_SPECTRUM_CONFIG * cfg){
+    cfg->nfft = 2*MODEM_STATS_NSPEC;
+    cfg->complex_input = 0;
+    cfg->hop = MODEM_STATS_NSPEC;
+    cfg->n_avg = 1;
+    cfg->decim = 1;
+    cfg->n_lines = 16;
+    cfg->full_scale = FDMDV_SCALE;
+    cfg->threaded = 0;
+}
+
+static void spec_line(modem_spectrum_t * spec){
+    int i, j;
+    int decim = spec->cfg.decim;
+    float * line = (float*) tdma_ring_write_acquire(spec->lines);
+
+    if(line == NULL){
+        atomic_fetch_add_explicit(&spec->dropped_lines, 1, memory_order_relaxed);
+    }else{
+        /* One log per output bin, after averaging and decimation */
+        float scale = 1.0f/spec->n_summed;
+        for(i = 0; i < spec->nbins; i++){
+            float p = spec->avg[i*decim];
+            for(j = 1; j < decim; j++)
+                if(spec->avg[i*decim+j] > p) p = spec->avg[i*decim+j];
+            line[i] = 3.0103f*spec_log2f(p*scale + 1E-12f) - spec->full_scale_dB;
+        }
+        tdma_ring_write_commit(spec->lines);
+    }
+    memset(spec->avg, 0, sizeof(float)*spec->nbins_fft);
+    spec->n_summed = 0;
+}
+
+static void spec_fft(modem_spectrum_t * spec){
+    int nfft = spec->cfg.nfft;
+    int i, k;
+    int pos = spec->hist_pos;
+    COMP * hist = spec->hist;
+    float * w = spec->window;
+
+    /* Window the history, oldest first, in the two runs either side of the wrap */
+    if(spec->cfg.complex_input){
+        COMP * in = (COMP*) spec->fft_in;
+        for(i = 0, k = pos; k < nfft; i++, k++){
+            in[i].real = hist[k].real*w[i];
+            in[i].imag = hist[k].imag*w[i];
+        }
+        for(k = 0; k < pos; i++, k++){
+            in[i].real = hist[k].real*w[i];
+            in[i].imag = hist[k].imag*w[i];
+        }
+    }else{
+        float * in = (float*) spec->fft_in;
+        for(i = 0, k = pos; k < nfft; i++, k++)
+            in[i] = hist[k].real*w[i];
+        for(k = 0; k < pos; i++, k++)
+            in[i] = hist[k].real*w[i];
+    }
+
+    if(spec->cfg.complex_input)
+        modem_fft_c2c(spec->fft, (COMP*)spec->fft_in, spec->fft_out);
+    else
+        modem_fft_r2c(spec->fft, (float*)spec->fft_in, spec->fft_out);
+
+    /* Complex spectrum is rotated so DC is in the middle */
+    COMP * out = spec->fft_out;
+    int rot = spec->cfg.complex_input ? nfft/2 : 0;
+    for(i = 0; i < spec->nbins_fft; i++){
+        COMP c = out[(i + rot) & (nfft-1)];
+        spec->avg[i] += c.real*c.real + c.imag*c.imag;
+    }
+
+    if(++spec->n_summed == spec->cfg.n_avg)
+        spec_line(spec);
+}
+
+/* Run samples through the history, doing an FFT every hop */
+static void spec_feed(modem_spectrum_t * spec, const COMP in[], int n){
+    int nfft = spec->cfg.nfft;
+    while(n > 0){
+        int m = spec->cfg.hop - spec->since_fft;
+        if(m > n) m = n;
+        if(m > nfft - spec->hist_pos) m = nfft - spec->hist_pos;
+        memcpy(&spec->hist[spec->hist_pos], in, sizeof(COMP)*m);
+        spec->hist_pos = (spec->hist_pos + m) & (nfft-1);
+        spec->since_fft += m;
+        in += m;
+        n -= m;
+        if(spec->since_fft == spec->cfg.hop){
+            spec->since_fft = 0;
+            spec_fft(spec);
+        }
+    }
+}
+
+static void * spec_worker(void * arg){
+    modem_spectrum_t * spec = (modem_spectrum_t*) arg;
+    struct SPEC_BLOCK * blk;
+    while(true){
+        sem_wait(&spec->wake);
+        while((blk = (struct SPEC_BLOCK*) tdma_ring_read_acquire(spec->blocks)) != NULL){
+            spec_feed(spec, blk->samp, blk->n);
+            tdma_ring_read_release(spec->blocks);
+        }
+        if(atomic_load_explicit(&spec->stop, memory_order_acquire))
+            break;
+    }
+    return NULL;
+}
+
+modem_spectrum_t * modem_spectrum_create(const struct MODEM_SPECTRUM_CONFIG * cfg){
+    modem_spectrum_t * spec;
+    int nfft = cfg->nfft;
+    int i;
+
+    if(nfft < 4 || (nfft & (nfft-1)) != 0) return NULL;
+    if(cfg->hop < 1 || cfg->n_avg < 1 || cfg->decim < 1 || cfg->n_lines < 1) return NULL;
+
+    spec = (modem_spectrum_t*) calloc(1, sizeof(modem_spectrum_t));
+    if(spec == NULL) return NULL;
+    spec->cfg = *cfg;
+    spec->nbins_fft = cfg->complex_input ? nfft : nfft/2;
+    spec->nbins = spec->nbins_fft/cfg->decim;
+    if(spec->nbins < 1) goto cleanup;
+
+    /* FFT scales up a signal of level 1 by nfft/2 */
+    spec->full_scale_dB = 20*log10f((nfft/2)*cfg->full_scale);
+
+    spec->window = (float*) malloc(sizeof(float)*nfft);
+    spec->hist = (COMP*) calloc(nfft, sizeof(COMP));
+    spec->avg = (float*) calloc(spec->nbins_fft, sizeof(float));
+    spec->lines = tdma_ring_create(cfg->n_lines, sizeof(float)*spec->nbins);
+    if(spec->window == NULL || spec->hist == NULL || spec->avg == NULL || spec->lines == NULL)
+        goto cleanup;
+
+    for(i = 0; i < nfft; i++)
+        spec->window[i] = 0.5 - 0.5*cosf((float)i*2.0*M_PI/nfft);
+
+    spec->fft_in = modem_fft_malloc(cfg->complex_input ? sizeof(COMP)*nfft : sizeof(float)*nfft);
+    spec->fft_out = (COMP*) modem_fft_malloc(sizeof(COMP)*nfft);
+    spec->fft = modem_fft_get(nfft, cfg->complex_input ? MODEM_FFT_C2C : MODEM_FFT_R2C);
+    if(spec->fft_in == NULL || spec->fft_out == NULL || spec->fft == NULL) goto cleanup;
+
+    atomic_init(&spec->dropped_lines, 0);
+    atomic_init(&spec->dropped_samps, 0);
+    atomic_init(&spec->stop, false);
+
+    if(cfg->threaded){
+        /* Room for a few FFTs worth of input */
+        spec->blocks = tdma_ring_create(4*(nfft + SPEC_BLOCK_LEN - 1)/SPEC_BLOCK_LEN, sizeof(struct SPEC_BLOCK));
+        if(spec->blocks == NULL) goto cleanup;
+        if(sem_init(&spec->wake, 0, 0) != 0) goto cleanup;
+        if(pthread_create(&spec->worker, NULL, spec_worker, spec) != 0){
+            sem_destroy(&spec->wake);
+            goto cleanup;
+        }
+    }
+    return spec;
+
+    cleanup:
+    spec->cfg.threaded = 0;
+    modem_spectrum_destroy(spec);
+    return NULL;
+}
+
+void modem_spectrum_destroy(modem_spectrum_t * spec){
+    if(spec == NULL) return;
+    if(spec->cfg.threaded){
+        atomic_store_explicit(&spec->stop, true, memory_order_release);
+        sem_post(&spec->wake);
+        pthread_join(spec->worker, NULL);
+        sem_destroy(&spec->wake);
+    }
+    tdma_ring_destroy(spec->blocks);
+    tdma_ring_destroy(spec->lines);
+    modem_fft_put(spec->fft);
+    modem_fft_free(spec->fft_in);
+    modem_fft_free(spec->fft_out);
+    free(spec->window);
+    free(spec->hist);
+    free(spec->avg);
+    free(spec);
+}
+
+int modem_spectrum_bins(modem_spectrum_t * spec){
+    return spec->nbins;
+}
+
+void modem_spectrum_push(modem_spectrum_t * spec, const COMP in[], int n){
+    if(!spec->cfg.threaded){
+        spec_feed(spec, in, n);
+        return;
+    }
+
+    while(n > 0){
+        int m = n < SPEC_BLOCK_LEN ? n : SPEC_BLOCK_LEN;
+        struct SPEC_BLOCK * blk = (struct SPEC_BLOCK*) tdma_ring_write_acquire(spec->blocks);
+        if(blk == NULL){
+            atomic_fetch_add_explicit(&spec->dropped_samps, n, memory_order_relaxed);
+            break;
+        }
+        blk->n = m;
+        memcpy(blk->samp, in, sizeof(COMP)*m);
+        tdma_ring_write_commit(spec->blocks);
+        in += m;
+        n -= m;
+    }
+    sem_post(&spec->wake);
+}
+
+bool modem_spectrum_read(modem_spectrum_t * spec, float mag_dB[]){
+    return tdma_ring_pop(spec->lines, mag_dB);
+}
+
+uint64_t modem_spectrum_dropped_samps(modem_spectrum_t * spec){
+    return atomic_load_explicit(&spec->dropped_samps, memory_order_relaxed);
+}
+
+uint64_t modem_spectrum_dropped_lines(modem_spectrum_t * spec){
+    return atomic_load_explicit(&spec->dropped_lines, memory_order_relaxed);
+}
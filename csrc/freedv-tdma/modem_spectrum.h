@@ -0,0 +1,74 @@
+/*---------------------------------------------------------------------------*\
+
+  FILE........: modem_spectrum.h
+  AUTHOR......: Brady O'Brien
+  DATE CREATED: 19 October 2026
+
+  Streaming spectrum for waterfall displays. Samples are pushed in any
+  block size; windowed, overlapped FFTs are averaged into lines of dB
+  that a display thread reads out.
+
+\*---------------------------------------------------------------------------*/
+
+/*
+  Copyright (C) 2026 Brady O'Brien
+
+  All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License version 2.1, as
+  published by the Free Software Foundation.  This program is
+  distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __MODEM_SPECTRUM_H
+#define __MODEM_SPECTRUM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "comp.h"
+
+typedef struct MODEM_SPECTRUM modem_spectrum_t;
+
+struct MODEM_SPECTRUM_CONFIG {
+    int nfft;               /* FFT length, a power of 2 */
+    int complex_input;      /* FFT the complex input, giving nfft bins centred on DC. Otherwise
+                               only the real part is used, giving nfft/2 bins from DC up */
+    int hop;                /* New samples between FFTs; nfft/2 is 50% overlap */
+    int n_avg;              /* FFTs power averaged into each output line */
+    int decim;              /* Adjacent bins merged into each output bin, keeping the peak */
+    int n_lines;            /* Output lines buffered for the reader */
+    float full_scale;       /* Input amplitude that reads as 0dB */
+    int threaded;           /* Run the FFTs on a worker thread instead of in modem_spectrum_push */
+};
+
+/* Fill in cfg with the same spectrum modem_stats_get_rx_spectrum gives */
+void modem_spectrum_default_config(struct MODEM_SPECTRUM_CONFIG * cfg);
+
+/* Returns NULL if cfg doesn't make sense or allocation fails */
+modem_spectrum_t * modem_spectrum_create(const struct MODEM_SPECTRUM_CONFIG * cfg);
+
+void modem_spectrum_destroy(modem_spectrum_t * spec);
+
+/* Number of floats in each output line */
+int modem_spectrum_bins(modem_spectrum_t * spec);
+
+/* Feed n samples in. Never blocks; with a worker thread, samples that don't fit
+    in its queue are dropped and counted. Only one thread may push */
+void modem_spectrum_push(modem_spectrum_t * spec, const COMP in[], int n);
+
+/* Take the oldest finished line, modem_spectrum_bins floats of dB. Returns false
+    if there isn't one. Only one thread may read */
+bool modem_spectrum_read(modem_spectrum_t * spec, float mag_dB[]);
+
+/* Input samples and output lines dropped because a queue was full */
+uint64_t modem_spectrum_dropped_samps(modem_spectrum_t * spec);
+uint64_t modem_spectrum_dropped_lines(modem_spectrum_t * spec);
+
+#endif
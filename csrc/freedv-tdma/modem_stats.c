@@ -27,9 +27,22 @@
 
 #include <assert.h>
 #include <math.h>
+#include <string.h>
+#include <pthread.h>
 #include "modem_stats.h"
 #include "codec2_fdmdv.h"
 
+/* Hann window for the spectrum, shared by every MODEM_STATS */
+static float modem_stats_window[2*MODEM_STATS_NSPEC];
+static pthread_once_t modem_stats_window_once = PTHREAD_ONCE_INIT;
+
+static void modem_stats_window_init(void)
+{
+    int i;
+    for(i=0; i<2*MODEM_STATS_NSPEC; i++)
+	modem_stats_window[i] = 0.5 - 0.5*cosf((float)i*2.0*M_PI/(2*MODEM_STATS_NSPEC));
+}
+
 void modem_stats_open(struct MODEM_STATS *f)
 {
     int i;
@@ -44,6 +57,7 @@ void modem_stats_open(struct MODEM_STATS *f)
 	f->fft_buf[i] = 0.0;
     f->fft_cfg = kiss_fft_alloc (2*MODEM_STATS_NSPEC, 0, NULL, NULL);
     assert(f->fft_cfg != NULL);
+    pthread_once(&modem_stats_window_once, modem_stats_window_init);
 
 }
 
@@ -67,7 +81,8 @@ void modem_stats_close(struct MODEM_STATS *f)
   with the other rx signal procesing.
 
   Successive calls can be used to build up a waterfall or spectrogram
-  plot, by mapping the received levels to colours.
+  plot, by mapping the received levels to colours. modem_spectrum.h
+  does this more cheaply for streams of samples.
 
   The time-frequency resolution of the spectrum can be adjusted by varying
   MODEM_STATS_NSPEC.  Note that a 2* MODEM_STATS_NSPEC size FFT is reqd to get
@@ -90,8 +105,8 @@ void modem_stats_get_rx_spectrum(struct MODEM_STATS *f, float mag_spec_dB[], COM
 
     /* update buffer of input samples */
 
-    for(i=0; i<2*MODEM_STATS_NSPEC-nin; i++)
-	f->fft_buf[i] = f->fft_buf[i+nin];
+    i = 2*MODEM_STATS_NSPEC-nin;
+    memmove(&f->fft_buf[0], &f->fft_buf[nin], sizeof(float)*i);
     for(j=0; j<nin; j++,i++)
 	f->fft_buf[i] = rx_fdm[j].real;
     assert(i == 2*MODEM_STATS_NSPEC);
@@ -99,7 +114,7 @@ void modem_stats_get_rx_spectrum(struct MODEM_STATS *f, float mag_spec_dB[], COM
     /* window and FFT */
 
     for(i=0; i<2*MODEM_STATS_NSPEC; i++) {
-	fft_in[i].real = f->fft_buf[i] * (0.5 - 0.5*cosf((float)i*2.0*M_PI/(2*MODEM_STATS_NSPEC)));
+	fft_in[i].real = f->fft_buf[i] * modem_stats_window[i];
 	fft_in[i].imag = 0.0;
     }
 
@@ -33,6 +33,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <math.h>
 
 /* Easy handle to enable/disable a whole slew of debug printouts */
 //#define VERY_DEBUG 1
@@ -45,6 +46,34 @@ static const uint8_t TDMA_UW_D[] =    {1,1,1,1,0,0,0,1,
                                        
 static const uint8_t * TDMA_UW_LIST_A[] = {&TDMA_UW_V[0],&TDMA_UW_D[0]};
 
+/* Control commands waiting to be applied at the next slot boundary. Any thread may
+    queue them; only tdma_rx takes them off. Must be a power of two */
+#define TDMA_CMD_QUEUE_LEN 64
+
+enum tdma_cmd_type {
+    cmd_single_tx,
+    cmd_start_tx,
+    cmd_stop_tx,
+    cmd_set_master,
+};
+
+struct TDMA_CMD {
+    enum tdma_cmd_type type;
+    int slot_idx;
+    bool enable;
+};
+
+/* Bounded multi-producer queue. Each cell's sequence number says whether it's free to
+    write at a given position (seq == pos) or holds a command for it (seq == pos+1) */
+struct TDMA_CMD_QUEUE {
+    struct {
+        atomic_size_t seq;
+        struct TDMA_CMD cmd;
+    } cells[TDMA_CMD_QUEUE_LEN];
+    _Alignas(64) atomic_size_t head;    /* Next position to be claimed by a producer */
+    _Alignas(64) size_t tail;           /* Next position to be applied. tdma_rx's own */
+};
+
 tdma_t * tdma_create(struct TDMA_MODE_SETTINGS mode){
     tdma_t * tdma;
     
@@ -62,8 +91,8 @@ tdma_t * tdma_create(struct TDMA_MODE_SETTINGS mode){
     assert( (Fs%Rs)==0 );
     assert( M==2 || M==4);
 
-    /* allocate the modem */
-    tdma = (tdma_t *) malloc(sizeof(tdma_t));
+    /* allocate the modem; zeroed, so the cleanup below only frees what was made */
+    tdma = (tdma_t *) calloc(1, sizeof(tdma_t));
     if(tdma == NULL) goto cleanup_bad_alloc;
 
     /* Symbols over which pilot modem operates */
@@ -72,17 +101,27 @@ tdma_t * tdma_create(struct TDMA_MODE_SETTINGS mode){
     /* Set up pilot modem */
     fsk_t * pilot = fsk_create_hbr(Fs,Rs,P,M,Rs,Rs);
     if(pilot == NULL) goto cleanup_bad_alloc;
-    fsk_enable_burst_mode(pilot,pilot_nsyms);
+    if(fsk_enable_burst_mode(pilot,pilot_nsyms)) goto cleanup_bad_alloc;
+    /* Nothing reads demod stats in TDMA operation; a GUI can turn them back on */
+    fsk_set_stats_level(pilot,FSK_STATS_NONE);
     tdma->fsk_pilot = pilot;
     tdma->settings = mode;
     tdma->state = no_sync;
     tdma->sample_sync_offset = 960;
     tdma->slot_cur = 0;
     tdma->rx_callback = NULL;
+    tdma->rx_soft_callback = NULL;
     tdma->tx_callback = NULL;
     tdma->tx_burst_callback = NULL;
     tdma->ignore_rx_on_tx = true;
     tdma->sync_misses = 0;
+    tdma->perf = NULL;
+    tdma->telem = NULL;
+    tdma->telem_seq = 0;
+    atomic_init(&tdma->telem_dropped, 0);
+    tdma->frames = NULL;
+    atomic_init(&tdma->frames_dropped, 0);
+    tdma->cmds = NULL;
 
     /* Set up the UWs we use for this mode. */
     if(mode.frame_type == TDMA_FRAME_A){
@@ -119,12 +158,26 @@ tdma_t * tdma_create(struct TDMA_MODE_SETTINGS mode){
         slot_fsk = fsk_create_hbr(Fs,Rs,P,M,Rs,Rs);
         
         if(slot_fsk == NULL) goto cleanup_bad_alloc;
-        fsk_enable_burst_mode(slot_fsk, slot_size+1);
-        
         slot->fsk = slot_fsk;
+        if(fsk_enable_burst_mode(slot_fsk, slot_size+1)) goto cleanup_bad_alloc;
+        fsk_set_stats_level(slot_fsk,FSK_STATS_NONE);
+
         last_slot = slot;
     }
 
+    tdma->cmds = (struct TDMA_CMD_QUEUE*) aligned_alloc(64, sizeof(struct TDMA_CMD_QUEUE));
+    if(tdma->cmds == NULL) goto cleanup_bad_alloc;
+    for(i = 0; i < TDMA_CMD_QUEUE_LEN; i++)
+        atomic_init(&tdma->cmds->cells[i].seq, i);
+    atomic_init(&tdma->cmds->head, 0);
+    tdma->cmds->tail = 0;
+
+    #ifdef TDMA_PERF_ENABLE
+    /* Budget for a tdma_rx call is one slot period */
+    tdma->perf = tdma_perf_create(n_slots, ((u64)slot_size*Ts*1000000000ULL)/Fs);
+    if(tdma->perf == NULL) goto cleanup_bad_alloc;
+    #endif
+
     return tdma;
 
     /* Clean up after a failed malloc */
@@ -141,6 +194,8 @@ tdma_t * tdma_create(struct TDMA_MODE_SETTINGS mode){
     }
     if(pilot != NULL) fsk_destroy(pilot);
     if(samp_buffer != NULL) free(samp_buffer);
+    tdma_perf_destroy(tdma->perf);
+    free(tdma->cmds);
     free(tdma);
     return NULL;
 }
@@ -156,9 +211,42 @@ void tdma_destroy(tdma_t * tdma){
     }
     fsk_destroy(tdma->fsk_pilot);
     free(tdma->sample_buffer);
+    tdma_perf_destroy(tdma->perf);
+    tdma_ring_destroy(tdma->telem);
+    tdma_ring_destroy(tdma->frames);
+    free(tdma->cmds);
     free(tdma);
 }
 
+size_t tdma_get_footprint(tdma_t * tdma){
+    u32 slot_size = tdma->settings.slot_size;
+    u32 n_slots = tdma->settings.n_slots;
+    u32 Ts = tdma->settings.samp_rate/tdma->settings.sym_rate;
+    size_t bytes = sizeof(tdma_t);
+    slot_t * slot = tdma->slots;
+
+    bytes += sizeof(COMP)*slot_size*Ts*(n_slots+1);
+    bytes += fsk_get_footprint(tdma->fsk_pilot);
+    while(slot != NULL){
+        bytes += sizeof(slot_t) + fsk_get_footprint(slot->fsk);
+        slot = slot->next_slot;
+    }
+    bytes += tdma_perf_footprint(tdma->perf);
+    bytes += tdma_ring_footprint(tdma->telem);
+    bytes += tdma_ring_footprint(tdma->frames);
+    bytes += sizeof(struct TDMA_CMD_QUEUE);
+    return bytes;
+}
+
+void tdma_set_fixed_point(tdma_t * tdma, int enable, float in_scale){
+    slot_t * slot = tdma->slots;
+    fsk_set_fixed_point(tdma->fsk_pilot,enable,in_scale);
+    while(slot != NULL){
+        fsk_set_fixed_point(slot->fsk,enable,in_scale);
+        slot = slot->next_slot;
+    }
+}
+
 u32 tdma_get_N(tdma_t * tdma){
     u32 slot_size = tdma->settings.slot_size;
     u32 Fs = tdma->settings.samp_rate;
@@ -208,6 +296,47 @@ size_t tdma_search_uw(tdma_t * tdma, u8 bits[], size_t nbits, size_t * delta_out
     return uw_offset_min;
 }
 
+/* Search for a complete UW by correlating against soft decisions */
+size_t tdma_search_uw_soft(tdma_t * tdma, u8 bits[], float sd[], size_t nbits, size_t * delta_out, size_t * uw_type_out){
+    size_t uw_len = tdma->settings.uw_len;
+    size_t bits_per_sym = (tdma->settings.fsk_m==2)?1:2;
+    u8 ** uw_list = tdma->uw_list;
+    size_t ibits,iuw;
+    size_t j;
+    float corr, mag;
+    float uw_corr_max = -INFINITY;
+    size_t uw_type_max = 0;
+    size_t uw_offset_max = 0;
+    size_t delta = 0;
+    /* Check each UW */
+    for(j = 0; j < tdma->uw_types; j++){
+        u8 * uw = uw_list[j];
+        /* Walk through buffer bits. Positive soft decisions are 0s */
+        for(ibits = 0; ibits < nbits-uw_len; ibits+=bits_per_sym){
+            corr = 0;
+            mag = 1E-12f;
+            for(iuw = 0; iuw < uw_len; iuw++){
+                corr += uw[iuw] ? -sd[ibits+iuw] : sd[ibits+iuw];
+                mag += fabsf(sd[ibits+iuw]);
+            }
+            /* Normalise, so that loud noise doesn't beat a quieter real UW */
+            corr /= mag;
+            if( corr > uw_corr_max ){
+                uw_corr_max = corr;
+                uw_offset_max = ibits;
+                uw_type_max = j;
+            }
+        }
+    }
+    /* Sync tolerances are in bit errors, so count them at the best match */
+    for(iuw = 0; iuw < uw_len; iuw++){
+        if(bits[uw_offset_max+iuw] != uw_list[uw_type_max][iuw]) delta++;
+    }
+    if(delta_out != NULL) *delta_out = delta;
+    if(uw_type_out != NULL) *uw_type_out = uw_type_max;
+    return uw_offset_max;
+}
+
 
 /* Convience function to look up a slot from it's index number */
 slot_t * tdma_get_slot(tdma_t * tdma, u32 slot_idx){
@@ -224,6 +353,70 @@ slot_t * tdma_get_slot(tdma_t * tdma, u32 slot_idx){
     return cur;
 }
 
+/* Queue a command for tdma_rx to apply. Returns -1 if the queue is full */
+static int tdma_queue_cmd(tdma_t * tdma, enum tdma_cmd_type type, int slot_idx, bool enable){
+    struct TDMA_CMD_QUEUE * q = tdma->cmds;
+    size_t pos = atomic_load_explicit(&q->head, memory_order_relaxed);
+    size_t seq;
+
+    /* Claim a position, then fill its cell and hand it over */
+    while(true){
+        seq = atomic_load_explicit(&q->cells[pos & (TDMA_CMD_QUEUE_LEN-1)].seq, memory_order_acquire);
+        if(seq == pos){
+            if(atomic_compare_exchange_weak_explicit(&q->head, &pos, pos+1, memory_order_relaxed, memory_order_relaxed))
+                break;
+        }else if((intptr_t)(seq - pos) < 0){
+            return -1;
+        }else{
+            pos = atomic_load_explicit(&q->head, memory_order_relaxed);
+        }
+    }
+    struct TDMA_CMD * cmd = &q->cells[pos & (TDMA_CMD_QUEUE_LEN-1)].cmd;
+    cmd->type = type;
+    cmd->slot_idx = slot_idx;
+    cmd->enable = enable;
+    atomic_store_explicit(&q->cells[pos & (TDMA_CMD_QUEUE_LEN-1)].seq, pos+1, memory_order_release);
+    return 0;
+}
+
+/* Apply every queued command, at the start of a slot */
+static void tdma_apply_cmds(tdma_t * tdma){
+    struct TDMA_CMD_QUEUE * q = tdma->cmds;
+    struct TDMA_CMD * cmd;
+    slot_t * slot;
+    size_t pos;
+
+    while(true){
+        pos = q->tail;
+        if(atomic_load_explicit(&q->cells[pos & (TDMA_CMD_QUEUE_LEN-1)].seq, memory_order_acquire) != pos+1)
+            break;
+        cmd = &q->cells[pos & (TDMA_CMD_QUEUE_LEN-1)].cmd;
+        slot = tdma_get_slot(tdma,cmd->slot_idx);
+        switch(cmd->type){
+            case cmd_single_tx:
+            case cmd_start_tx:
+                if(slot == NULL) break;
+                slot->state = tx_client;
+                slot->single_tx = cmd->type == cmd_single_tx;
+                break;
+            case cmd_stop_tx:
+                if(slot == NULL) break;
+                slot->state = rx_no_sync;
+                slot->single_tx = false;
+                break;
+            case cmd_set_master:
+                if(cmd->enable)
+                    tdma->state = master_sync;
+                else if(tdma->state == master_sync)
+                    tdma->state = no_sync;
+                break;
+        }
+        /* Free the cell for the producers' next lap round the queue */
+        atomic_store_explicit(&q->cells[pos & (TDMA_CMD_QUEUE_LEN-1)].seq, pos+TDMA_CMD_QUEUE_LEN, memory_order_release);
+        q->tail = pos+1;
+    }
+}
+
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wunused-parameter"
 
@@ -248,6 +441,8 @@ void tdma_do_tx_frame(tdma_t * tdma, int slot_idx){
     u8 uw_type = 0;
     if(slot == NULL) return;
 
+    TDMA_PERF_START(perf_t);
+
     /* Clear bit buffer */
     memset(&mod_bits[0],0,nbits*sizeof(u8));
 
@@ -258,8 +453,8 @@ void tdma_do_tx_frame(tdma_t * tdma, int slot_idx){
             slot->state = rx_no_sync;
             return;
         }
-        if(uw_type > 1)
-            uw_type = 0;
+        if(uw_type >= tdma->uw_types)
+            uw_type = uw_voice;
     }
 
     /* Copy frame bits to front of mod bit buffer */
@@ -272,6 +467,7 @@ void tdma_do_tx_frame(tdma_t * tdma, int slot_idx){
 
     /* Modulate frame */
     fsk_mod_c(slot->fsk,mod_samps,mod_bits);
+    TDMA_PERF_STOP(tdma->perf,slot_idx,TDMA_PERF_TX_MOD,perf_t);
 
     /* Calculate TX time and send frame down to radio */
     /* timestamp of head of slot currently being demod'ed */
@@ -298,23 +494,48 @@ void tdma_do_tx_frame(tdma_t * tdma, int slot_idx){
     }
 }
 
-/* Pull TDMA frame out of bit stream and call RX CB if present */
-void tdma_deframe_cbcall(u8 demod_bits[], u32 slot_i, tdma_t * tdma, slot_t * slot){
+/* Put a received frame in the frame ring */
+static void tdma_publish_frame(tdma_t * tdma, u8 frame_bits[], size_t nbits, u32 slot_i, slot_t * slot,
+                               bool master_mode, size_t uw_type, size_t uw_errs, i64 timestamp){
+    struct TDMA_FRAME * frame = (struct TDMA_FRAME*) tdma_ring_write_acquire(tdma->frames);
+    size_t i;
+
+    if(frame == NULL){
+        atomic_fetch_add_explicit(&tdma->frames_dropped, 1, memory_order_relaxed);
+        return;
+    }
+    frame->type = master_mode ? frame_master : frame_client;
+    frame->slot_idx = slot_i;
+    frame->uw_type = (u8)uw_type;
+    frame->uw_errs = uw_errs > 255 ? 255 : (u8)uw_errs;
+    frame->n_bits = (u16)nbits;
+    frame->timestamp = timestamp;
+    frame->frame_offset = slot->slot_local_frame_offset;
+    frame->EbNodB = slot->fsk->EbNodB;
+    frame->ppm = slot->fsk->ppm;
+    memset(frame->frame_payload, 0, (nbits+7)/8);
+    for(i = 0; i < nbits; i++)
+        frame->frame_payload[i>>3] |= (frame_bits[i]&1) << (7-(i&7));
+    tdma_ring_write_commit(tdma->frames);
+}
+
+/* Pull TDMA frame out of bit stream and call RX CB if present. demod_sd may be NULL
+    if there's no soft callback. off, delta and uw_type are where and which UW the
+    slot's sync found in demod_bits, and its bit errors. buf_timestamp is the
+    timestamp of the samples demod_bits were demodulated from */
+void tdma_deframe_cbcall(u8 demod_bits[], float demod_sd[], u32 slot_i, tdma_t * tdma, slot_t * slot,
+                         size_t off, size_t delta, size_t uw_type, i64 buf_timestamp){
     size_t frame_size = tdma->settings.frame_size;
     size_t slot_size = tdma->settings.slot_size;
     size_t uw_len = tdma->settings.uw_len;
     size_t bits_per_sym = (tdma->settings.fsk_m==2)?1:2;
     size_t n_demod_bits = (slot_size+1)*bits_per_sym;
     size_t frame_size_bits = bits_per_sym*frame_size;
-    size_t delta,off;
+    u32 Ts = tdma->settings.samp_rate/tdma->settings.sym_rate;
     i32 f_start;
     u32 master_max = tdma->settings.mastersat_max;
 
     u8 frame_bits[frame_size_bits];
-    /* Re-find UW in demod'ed slice */
-    /* Should probably just be left to tdma_rx_pilot_sync */
-    //off = fvhff_search_uw(demod_bits,n_demod_bits,TDMA_UW_V,uw_len,&delta,bits_per_sym);
-    off = tdma_search_uw(tdma, demod_bits, n_demod_bits, &delta, NULL);
     f_start = off - (frame_size_bits-uw_len)/2;
 
     /* If frame is not fully in demod bit buffer, there's not much we can do */
@@ -341,13 +562,51 @@ void tdma_deframe_cbcall(u8 demod_bits[], u32 slot_i, tdma_t * tdma, slot_t * sl
             slot->master_count = 0;
     }
 
+    /* The demod puts out the last symbol of the previous batch first */
+    if(tdma->frames != NULL)
+        tdma_publish_frame(tdma,frame_bits,frame_size_bits,slot_i,slot,master_mode,uw_type,delta,
+                           buf_timestamp + (i64)(f_start-(i32)bits_per_sym)*(Ts/bits_per_sym));
+
     /* Right now we're not actually deframing the bits */
-    /* TODO: actually extract UW type */
-    if(tdma->rx_callback != NULL){
-        tdma->rx_callback(frame_bits,slot_i,slot,tdma,0,tdma->rx_cb_data);
+    if(tdma->rx_callback != NULL || (tdma->rx_soft_callback != NULL && demod_sd != NULL)){
+        TDMA_PERF_START(perf_cb_t);
+        if(tdma->rx_callback != NULL)
+            tdma->rx_callback(frame_bits,slot_i,slot,tdma,(u8)uw_type,tdma->rx_cb_data);
+        if(tdma->rx_soft_callback != NULL && demod_sd != NULL)
+            tdma->rx_soft_callback(frame_bits,&demod_sd[f_start],slot_i,slot,tdma,(u8)uw_type,tdma->rx_soft_cb_data);
+        TDMA_PERF_STOP(tdma->perf,slot_i,TDMA_PERF_RX_CB,perf_cb_t);
     }
 }
 
+/* Publish a telemetry record for the slot cycle just run */
+static void tdma_publish_telem(tdma_t * tdma, u32 slot_i, slot_t * slot, bool uw_valid, size_t uw_errs){
+    struct TDMA_TELEM * rec = (struct TDMA_TELEM*) tdma_ring_write_acquire(tdma->telem);
+    fsk_t * fsk = slot->fsk;
+    size_t i;
+
+    tdma->telem_seq++;
+    if(rec == NULL){
+        atomic_fetch_add_explicit(&tdma->telem_dropped, 1, memory_order_relaxed);
+        return;
+    }
+    rec->seq = tdma->telem_seq;
+    rec->timestamp = tdma->timestamp;
+    rec->slot_i = slot_i;
+    rec->slot_state = (u8)slot->state;
+    rec->tdma_state = (u8)tdma->state;
+    rec->uw_valid = uw_valid;
+    rec->uw_errs = uw_errs > 255 ? 255 : (u8)uw_errs;
+    rec->bad_uw_count = slot->bad_uw_count;
+    rec->master_count = slot->master_count;
+    rec->slot_local_frame_offset = slot->slot_local_frame_offset;
+    rec->sample_sync_offset = tdma->sample_sync_offset;
+    rec->EbNodB = fsk->EbNodB;
+    rec->ppm = fsk->ppm;
+    for(i = 0; i < 4; i++)
+        rec->f_est[i] = i < (size_t)fsk->mode ? fsk->f_est[i] : 0;
+    tdma_ring_write_commit(tdma->telem);
+}
+
 /* We got a new slot's worth of samples. Run the slot modem and try to get slot sync */
 /* This will probably also work for the slot_sync state */
 void tdma_rx_pilot_sync(tdma_t * tdma){
@@ -367,6 +626,8 @@ void tdma_rx_pilot_sync(tdma_t * tdma){
     size_t nbits = (slot_size+1)*bits_per_sym;
     size_t slot_offset = tdma->sample_sync_offset;
     u8 bit_buf[nbits];
+    float sd_buf[nbits];
+    float * sd = tdma->rx_soft_callback != NULL ? sd_buf : NULL;
     COMP * sample_buffer = tdma->sample_buffer;
     COMP frame_samps[(slot_size+1)*Ts];
 
@@ -383,10 +644,17 @@ void tdma_rx_pilot_sync(tdma_t * tdma){
         return;
     }
 
+    u32 slot_i = tdma->slot_cur;
+    TDMA_PERF_START(perf_slot_t);
+
     /* Do TX if this is a TX slot */
     if(slot->state == tx_client){
         tdma_do_tx_frame(tdma,tdma->slot_cur);
     }
+    /* What this cycle found, for telemetry */
+    bool telem_uw_valid = false;
+    size_t telem_uw_errs = uw_len;
+
     /* If we're set up to ignore RX during a TX frame, and we're in a TX frame, ignore RX */
     if(!(tdma->ignore_rx_on_tx && slot->state == tx_client))
     {
@@ -404,16 +672,33 @@ void tdma_rx_pilot_sync(tdma_t * tdma){
         size_t delta,off,uw_type;
         i32 f_start;
         i32 frame_offset;
+        i64 buf_timestamp = 0;
         bool f_valid = false;
         /* Demod section in do-while loop so we can repeat once if frame is just outside of bit buffer */
         do{
+            #ifdef TDMA_PERF_ENABLE
+            bool perf_redemod = repeat_demod;
+            uint64_t perf_pass_t = tdma_perf_now();
+            #endif
+
             /* Pull out the frame and demod */
             memcpy(&frame_samps[0],&sample_buffer[tdma->sample_sync_offset+rdemod_offset],slot_samps*sizeof(COMP));
+            buf_timestamp = tdma->timestamp + (i64)tdma->sample_sync_offset + rdemod_offset;
 
             /* Demodulate the frame */
-            fsk_demod(fsk,bit_buf,frame_samps);
+            fsk2_demod(fsk,bit_buf,sd,frame_samps);
+            #ifdef TDMA_PERF_ENABLE
+            tdma_perf_record(tdma->perf,slot_i,TDMA_PERF_FREQ_EST,fsk->perf_ns[0]);
+            tdma_perf_record(tdma->perf,slot_i,TDMA_PERF_DOWNMIX,fsk->perf_ns[1]);
+            tdma_perf_record(tdma->perf,slot_i,TDMA_PERF_TIMING_EST,fsk->perf_ns[2]);
+            #endif
 
-            off = tdma_search_uw(tdma, bit_buf, nbits, &delta, &uw_type);
+            TDMA_PERF_START(perf_t);
+            if(sd != NULL)
+                off = tdma_search_uw_soft(tdma, bit_buf, sd, nbits, &delta, &uw_type);
+            else
+                off = tdma_search_uw(tdma, bit_buf, nbits, &delta, &uw_type);
+            TDMA_PERF_STOP(tdma->perf,slot_i,TDMA_PERF_UW_SEARCH,perf_t);
             f_start = off- (frame_bits-uw_len)/2;
 
             /* Check frame tolerance and sync state*/
@@ -458,9 +743,17 @@ void tdma_rx_pilot_sync(tdma_t * tdma){
             #endif
 
             rdemod_offset = frame_offset;
+
+            #ifdef TDMA_PERF_ENABLE
+            if(perf_redemod)
+                tdma_perf_record(tdma->perf,slot_i,TDMA_PERF_REDEMOD,tdma_perf_now()-perf_pass_t);
+            #endif
             
         }while(repeat_demod);
 
+        telem_uw_valid = f_valid;
+        telem_uw_errs = delta;
+
         /* Flag indicating whether or not we should call the callback */
         bool do_frame_found_call = false;   
 
@@ -507,7 +800,7 @@ void tdma_rx_pilot_sync(tdma_t * tdma){
         }
 
         if(do_frame_found_call){
-            tdma_deframe_cbcall(bit_buf,tdma->slot_cur,tdma,slot);
+            tdma_deframe_cbcall(bit_buf,sd,slot_i,tdma,slot,off,delta,uw_type,buf_timestamp);
         }
 
         #ifdef VERY_DEBUG
@@ -577,6 +870,11 @@ void tdma_rx_pilot_sync(tdma_t * tdma){
         }
     }
 
+    if(tdma->telem != NULL)
+        tdma_publish_telem(tdma,slot_i,slot,telem_uw_valid,telem_uw_errs);
+
+    TDMA_PERF_STOP(tdma->perf,slot_i,TDMA_PERF_TOTAL,perf_slot_t);
+
     tdma->slot_cur++;
     if(tdma->slot_cur >= n_slots)
         tdma->slot_cur = 0;
@@ -618,6 +916,8 @@ void tdma_rx_no_sync(tdma_t * tdma, COMP * samps, u64 timestamp){
     //u32 n_pilot_bits = (slot_size)*bits_per_sym;
     //We look at a full slot for the UW
     u8 pilot_bits[n_pilot_bits];
+    float pilot_sd_buf[n_pilot_bits];
+    float * pilot_sd = tdma->rx_soft_callback != NULL ? pilot_sd_buf : NULL;
 
     /* Start search at the last quarter of the previously rx'ed slot's worth of samples */
     size_t search_offset_i = (3*samps_per_slot)/4;
@@ -626,10 +926,13 @@ void tdma_rx_no_sync(tdma_t * tdma, COMP * samps, u64 timestamp){
     /* Search every half slot at quarter slot offsets */
     for(i = 0; i < 4; i++){
         fsk_clear_estimators(fsk);
-        fsk_demod(fsk,pilot_bits,&sample_buffer[search_offset_i]);
-        fsk_demod(fsk,pilot_bits,&sample_buffer[search_offset_i]);
-        
-        offset = tdma_search_uw(tdma, pilot_bits, n_pilot_bits, &delta, NULL);
+        fsk2_demod(fsk,pilot_bits,NULL,&sample_buffer[search_offset_i]);
+        fsk2_demod(fsk,pilot_bits,pilot_sd,&sample_buffer[search_offset_i]);
+
+        if(pilot_sd != NULL)
+            offset = tdma_search_uw_soft(tdma, pilot_bits, pilot_sd, n_pilot_bits, &delta, NULL);
+        else
+            offset = tdma_search_uw(tdma, pilot_bits, n_pilot_bits, &delta, NULL);
         f_start = offset - (frame_bits-uw_len)/2;
 
         fprintf(stderr,"delta: %zd offset %zd so:%zd\n",delta,offset,search_offset_i);
@@ -674,17 +977,27 @@ void tdma_rx(tdma_t * tdma, COMP * samps,u64 timestamp){
     u32 Ts = Fs/Rs;
     u32 slot_samps = slot_size*Ts;
 
+    #ifdef TDMA_PERF_ENABLE
+    uint64_t perf_rx_t = tdma_perf_now();
+    tdma_perf_begin(tdma->perf);
+    #endif
+
     /* Copy samples into the local buffer for some reason */
     /* Move the current samps in the buffer back by a slot or so */
+    TDMA_PERF_START(perf_t);
     size_t move_samps = slot_samps*n_slots*sizeof(COMP);
     memmove(&sample_buffer[0],&sample_buffer[slot_samps],move_samps);
 
     move_samps = slot_samps*sizeof(COMP);
     memcpy(&sample_buffer[n_slots*slot_samps],&samps[0],move_samps);
+    TDMA_PERF_STOP(tdma->perf,-1,TDMA_PERF_SHIFT,perf_t);
 
     /* Set the timestamp. Not sure if this makes sense */
     tdma->timestamp = timestamp - (slot_samps*(n_slots-1));
 
+    /* Take on any TX and master changes from control threads, between slots */
+    tdma_apply_cmds(tdma);
+
     /* Staate machine for TDMA modem */
     switch(tdma->state){
         case no_sync:
@@ -729,6 +1042,10 @@ void tdma_rx(tdma_t * tdma, COMP * samps,u64 timestamp){
     if( (!have_slot_sync) && (tdma->state == no_sync)){
         tdma->sample_sync_offset += (slot_samps/8);
     }
+
+    #ifdef TDMA_PERF_ENABLE
+    tdma_perf_cycle(tdma->perf,tdma_perf_now()-perf_rx_t);
+    #endif
 }
 
 
@@ -737,6 +1054,11 @@ void tdma_set_rx_cb(tdma_t * tdma,tdma_cb_rx_frame rx_callback,void * cb_data){
     tdma->rx_cb_data = cb_data;
 }
 
+void tdma_set_rx_soft_cb(tdma_t * tdma,tdma_cb_rx_frame_soft rx_soft_callback,void * cb_data){
+    tdma->rx_soft_callback = rx_soft_callback;
+    tdma->rx_soft_cb_data = cb_data;
+}
+
 
 void tdma_set_tx_cb(tdma_t * tdma,tdma_cb_tx_frame tx_callback,void * cb_data){
     tdma->tx_callback = tx_callback;
@@ -752,30 +1074,29 @@ void tdma_set_tx_burst_cb(tdma_t * tdma,tdma_cb_tx_burst tx_burst_callback, void
 /* Set up TDMA to schedule the transmission of a single frame. The frame itself will be 
     passed in through the tx_frame callback
 */
-void tdma_single_frame_tx(tdma_t * tdma, int slot_idx){
-    slot_t * slot = tdma_get_slot(tdma,slot_idx);
-    if(slot == NULL) return;
-    slot->state = tx_client;
-    slot->single_tx = true;
+int tdma_single_frame_tx(tdma_t * tdma, int slot_idx){
+    return tdma_queue_cmd(tdma,cmd_single_tx,slot_idx,false);
 }
 
 /* Start transmission of a bunch of frames on a particular slot
 */
-void tdma_start_tx(tdma_t * tdma, int slot_idx){
-    slot_t * slot = tdma_get_slot(tdma,slot_idx);
-    if(slot == NULL) return;
-    slot->state = tx_client;
-    slot->single_tx = false;
+int tdma_start_tx(tdma_t * tdma, int slot_idx){
+    return tdma_queue_cmd(tdma,cmd_start_tx,slot_idx,false);
 }
 
 
 /* Stop ongoing transmission of a bunch of frames for some slot
 */
-void tdma_stop_tx(tdma_t * tdma, int slot_idx){
-    slot_t * slot = tdma_get_slot(tdma,slot_idx);
-    if(slot == NULL) return;
-    slot->state = rx_no_sync;
-    slot->single_tx = false;
+int tdma_stop_tx(tdma_t * tdma, int slot_idx){
+    return tdma_queue_cmd(tdma,cmd_stop_tx,slot_idx,false);
+}
+
+int tdma_set_master(tdma_t * tdma, bool master){
+    return tdma_queue_cmd(tdma,cmd_set_master,0,master);
+}
+
+void tdma_set_state_now(tdma_t * tdma, enum tdma_state state){
+    tdma->state = state;
 }
 
 size_t tdma_nin(tdma_t * tdma){
@@ -799,3 +1120,55 @@ size_t tdma_nout(tdma_t * tdma){
 }
 
 #pragma GCC diagnostic pop
+
+int tdma_get_perf(tdma_t * tdma, struct TDMA_PERF_STATS * stats){
+    tdma_perf_snapshot(tdma->perf,stats);
+    return tdma->perf == NULL ? -1 : 0;
+}
+
+void tdma_reset_perf(tdma_t * tdma){
+    if(tdma->perf != NULL)
+        atomic_store_explicit(&tdma->perf->reset_req,true,memory_order_release);
+}
+
+void tdma_set_perf_alarm(tdma_t * tdma, float alarm_frac){
+    if(tdma->perf != NULL)
+        tdma->perf->alarm_frac = alarm_frac;
+}
+
+int tdma_enable_telemetry(tdma_t * tdma, size_t n_records){
+    if(tdma->telem != NULL) return 0;
+    tdma->telem = tdma_ring_create(n_records, sizeof(struct TDMA_TELEM));
+    return tdma->telem == NULL ? -1 : 0;
+}
+
+bool tdma_telemetry_pop(tdma_t * tdma, struct TDMA_TELEM * rec){
+    if(tdma->telem == NULL) return false;
+    return tdma_ring_pop(tdma->telem, rec);
+}
+
+u64 tdma_telemetry_dropped(tdma_t * tdma){
+    return atomic_load_explicit(&tdma->telem_dropped, memory_order_relaxed);
+}
+
+int tdma_enable_frame_ring(tdma_t * tdma, size_t n_frames){
+    size_t bits_per_sym = (tdma->settings.fsk_m==2)?1:2;
+    size_t frame_bytes = (bits_per_sym*tdma->settings.frame_size+7)/8;
+    if(tdma->frames != NULL) return 0;
+    tdma->frames = tdma_ring_create(n_frames, sizeof(struct TDMA_FRAME) + frame_bytes);
+    return tdma->frames == NULL ? -1 : 0;
+}
+
+const struct TDMA_FRAME * tdma_frame_acquire(tdma_t * tdma){
+    if(tdma->frames == NULL) return NULL;
+    return (const struct TDMA_FRAME*) tdma_ring_read_acquire(tdma->frames);
+}
+
+void tdma_frame_release(tdma_t * tdma){
+    if(tdma->frames != NULL)
+        tdma_ring_read_release(tdma->frames);
+}
+
+u64 tdma_frames_dropped(tdma_t * tdma){
+    return atomic_load_explicit(&tdma->frames_dropped, memory_order_relaxed);
+}
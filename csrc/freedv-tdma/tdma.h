@@ -40,7 +40,10 @@
 #include "fsk.h"
 #include <stdint.h>
 #include <stdbool.h>
+#include <stdatomic.h>
 #include "comp_prim.h"
+#include "tdma_perf.h"
+#include "tdma_ring.h"
 
 
 #define TDMA_FRAME_A 3   /* 4800T Frame */
@@ -51,6 +54,7 @@ typedef uint64_t u64;
 typedef int64_t  i64;
 typedef uint32_t u32;
 typedef int32_t  i32;
+typedef uint16_t u16;
 typedef uint8_t  u8;
 typedef float    f32;
 
@@ -80,11 +84,24 @@ enum tdma_frame_type{
     frame_client,
 };
 
-/* TDMA frame struct */
+/* Unique words of TDMA_FRAME_A, as the uw_type passed to and from the frame callbacks */
+enum tdma_uw_type {
+    uw_voice = 0,           /* TDMA_UW_V */
+    uw_data = 1,            /* TDMA_UW_D */
+};
+
+/* TDMA frame struct, as delivered through the frame ring */
 struct TDMA_FRAME {
     enum tdma_frame_type type;      /* Type of frame */
     int slot_idx;                   /* Index of slot from where frame was rx-ed */
-    uint8_t frame_payload[];        /* Frame payload. TODO: figure out how to sling payloads around */
+    u8 uw_type;                     /* enum tdma_uw_type of the UW found */
+    u8 uw_errs;                     /* Bit errors in the UW */
+    u16 n_bits;                     /* Number of bits in frame_payload */
+    i64 timestamp;                  /* Sample timestamp of the start of the frame */
+    i32 frame_offset;               /* Slot's slot_local_frame_offset */
+    f32 EbNodB;                     /* From the slot's FSK demod */
+    f32 ppm;
+    uint8_t frame_payload[];        /* Frame bits, packed 8 to a byte, first bit in the MSB */
 };
 
 /* TDMA slot struct */
@@ -99,6 +116,24 @@ struct TDMA_SLOT {
     bool single_tx;                 /* Are we TXing a single frame? */
 };
 
+/* Telemetry published by the modem once per slot cycle */
+struct TDMA_TELEM {
+    u64 seq;                        /* Record number. A gap means records were dropped */
+    i64 timestamp;                  /* Timestamp of the oldest sample in the buffer at this cycle */
+    u32 slot_i;                     /* Slot this cycle handled */
+    u8 slot_state;                  /* enum slot_state after this cycle */
+    u8 tdma_state;                  /* enum tdma_state */
+    u8 uw_valid;                    /* Whether a good UW was found */
+    u8 uw_errs;                     /* Bit errors in the best UW match */
+    u32 bad_uw_count;
+    i32 master_count;
+    i32 slot_local_frame_offset;
+    i32 sample_sync_offset;
+    f32 EbNodB;                     /* From the slot's FSK demod */
+    f32 ppm;
+    f32 f_est[4];
+};
+
 /* Structure for tracking basic TDMA modem config */
 struct TDMA_MODE_SETTINGS {
     u32 sym_rate;               /* Modem symbol rate */
@@ -127,6 +162,10 @@ struct TDMA_MODE_SETTINGS {
 /* TODO: write this a bit better */
 typedef void (*tdma_cb_rx_frame)(u8* frame_bits,u32 slot_i, slot_t * slot, tdma_t * tdma,u8 uw_type, void * cb_data);
 
+/* Callback with the frame's soft decisions as well, one LLR per bit, positive for a 0.
+    Their magnitudes are the bits' reliabilities, as wanted by golay23_decode_soft */
+typedef void (*tdma_cb_rx_frame_soft)(u8* frame_bits,float* frame_sd,u32 slot_i, slot_t * slot, tdma_t * tdma,u8 uw_type, void * cb_data);
+
 /* Callback typedef when TDMA is ready to schedule a new frame */
 /* Returns 1 if a frame is supplied, 0 if not */
 /* If no frame supplied, slot is changed out of TX mode */
@@ -150,9 +189,11 @@ struct TDMA_MODEM {
     uint32_t slot_cur;              /* Current slot coming in */
     uint32_t sync_misses;           /* How many slots have been missed during this sync period */
     tdma_cb_rx_frame rx_callback;
+    tdma_cb_rx_frame_soft rx_soft_callback;
     tdma_cb_tx_frame tx_callback;
     tdma_cb_tx_burst tx_burst_callback;
     void * rx_cb_data;
+    void * rx_soft_cb_data;
     void * tx_cb_data;
     void * tx_burst_cb_data;
     bool ignore_rx_on_tx;           /* Don't try and demod samples from a frame in a slot marked as TX */
@@ -160,12 +201,24 @@ struct TDMA_MODEM {
     size_t master_bit_pos;          /* Where in the frame can we find the master indicator bit? */
     uint8_t uw_types;               /* How many different UWs does this framing format use? pulled from frame_type */
     uint8_t ** uw_list;             /* Pointer to list of valid UWs */
+
+    struct TDMA_PERF * perf;        /* Stage timing; NULL unless built with TDMA_PERF_ENABLE */
+
+    tdma_ring_t * telem;            /* Telemetry records, if enabled */
+    u64 telem_seq;                  /* Records published, including dropped ones */
+    _Atomic u64 telem_dropped;      /* Records dropped because the ring was full */
+
+    struct TDMA_CMD_QUEUE * cmds;   /* TX and master commands waiting for the next slot */
+
+    tdma_ring_t * frames;           /* Received frames, if the frame ring is enabled */
+    _Atomic u64 frames_dropped;     /* Frames dropped because the ring was full */
     
 
 };
 
 
-/* Allocate and setup a new TDMA modem */
+/* Allocate and setup a new TDMA modem. Modems share no mutable state, so any
+   number can be created, run and destroyed on different threads at once */
 tdma_t * tdma_create(struct TDMA_MODE_SETTINGS mode);
 
 /* Tear down and free a TDMA modem */
@@ -183,29 +236,105 @@ void tdma_rx(tdma_t * tdma, COMP * samps,u64 timestamp);
 /* Set the RX callback function */
 void tdma_set_rx_cb(tdma_t * tdma,tdma_cb_rx_frame rx_callback,void * cb_data);
 
+/* Setup the callback for received frames with soft decisions. Called as well as the
+    plain RX callback if both are set. Only while it's set are slots demodulated soft
+    and UWs found by soft correlation */
+void tdma_set_rx_soft_cb(tdma_t * tdma,tdma_cb_rx_frame_soft rx_soft_callback,void * cb_data);
+
 void tdma_set_tx_cb(tdma_t * tdma,tdma_cb_tx_frame tx_callback,void * cb_data);
 
 void tdma_set_tx_burst_cb(tdma_t * tdma,tdma_cb_tx_burst tx_burst_callback, void * cb_data);
 
+/* The TX and master controls below may be called from any thread, including the TX and
+    RX callbacks. They queue a command, without locking, that tdma_rx applies before
+    the next slot it handles. All commands queued by then are applied together. They
+    return 0, or -1 if too many commands are already waiting */
+
 /* Set up TDMA to schedule the transmission of a single frame. The frame itself will be 
     passed in through the tx_frame callback
 */
-void tdma_single_frame_tx(tdma_t * tdma, int slot_idx);
+int tdma_single_frame_tx(tdma_t * tdma, int slot_idx);
 
 /* Start transmission of a bunch of frames on a particular slot
 */
-void tdma_start_tx(tdma_t * tdma, int slot_idx);
+int tdma_start_tx(tdma_t * tdma, int slot_idx);
 
 /* Stop ongoing transmission of a bunch of frames for some slot
 */
-void tdma_stop_tx(tdma_t * tdma, int slot_idx);
+int tdma_stop_tx(tdma_t * tdma, int slot_idx);
+
+/* Make this modem the TDMA timing master, or stop it being one
+*/
+int tdma_set_master(tdma_t * tdma, bool master);
+
+/* Set the overall modem state straight away rather than at the next slot. Only for
+    the TX and RX callbacks, which tdma_rx runs on its own thread; anything else must
+    use tdma_set_master. no_sync sends a client back to hunting for the master
+*/
+void tdma_set_state_now(tdma_t * tdma, enum tdma_state state);
 
 size_t tdma_nin(tdma_t * tdma);
 
 size_t tdma_nout(tdma_t * tdma);
 
+/* Search nbits of demodulated bits for the closest matching UW. Returns the bit
+    offset of the best match; the bit errors and UW type are put in delta_out and
+    uw_type_out if they are not NULL */
+size_t tdma_search_uw(tdma_t * tdma, u8 bits[], size_t nbits, size_t * delta_out, size_t * uw_type_out);
+
+/* As tdma_search_uw, but the best match is the one with the highest correlation
+    against soft decisions sd[], positive for a 0. delta_out is still the bit
+    errors in bits[] at that match */
+size_t tdma_search_uw_soft(tdma_t * tdma, u8 bits[], float sd[], size_t nbits, size_t * delta_out, size_t * uw_type_out);
+
 /* Convience function to look up a slot from it's index number */
 slot_t * tdma_get_slot(tdma_t * tdma, u32 slot_idx);
 
+/* Get stage timing for tdma_rx. Returns -1, with stats->enabled false, if the modem
+    wasn't built with TDMA_PERF_ENABLE. May be called from any thread */
+int tdma_get_perf(tdma_t * tdma, struct TDMA_PERF_STATS * stats);
+
+/* Clear the stage timing. Takes effect at the start of the next tdma_rx call */
+void tdma_reset_perf(tdma_t * tdma);
+
+/* Set the fraction of the slot period past which a tdma_rx call counts as near_budget */
+void tdma_set_perf_alarm(tdma_t * tdma, float alarm_frac);
+
+/* Start publishing a struct TDMA_TELEM every slot cycle into a ring of n_records. The
+    modem never waits on the ring; if it's full, the record is dropped and counted.
+    Call before the modem is running. Returns 0, or -1 if the ring can't be allocated */
+int tdma_enable_telemetry(tdma_t * tdma, size_t n_records);
+
+/* Take the oldest telemetry record. Returns false if there are none. Only one thread may
+    drain a modem's telemetry, but it needn't be the thread running tdma_rx */
+bool tdma_telemetry_pop(tdma_t * tdma, struct TDMA_TELEM * rec);
+
+/* Number of telemetry records dropped so far */
+u64 tdma_telemetry_dropped(tdma_t * tdma);
+
+/* Also deliver received frames as struct TDMA_FRAMEs through a ring of n_frames,
+    for the application to take from its own thread. With no RX callbacks set,
+    nothing but writing the ring is done for a frame on the thread running tdma_rx.
+    If the ring is full, frames are dropped rather than waited for. Returns 0, or
+    -1 if the ring couldn't be allocated */
+int tdma_enable_frame_ring(tdma_t * tdma, size_t n_frames);
+
+/* Get the oldest received frame in place, or NULL if there are none. It stays valid
+    until tdma_frame_release. Only one thread may drain a modem's frames, but it
+    needn't be the thread running tdma_rx */
+const struct TDMA_FRAME * tdma_frame_acquire(tdma_t * tdma);
+void tdma_frame_release(tdma_t * tdma);
+
+/* Number of frames dropped from the frame ring so far */
+u64 tdma_frames_dropped(tdma_t * tdma);
+
+/* Run the pilot and slot demods in fixed point, see fsk_set_fixed_point. in_scale
+    is Q15 counts per unit of input amplitude; 0 for the default */
+void tdma_set_fixed_point(tdma_t * tdma, int enable, float in_scale);
+
+/* Heap bytes held by the modem: tdma_t, sample buffer, slots and their modems,
+    and the perf and telemetry buffers when they're enabled */
+size_t tdma_get_footprint(tdma_t * tdma);
+
 
 #endif
@@ -0,0 +1,186 @@
+/*---------------------------------------------------------------------------*\
+
+  FILE........: tdma_perf.c
+  AUTHOR......: Brady O'Brien
+  DATE CREATED: 19 October 2026
+
+  Stage timing histograms for tdma_rx
+
+\*---------------------------------------------------------------------------*/
+
+/*
+  Copyright (C) 2026 Brady O'Brien
+
+  All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License version 2.1, as
+  published by the Free Software Foundation.  This program is
+  distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <sched.h>
+#include "tdma_perf.h"
+
+static int tdma_perf_bin(uint64_t ns){
+    int e;
+    if(ns < TDMA_PERF_HIST_LIN) return (int)ns;
+    e = 63 - __builtin_clzll(ns);
+    int b = TDMA_PERF_HIST_LIN + (e-4)*TDMA_PERF_HIST_SUB + (int)((ns >> (e-3)) & (TDMA_PERF_HIST_SUB-1));
+    return b < TDMA_PERF_HIST_BINS ? b : TDMA_PERF_HIST_BINS-1;
+}
+
+/* Largest time that lands in bin b */
+static uint64_t tdma_perf_bin_top(int b){
+    if(b < TDMA_PERF_HIST_LIN) return b;
+    int e = (b - TDMA_PERF_HIST_LIN)/TDMA_PERF_HIST_SUB + 4;
+    uint64_t sub = (b - TDMA_PERF_HIST_LIN)%TDMA_PERF_HIST_SUB;
+    return ((TDMA_PERF_HIST_SUB + sub + 1) << (e-3)) - 1;
+}
+
+static void tdma_perf_clear(struct TDMA_PERF * perf){
+    size_t i, n = (perf->n_slots+1)*TDMA_PERF_N_STAGES;
+    memset(perf->hist, 0, n*sizeof(struct TDMA_PERF_HIST));
+    for(i = 0; i < n; i++)
+        perf->hist[i].min_ns = UINT64_MAX;
+    perf->cycles = 0;
+    perf->near_budget = 0;
+    perf->over_budget = 0;
+}
+
+struct TDMA_PERF * tdma_perf_create(uint32_t n_slots, uint64_t budget_ns){
+    struct TDMA_PERF * perf = (struct TDMA_PERF*) calloc(1, sizeof(struct TDMA_PERF));
+    if(perf == NULL) return NULL;
+
+    perf->hist = (struct TDMA_PERF_HIST*) malloc((n_slots+1)*TDMA_PERF_N_STAGES*sizeof(struct TDMA_PERF_HIST));
+    if(perf->hist == NULL){
+        free(perf);
+        return NULL;
+    }
+    perf->n_slots = n_slots;
+    perf->budget_ns = budget_ns;
+    perf->alarm_frac = .8;
+    atomic_init(&perf->seq, 0);
+    atomic_init(&perf->reset_req, false);
+    tdma_perf_clear(perf);
+    return perf;
+}
+
+void tdma_perf_destroy(struct TDMA_PERF * perf){
+    if(perf == NULL) return;
+    free(perf->hist);
+    free(perf);
+}
+
+size_t tdma_perf_footprint(struct TDMA_PERF * perf){
+    if(perf == NULL) return 0;
+    return sizeof(struct TDMA_PERF) + (perf->n_slots+1)*TDMA_PERF_N_STAGES*sizeof(struct TDMA_PERF_HIST);
+}
+
+/* Writer side of the seqlock */
+static inline void tdma_perf_write_begin(struct TDMA_PERF * perf){
+    atomic_fetch_add_explicit(&perf->seq, 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+}
+
+static inline void tdma_perf_write_end(struct TDMA_PERF * perf){
+    atomic_fetch_add_explicit(&perf->seq, 1, memory_order_release);
+}
+
+static inline void tdma_perf_hist_add(struct TDMA_PERF_HIST * h, uint64_t ns){
+    h->count++;
+    h->sum_ns += ns;
+    if(ns < h->min_ns) h->min_ns = ns;
+    if(ns > h->max_ns) h->max_ns = ns;
+    h->bins[tdma_perf_bin(ns)]++;
+}
+
+void tdma_perf_record(struct TDMA_PERF * perf, int slot_i, enum tdma_perf_stage stage, uint64_t ns){
+    if(perf == NULL) return;
+    tdma_perf_write_begin(perf);
+    if(slot_i >= 0 && (uint32_t)slot_i < perf->n_slots)
+        tdma_perf_hist_add(&perf->hist[slot_i*TDMA_PERF_N_STAGES + stage], ns);
+    /* The overall total is the whole tdma_rx call, kept by tdma_perf_cycle */
+    if(stage != TDMA_PERF_TOTAL || slot_i < 0)
+        tdma_perf_hist_add(&perf->hist[perf->n_slots*TDMA_PERF_N_STAGES + stage], ns);
+    tdma_perf_write_end(perf);
+}
+
+void tdma_perf_begin(struct TDMA_PERF * perf){
+    if(perf == NULL) return;
+    if(atomic_exchange_explicit(&perf->reset_req, false, memory_order_acquire)){
+        tdma_perf_write_begin(perf);
+        tdma_perf_clear(perf);
+        tdma_perf_write_end(perf);
+    }
+}
+
+void tdma_perf_cycle(struct TDMA_PERF * perf, uint64_t ns){
+    if(perf == NULL) return;
+    tdma_perf_write_begin(perf);
+    tdma_perf_hist_add(&perf->hist[perf->n_slots*TDMA_PERF_N_STAGES + TDMA_PERF_TOTAL], ns);
+    perf->cycles++;
+    if(ns > perf->budget_ns*perf->alarm_frac) perf->near_budget++;
+    if(ns > perf->budget_ns) perf->over_budget++;
+    tdma_perf_write_end(perf);
+}
+
+static void tdma_perf_summarise(const struct TDMA_PERF_HIST * h, struct TDMA_PERF_STAGE_STATS * s){
+    int b;
+    s->count = h->count;
+    if(h->count == 0){
+        s->min_ns = s->max_ns = s->p99_ns = 0;
+        s->mean_ns = 0;
+        return;
+    }
+    s->min_ns = h->min_ns;
+    s->max_ns = h->max_ns;
+    s->mean_ns = (double)h->sum_ns/h->count;
+
+    /* Walk down from the top until we've passed 1% of the samples */
+    uint64_t above = 0, limit = h->count/100;
+    for(b = TDMA_PERF_HIST_BINS-1; b > 0; b--){
+        above += h->bins[b];
+        if(above > limit) break;
+    }
+    s->p99_ns = tdma_perf_bin_top(b);
+    if(s->p99_ns > s->max_ns) s->p99_ns = s->max_ns;
+}
+
+void tdma_perf_snapshot(struct TDMA_PERF * perf, struct TDMA_PERF_STATS * stats){
+    unsigned s0, s1;
+    uint32_t i, j;
+
+    memset(stats, 0, sizeof(*stats));
+    if(perf == NULL) return;
+
+    /* Retry until nothing was written while we were looking */
+    do{
+        while((s0 = atomic_load_explicit(&perf->seq, memory_order_acquire)) & 1)
+            sched_yield();
+
+        stats->enabled = true;
+        stats->budget_ns = perf->budget_ns;
+        stats->alarm_frac = perf->alarm_frac;
+        stats->cycles = perf->cycles;
+        stats->near_budget = perf->near_budget;
+        stats->over_budget = perf->over_budget;
+        stats->n_slots = perf->n_slots < TDMA_PERF_MAX_SLOTS ? perf->n_slots : TDMA_PERF_MAX_SLOTS;
+        for(j = 0; j < TDMA_PERF_N_STAGES; j++)
+            tdma_perf_summarise(&perf->hist[perf->n_slots*TDMA_PERF_N_STAGES + j], &stats->all[j]);
+        for(i = 0; i < stats->n_slots; i++)
+            for(j = 0; j < TDMA_PERF_N_STAGES; j++)
+                tdma_perf_summarise(&perf->hist[i*TDMA_PERF_N_STAGES + j], &stats->slot[i][j]);
+
+        atomic_thread_fence(memory_order_acquire);
+        s1 = atomic_load_explicit(&perf->seq, memory_order_relaxed);
+    }while(s0 != s1);
+}
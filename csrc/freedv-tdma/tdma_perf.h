@@ -0,0 +1,144 @@
+/*---------------------------------------------------------------------------*\
+
+  FILE........: tdma_perf.h
+  AUTHOR......: Brady O'Brien
+  DATE CREATED: 19 October 2026
+
+  Optional per-stage timing of tdma_rx. Built in with TDMA_PERF_ENABLE;
+  otherwise the hooks compile away and tdma_get_perf reports it's disabled.
+
+\*---------------------------------------------------------------------------*/
+
+/*
+  Copyright (C) 2026 Brady O'Brien
+
+  All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License version 2.1, as
+  published by the Free Software Foundation.  This program is
+  distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __TDMA_PERF_H
+#define __TDMA_PERF_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <time.h>
+
+/* Stages of the RX path that get timed */
+enum tdma_perf_stage {
+    TDMA_PERF_SHIFT = 0,            /* Shifting new samples into the sample buffer */
+    TDMA_PERF_FREQ_EST,             /* fsk_demod_freq_est */
+    TDMA_PERF_DOWNMIX,              /* Tone downmix and integrate */
+    TDMA_PERF_TIMING_EST,           /* Fine timing, resampling, and symbol decisions */
+    TDMA_PERF_UW_SEARCH,            /* tdma_search_uw */
+    TDMA_PERF_REDEMOD,              /* Demods repeated because the frame was off the end */
+    TDMA_PERF_RX_CB,                /* RX frame callback */
+    TDMA_PERF_TX_MOD,               /* TX frame callback and modulation */
+    TDMA_PERF_TOTAL,                /* Per slot: one slot demod. Overall: one tdma_rx call */
+    TDMA_PERF_N_STAGES
+};
+
+/* Most slots that tdma_get_perf reports separately */
+#define TDMA_PERF_MAX_SLOTS 8
+
+/* Log-linear histogram: exact below 16ns, then 8 bins per octave up to ~34s */
+#define TDMA_PERF_HIST_LIN 16
+#define TDMA_PERF_HIST_SUB 8
+#define TDMA_PERF_HIST_BINS (TDMA_PERF_HIST_LIN + 31*TDMA_PERF_HIST_SUB)
+
+struct TDMA_PERF_HIST {
+    uint64_t count;
+    uint64_t sum_ns;
+    uint64_t min_ns;
+    uint64_t max_ns;
+    uint32_t bins[TDMA_PERF_HIST_BINS];
+};
+
+/* Summary of one stage */
+struct TDMA_PERF_STAGE_STATS {
+    uint64_t count;
+    uint64_t min_ns;
+    uint64_t max_ns;
+    uint64_t p99_ns;                /* Upper edge of the histogram bin holding the 99th percentile */
+    double mean_ns;
+};
+
+/* Snapshot returned by tdma_get_perf */
+struct TDMA_PERF_STATS {
+    bool enabled;
+    uint64_t budget_ns;             /* Real time budget of one tdma_rx call; one slot period */
+    float alarm_frac;               /* Fraction of budget counted as near_budget */
+    uint64_t cycles;                /* tdma_rx calls timed */
+    uint64_t near_budget;           /* tdma_rx calls taking more than alarm_frac of the budget */
+    uint64_t over_budget;           /* tdma_rx calls taking more than the budget */
+    uint32_t n_slots;               /* Number of entries filled in slot[] */
+    struct TDMA_PERF_STAGE_STATS all[TDMA_PERF_N_STAGES];
+    struct TDMA_PERF_STAGE_STATS slot[TDMA_PERF_MAX_SLOTS][TDMA_PERF_N_STAGES];
+};
+
+/*
+ * Live counters, owned by one modem. Only the thread running tdma_rx writes
+ * them; readers take a consistent copy through the seqlock in seq. A reset
+ * asked for from another thread is done by the writer at its next cycle.
+ */
+struct TDMA_PERF {
+    atomic_uint seq;
+    atomic_bool reset_req;
+    uint64_t budget_ns;
+    float alarm_frac;
+    uint64_t cycles;
+    uint64_t near_budget;
+    uint64_t over_budget;
+    uint32_t n_slots;
+    struct TDMA_PERF_HIST * hist;   /* (n_slots+1)*TDMA_PERF_N_STAGES; the last set is overall */
+};
+
+/* Monotonic time in ns */
+static inline uint64_t tdma_perf_now(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec*1000000000ULL + ts.tv_nsec;
+}
+
+struct TDMA_PERF * tdma_perf_create(uint32_t n_slots, uint64_t budget_ns);
+void tdma_perf_destroy(struct TDMA_PERF * perf);
+
+/* Heap bytes held by perf, 0 if it's NULL */
+size_t tdma_perf_footprint(struct TDMA_PERF * perf);
+
+/* Add a time to a stage, for slot_i and overall. slot_i < 0 records only overall */
+void tdma_perf_record(struct TDMA_PERF * perf, int slot_i, enum tdma_perf_stage stage, uint64_t ns);
+
+/* End of a tdma_rx call that took ns: record the total and check it against the budget */
+void tdma_perf_cycle(struct TDMA_PERF * perf, uint64_t ns);
+
+/* Start of a tdma_rx call: carry out a pending reset */
+void tdma_perf_begin(struct TDMA_PERF * perf);
+
+/* Summarise the counters into stats. Safe to call from any thread */
+void tdma_perf_snapshot(struct TDMA_PERF * perf, struct TDMA_PERF_STATS * stats);
+
+#ifdef TDMA_PERF_ENABLE
+
+#define TDMA_PERF_START(t) uint64_t t = tdma_perf_now()
+#define TDMA_PERF_STOP(perf,slot_i,stage,t) tdma_perf_record((perf),(slot_i),(stage),tdma_perf_now()-(t))
+
+#else
+
+#define TDMA_PERF_START(t)
+#define TDMA_PERF_STOP(perf,slot_i,stage,t)
+
+#endif
+
+#endif
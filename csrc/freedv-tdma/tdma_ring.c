@@ -0,0 +1,138 @@
+/*---------------------------------------------------------------------------*\
+
+  FILE........: tdma_ring.c
+  AUTHOR......: Brady O'Brien
+  DATE CREATED: 19 October 2026
+
+  Lock-free single producer/single consumer ring of fixed size elements
+
+\*---------------------------------------------------------------------------*/
+
+/*
+  Copyright (C) 2026 Brady O'Brien
+
+  All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License version 2.1, as
+  published by the Free Software Foundation.  This program is
+  distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include "tdma_ring.h"
+
+/* Keep the producer and consumer indices on their own cache lines */
+#define RING_CACHE_LINE 64
+
+struct TDMA_RING {
+    uint8_t * buf;                  /* Element storage */
+    size_t n_elems;                 /* Number of element slots, power of 2 */
+    size_t mask;                    /* n_elems-1 */
+    size_t elem_size;               /* Size of an element as requested */
+    size_t stride;                  /* Distance between elements in buf */
+
+    _Alignas(RING_CACHE_LINE) atomic_size_t head;   /* Next slot to be written. Owned by producer */
+    _Alignas(RING_CACHE_LINE) atomic_size_t tail;   /* Next slot to be read. Owned by consumer */
+};
+
+tdma_ring_t * tdma_ring_create(size_t n_elems, size_t elem_size){
+    tdma_ring_t * ring;
+    size_t n = 1;
+
+    if(n_elems == 0 || elem_size == 0) return NULL;
+
+    while(n < n_elems) n <<= 1;
+
+    ring = (tdma_ring_t*) aligned_alloc(RING_CACHE_LINE, sizeof(tdma_ring_t));
+    if(ring == NULL) return NULL;
+
+    ring->n_elems = n;
+    ring->mask = n-1;
+    ring->elem_size = elem_size;
+    ring->stride = (elem_size+15) & ~((size_t)15);
+    atomic_init(&ring->head, 0);
+    atomic_init(&ring->tail, 0);
+
+    ring->buf = (uint8_t*) aligned_alloc(RING_CACHE_LINE, (ring->stride*n + RING_CACHE_LINE-1) & ~((size_t)RING_CACHE_LINE-1));
+    if(ring->buf == NULL){
+        free(ring);
+        return NULL;
+    }
+    memset(ring->buf, 0, ring->stride*n);
+
+    return ring;
+}
+
+void tdma_ring_destroy(tdma_ring_t * ring){
+    if(ring == NULL) return;
+    free(ring->buf);
+    free(ring);
+}
+
+void * tdma_ring_write_acquire(tdma_ring_t * ring){
+    size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+    if((head - tail) >= ring->n_elems) return NULL;
+    return &ring->buf[(head & ring->mask)*ring->stride];
+}
+
+void tdma_ring_write_commit(tdma_ring_t * ring){
+    size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    atomic_store_explicit(&ring->head, head+1, memory_order_release);
+}
+
+void * tdma_ring_read_acquire(tdma_ring_t * ring){
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    size_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    if(head == tail) return NULL;
+    return &ring->buf[(tail & ring->mask)*ring->stride];
+}
+
+void tdma_ring_read_release(tdma_ring_t * ring){
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    atomic_store_explicit(&ring->tail, tail+1, memory_order_release);
+}
+
+bool tdma_ring_push(tdma_ring_t * ring, const void * elem){
+    void * slot = tdma_ring_write_acquire(ring);
+    if(slot == NULL) return false;
+    memcpy(slot, elem, ring->elem_size);
+    tdma_ring_write_commit(ring);
+    return true;
+}
+
+bool tdma_ring_pop(tdma_ring_t * ring, void * elem){
+    void * slot = tdma_ring_read_acquire(ring);
+    if(slot == NULL) return false;
+    memcpy(elem, slot, ring->elem_size);
+    tdma_ring_read_release(ring);
+    return true;
+}
+
+size_t tdma_ring_count(tdma_ring_t * ring){
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+    size_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    return head - tail;
+}
+
+size_t tdma_ring_size(tdma_ring_t * ring){
+    return ring->n_elems;
+}
+
+size_t tdma_ring_elem_size(tdma_ring_t * ring){
+    return ring->elem_size;
+}
+
+size_t tdma_ring_footprint(tdma_ring_t * ring){
+    if(ring == NULL) return 0;
+    return sizeof(struct TDMA_RING) + ring->n_elems*ring->stride;
+}
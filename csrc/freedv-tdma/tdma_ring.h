@@ -0,0 +1,78 @@
+/*---------------------------------------------------------------------------*\
+
+  FILE........: tdma_ring.h
+  AUTHOR......: Brady O'Brien
+  DATE CREATED: 19 October 2026
+
+  Lock-free single producer/single consumer ring of fixed size elements,
+  used to pass samples and records between radio I/O threads and the modem
+
+\*---------------------------------------------------------------------------*/
+
+/*
+  Copyright (C) 2026 Brady O'Brien
+
+  All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License version 2.1, as
+  published by the Free Software Foundation.  This program is
+  distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __TDMA_RING_H
+#define __TDMA_RING_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct TDMA_RING tdma_ring_t;
+
+/*
+ * Allocate a ring. n_elems is rounded up to the next power of two and every
+ * element slot is elem_size bytes, aligned to 16 bytes. Returns NULL on failure.
+ */
+tdma_ring_t * tdma_ring_create(size_t n_elems, size_t elem_size);
+
+/* Free a ring. Neither side may be using it. */
+void tdma_ring_destroy(tdma_ring_t * ring);
+
+/*
+ * Producer side, zero-copy. Returns a pointer to the next free element, or NULL
+ * if the ring is full. The element is handed over to the consumer by
+ * tdma_ring_write_commit(). Only one element may be acquired at a time.
+ */
+void * tdma_ring_write_acquire(tdma_ring_t * ring);
+void tdma_ring_write_commit(tdma_ring_t * ring);
+
+/*
+ * Consumer side, zero-copy. Returns a pointer to the oldest element, or NULL
+ * if the ring is empty. The element stays valid until tdma_ring_read_release().
+ */
+void * tdma_ring_read_acquire(tdma_ring_t * ring);
+void tdma_ring_read_release(tdma_ring_t * ring);
+
+/* Copying variants of the above. Return false if the ring is full/empty. */
+bool tdma_ring_push(tdma_ring_t * ring, const void * elem);
+bool tdma_ring_pop(tdma_ring_t * ring, void * elem);
+
+/* Number of elements waiting to be read. Only a snapshot from the other side. */
+size_t tdma_ring_count(tdma_ring_t * ring);
+
+/* Number of element slots in the ring */
+size_t tdma_ring_size(tdma_ring_t * ring);
+
+/* Size of each element slot in bytes */
+size_t tdma_ring_elem_size(tdma_ring_t * ring);
+
+/* Heap bytes held by the ring, 0 if it's NULL */
+size_t tdma_ring_footprint(tdma_ring_t * ring);
+
+#endif
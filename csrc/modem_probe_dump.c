@@ -0,0 +1,175 @@
+/*---------------------------------------------------------------------------*\
+
+  FILE........: modem_probe_dump.c
+  AUTHOR......: Brady O'Brien
+  DATE CREATED: 19 October 2026
+
+  Print a binary modem_probe capture as text, one record per line:
+    thread trace value value ...
+  Complex samples print as real,imag pairs. Give trace names after the
+  file to print only those.
+
+\*---------------------------------------------------------------------------*/
+
+/*
+  Copyright (C) 2026 Brady O'Brien
+
+  All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License version 2.1, as
+  published by the Free Software Foundation.  This program is
+  distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <modem_probe_bin.h>
+
+#define MAX_TRACES 65536
+
+struct data_block {
+    uint32_t thread;
+    uint32_t seq;
+    const uint8_t * data;
+    uint32_t len;
+};
+
+static int block_cmp(const void * a, const void * b){
+    const struct data_block * x = (const struct data_block*) a;
+    const struct data_block * y = (const struct data_block*) b;
+    if(x->thread != y->thread) return x->thread < y->thread ? -1 : 1;
+    if(x->seq != y->seq) return x->seq < y->seq ? -1 : 1;
+    return 0;
+}
+
+int main(int argc,char ** argv){
+    static struct MPB_NAME names[MAX_TRACES];
+    static bool selected[MAX_TRACES];
+    struct data_block * blocks = NULL;
+    size_t n_blocks = 0, blocks_cap = 0;
+    bool clean = false;
+    uint64_t dropped = 0;
+    int i;
+
+    if(argc < 2){
+        fprintf(stderr,"usage: %s capture.bin [trace ...]\n",argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    FILE * f = fopen(argv[1], "rb");
+    if(f == NULL){
+        perror(argv[1]);
+        return EXIT_FAILURE;
+    }
+    fseek(f, 0, SEEK_END);
+    size_t flen = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t * buf = (uint8_t*) malloc(flen);
+    if(buf == NULL || fread(buf, 1, flen, f) != flen){
+        fprintf(stderr,"Couldn't read %s\n",argv[1]);
+        return EXIT_FAILURE;
+    }
+    fclose(f);
+
+    struct MPB_FILE_HDR hdr;
+    if(flen < sizeof(hdr) || memcmp(buf, MPB_FILE_MAGIC, 8) != 0){
+        fprintf(stderr,"%s isn't a modem probe capture\n",argv[1]);
+        return EXIT_FAILURE;
+    }
+    memcpy(&hdr, buf, sizeof(hdr));
+    hdr.modname[sizeof(hdr.modname)-1] = 0;
+
+    /* Walk the blocks. A capture cut short just ends at the first zeroed header */
+    size_t pos = sizeof(hdr);
+    while(pos + sizeof(struct MPB_BLOCK_HDR) <= flen){
+        struct MPB_BLOCK_HDR bh;
+        memcpy(&bh, &buf[pos], sizeof(bh));
+        if(bh.magic != MPB_BLOCK_MAGIC || pos + sizeof(bh) + bh.len > flen)
+            break;
+        const uint8_t * body = &buf[pos + sizeof(bh)];
+        if(bh.kind == MPB_BLOCK_NAMES){
+            size_t k;
+            for(k = 0; k + sizeof(struct MPB_NAME) <= bh.len; k += sizeof(struct MPB_NAME)){
+                struct MPB_NAME nm;
+                memcpy(&nm, &body[k], sizeof(nm));
+                nm.name[MPB_NAME_LEN-1] = 0;
+                names[nm.id] = nm;
+            }
+        }else if(bh.kind == MPB_BLOCK_DATA){
+            if(n_blocks == blocks_cap){
+                blocks_cap = blocks_cap ? 2*blocks_cap : 256;
+                blocks = (struct data_block*) realloc(blocks, blocks_cap*sizeof(struct data_block));
+            }
+            blocks[n_blocks].thread = bh.thread;
+            blocks[n_blocks].seq = bh.seq;
+            blocks[n_blocks].data = body;
+            blocks[n_blocks].len = bh.len;
+            n_blocks++;
+        }else if(bh.kind == MPB_BLOCK_END){
+            clean = true;
+            if(bh.len >= sizeof(dropped))
+                memcpy(&dropped, body, sizeof(dropped));
+        }
+        pos += sizeof(bh) + ((bh.len+7) & ~7U);
+    }
+
+    for(i = 2; i < argc; i++){
+        int k;
+        for(k = 0; k < MAX_TRACES; k++)
+            if(names[k].name[0] && strcmp(names[k].name, argv[i]) == 0)
+                selected[k] = true;
+    }
+
+    fprintf(stderr,"# modem: %s, %zu data blocks, %s, %llu records dropped\n",hdr.modname,n_blocks,
+        clean ? "closed cleanly" : "truncated",(unsigned long long)dropped);
+
+    qsort(blocks, n_blocks, sizeof(struct data_block), block_cmp);
+    size_t b;
+    for(b = 0; b < n_blocks; b++){
+        size_t k = 0;
+        while(k + sizeof(struct MPB_REC) <= blocks[b].len){
+            struct MPB_REC rec;
+            uint32_t j;
+            memcpy(&rec, &blocks[b].data[k], sizeof(rec));
+            k += sizeof(rec);
+            size_t samp_size = rec.type == MPB_TYPE_C ? 8 : 4;
+            if(k + rec.count*samp_size > blocks[b].len)
+                break;
+            if(argc > 2 && !selected[rec.id]){
+                k += rec.count*samp_size;
+                continue;
+            }
+            printf("%u %s", blocks[b].thread, names[rec.id].name[0] ? names[rec.id].name : "?");
+            for(j = 0; j < rec.count; j++, k += samp_size){
+                if(rec.type == MPB_TYPE_I){
+                    int32_t v;
+                    memcpy(&v, &blocks[b].data[k], 4);
+                    printf(" %d", v);
+                }else if(rec.type == MPB_TYPE_F){
+                    float v;
+                    memcpy(&v, &blocks[b].data[k], 4);
+                    printf(" %g", v);
+                }else{
+                    float v[2];
+                    memcpy(v, &blocks[b].data[k], 8);
+                    printf(" %g,%g", v[0], v[1]);
+                }
+            }
+            printf("\n");
+        }
+    }
+
+    free(blocks);
+    free(buf);
+    return 0;
+}
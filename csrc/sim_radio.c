@@ -0,0 +1,297 @@
+/*---------------------------------------------------------------------------*\
+
+  FILE........: sim_radio.c
+  AUTHOR......: Brady O'Brien
+  DATE CREATED: 19 October 2026
+
+  In-process simulated radio channel connecting several TDMA modems.
+
+  Every station has an 'air' buffer holding what it will hear, indexed by
+  air time. When a modem schedules a burst, it is added straight into every
+  other station's air buffer at its timestamp, after applying the sending
+  station's delay, clock error, frequency offset, and gain. Each slot, every
+  station takes its next slot of air, adds its own noise, and runs it
+  through tdma_rx. A burst timestamped before the end of the slot that was
+  just handed out has missed its chance and is counted as late, much like
+  a radio rejecting a late SOAPY_SDR_HAS_TIME write.
+
+  A station can also hear through the CS16 radio front end. Each slot is
+  interpolated and shifted up to an IF at the radio rate, quantized, and
+  brought back down by the same kernels the radio drivers use. The filters'
+  delay then looks like extra receiver delay.
+
+  Clock error only moves where bursts land. It doesn't resample them; a
+  frame is short enough that the drift across it is a small fraction of
+  a sample.
+
+\*---------------------------------------------------------------------------*/
+
+/*
+  Copyright (C) 2026 Brady O'Brien
+
+  All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License version 2.1, as
+  published by the Free Software Foundation.  This program is
+  distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <errno.h>
+#include "sim_radio.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846264338327950288
+#endif
+
+/* Seconds of air each station keeps; bursts scheduled further out than this are dropped */
+#define SIM_RADIO_AIR_SECS 2
+
+static u64 sim_ts_diff_ns(const struct timespec * a, const struct timespec * b){
+    return (u64)((b->tv_sec - a->tv_sec)*1000000000LL + (b->tv_nsec - a->tv_nsec));
+}
+
+/* Uniform (0,1], from xorshift64* */
+static double sim_uniform(sim_radio_t * sim){
+    sim->rng ^= sim->rng >> 12;
+    sim->rng ^= sim->rng << 25;
+    sim->rng ^= sim->rng >> 27;
+    return ((sim->rng * 2685821657736338717ULL) >> 11) * (1.0/9007199254740992.0) + (1.0/9007199254740992.0);
+}
+
+/* Add complex gaussian noise with std. dev. sigma per component */
+static void sim_add_noise(sim_radio_t * sim, COMP * samps, size_t n, float sigma){
+    size_t i;
+    if(sigma <= 0) return;
+    for(i = 0; i < n; i++){
+        double r = sigma*sqrt(-2.*log(sim_uniform(sim)));
+        double th = 2.*M_PI*sim_uniform(sim);
+        samps[i].real += r*cos(th);
+        samps[i].imag += r*sin(th);
+    }
+}
+
+/* TX burst callback. Put the burst on the air for everyone but the sender */
+static int sim_cb_tx_burst(tdma_t * tdma,COMP* samples, size_t n_samples,i64 timestamp,void * cb_data){
+    struct SIM_STATION * st = (struct SIM_STATION*) cb_data;
+    sim_radio_t * sim = st->sim;
+    const struct SIM_STATION_PARAMS * p = &st->params;
+    i64 slot_end = sim->now + sim->nin;
+    struct timespec ts;
+    int r;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    u64 latency = sim_ts_diff_ns(&st->rx_start, &ts);
+    sim->cb_latency_sum_ns += latency;
+    if(latency < sim->stats.cb_latency_min_ns) sim->stats.cb_latency_min_ns = latency;
+    if(latency > sim->stats.cb_latency_max_ns) sim->stats.cb_latency_max_ns = latency;
+
+    i64 t_air = llround((double)timestamp*(1. + p->ppm*1e-6)) + p->delay;
+    i64 lead = t_air - slot_end;
+    sim->tx_lead_sum += lead;
+    if(lead < sim->stats.tx_lead_min) sim->stats.tx_lead_min = lead;
+    if(lead > sim->stats.tx_lead_max) sim->stats.tx_lead_max = lead;
+    sim->stats.tx_bursts++;
+
+    /* Anything before the end of the last slot handed out can't be heard any more */
+    size_t skip = 0;
+    if(t_air < slot_end){
+        sim->stats.tx_late++;
+        if(t_air + (i64)n_samples <= slot_end)
+            return -1;
+        skip = slot_end - t_air;
+    }
+    if(t_air + (i64)n_samples > sim->now + (i64)sim->air_len){
+        sim->stats.tx_dropped++;
+        return -1;
+    }
+
+    /* Carrier offset runs continuously in air time */
+    double w = 2.*M_PI*p->freq_offset/sim->samp_rate;
+    double ph0 = fmod(w*(double)(t_air+skip), 2.*M_PI);
+    size_t mask = sim->air_len-1;
+
+    for(r = 0; r < sim->n_added; r++){
+        struct SIM_STATION * rx = &sim->stations[r];
+        size_t i;
+        if(rx == st) continue;
+        double rot_r = cos(ph0)*p->gain, rot_i = sin(ph0)*p->gain;
+        double step_r = cos(w), step_i = sin(w);
+        for(i = skip; i < n_samples; i++){
+            COMP * a = &rx->air[(size_t)(t_air+i) & mask];
+            a->real += samples[i].real*rot_r - samples[i].imag*rot_i;
+            a->imag += samples[i].real*rot_i + samples[i].imag*rot_r;
+            double t = rot_r*step_r - rot_i*step_i;
+            rot_i = rot_r*step_i + rot_i*step_r;
+            rot_r = t;
+        }
+    }
+
+    return skip ? -1 : 0;
+}
+
+sim_radio_t * sim_radio_create(int n_stations, u32 samp_rate, size_t nin, bool realtime, u64 seed){
+    sim_radio_t * sim;
+    size_t air_len = 1;
+
+    if(n_stations < 1 || nin == 0) return NULL;
+
+    sim = (sim_radio_t*) calloc(1, sizeof(sim_radio_t));
+    if(sim == NULL) return NULL;
+
+    sim->stations = (struct SIM_STATION*) calloc(n_stations, sizeof(struct SIM_STATION));
+    if(sim->stations == NULL){
+        free(sim);
+        return NULL;
+    }
+
+    while(air_len < (size_t)samp_rate*SIM_RADIO_AIR_SECS || air_len < 16*nin)
+        air_len <<= 1;
+
+    sim->n_stations = n_stations;
+    sim->samp_rate = samp_rate;
+    sim->nin = nin;
+    sim->air_len = air_len;
+    sim->realtime = realtime;
+    sim->rng = seed ? seed : 0x9E3779B97F4A7C15ULL;
+    sim->stats.tx_lead_min = INT64_MAX;
+    sim->stats.tx_lead_max = INT64_MIN;
+    sim->stats.cb_latency_min_ns = UINT64_MAX;
+    clock_gettime(CLOCK_MONOTONIC, &sim->start);
+
+    return sim;
+}
+
+void sim_radio_destroy(sim_radio_t * sim){
+    int i;
+    if(sim == NULL) return;
+    for(i = 0; i < sim->n_added; i++){
+        tdma_set_tx_burst_cb(sim->stations[i].tdma, NULL, NULL);
+        free(sim->stations[i].air);
+        free(sim->stations[i].rx_slot_buf);
+        tdma_fe_tx_destroy(sim->stations[i].fe_up);
+        tdma_fe_rx_destroy(sim->stations[i].fe_down);
+        free(sim->stations[i].fe_buf);
+    }
+    free(sim->stations);
+    free(sim);
+}
+
+int sim_radio_add_station(sim_radio_t * sim, tdma_t * tdma, const struct SIM_STATION_PARAMS * params){
+    struct SIM_STATION * st;
+
+    if(sim->n_added >= sim->n_stations) return -1;
+    if(tdma_nin(tdma) != sim->nin || tdma->settings.samp_rate != sim->samp_rate) return -1;
+
+    st = &sim->stations[sim->n_added];
+    st->air = (COMP*) calloc(sim->air_len, sizeof(COMP));
+    /* The front end may hand back one more sample than it's given */
+    st->rx_slot_buf = (COMP*) malloc(sizeof(COMP)*(sim->nin+1));
+    if(st->air == NULL || st->rx_slot_buf == NULL)
+        goto sim_radio_add_station_err;
+    if(params->fe_decim > 0){
+        /* Leave headroom for the noise */
+        float fs_radio = (float)sim->samp_rate*params->fe_decim;
+        st->fe_up = tdma_fe_tx_create(params->fe_decim, params->fe_shift, fs_radio, 8192.);
+        st->fe_down = tdma_fe_rx_create(params->fe_decim, params->fe_shift, fs_radio, 1./8192.);
+        st->fe_buf = (int16_t*) malloc(2*sizeof(int16_t)*sim->nin*params->fe_decim);
+        if(st->fe_up == NULL || st->fe_down == NULL || st->fe_buf == NULL)
+            goto sim_radio_add_station_err;
+    }
+    st->tdma = tdma;
+    st->params = *params;
+    st->sim = sim;
+    tdma_set_tx_burst_cb(tdma, sim_cb_tx_burst, (void*)st);
+
+    return sim->n_added++;
+
+    sim_radio_add_station_err:
+    free(st->air);
+    free(st->rx_slot_buf);
+    tdma_fe_tx_destroy(st->fe_up);
+    tdma_fe_rx_destroy(st->fe_down);
+    free(st->fe_buf);
+    memset(st, 0, sizeof(struct SIM_STATION));
+    return -1;
+}
+
+void sim_radio_step(sim_radio_t * sim){
+    size_t mask = sim->air_len-1;
+    size_t nin = sim->nin;
+    int s;
+
+    /* In real time, wait until the last sample of this slot would have come off the radio */
+    if(sim->realtime){
+        i64 end_ns = ((sim->now + nin)*1000000000LL)/sim->samp_rate;
+        struct timespec ts;
+        ts.tv_sec = sim->start.tv_sec + end_ns/1000000000LL;
+        ts.tv_nsec = sim->start.tv_nsec + end_ns%1000000000LL;
+        if(ts.tv_nsec >= 1000000000L){
+            ts.tv_sec++;
+            ts.tv_nsec -= 1000000000L;
+        }
+        while(clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR);
+    }
+
+    /* Hand out this slot of air to everyone before anyone can transmit into it */
+    for(s = 0; s < sim->n_added; s++){
+        struct SIM_STATION * st = &sim->stations[s];
+        size_t i;
+        for(i = 0; i < nin; i++){
+            COMP * a = &st->air[(size_t)(sim->now+i) & mask];
+            st->rx_slot_buf[i] = *a;
+            a->real = 0;
+            a->imag = 0;
+        }
+        sim_add_noise(sim, st->rx_slot_buf, nin, st->params.noise_std);
+        if(st->fe_up != NULL){
+            size_t n_radio = tdma_fe_tx_cs16(st->fe_up, st->rx_slot_buf, nin, st->fe_buf);
+            tdma_fe_rx_cs16(st->fe_down, st->fe_buf, n_radio, st->rx_slot_buf);
+        }
+    }
+
+    for(s = 0; s < sim->n_added; s++){
+        struct SIM_STATION * st = &sim->stations[s];
+        struct timespec done;
+        clock_gettime(CLOCK_MONOTONIC, &st->rx_start);
+        tdma_rx(st->tdma, st->rx_slot_buf, sim->now);
+        clock_gettime(CLOCK_MONOTONIC, &done);
+
+        u64 t = sim_ts_diff_ns(&st->rx_start, &done);
+        sim->rx_time_sum_ns += t;
+        if(t > sim->stats.rx_time_max_ns) sim->stats.rx_time_max_ns = t;
+    }
+
+    sim->now += nin;
+    sim->stats.slots++;
+    sim->stats.samps += nin;
+}
+
+void sim_radio_get_stats(sim_radio_t * sim, struct SIM_RADIO_STATS * stats){
+    struct timespec ts;
+
+    *stats = sim->stats;
+    if(stats->tx_bursts > 0){
+        stats->tx_lead_mean = (double)sim->tx_lead_sum/stats->tx_bursts;
+        stats->cb_latency_mean_ns = (double)sim->cb_latency_sum_ns/stats->tx_bursts;
+    }else{
+        stats->tx_lead_min = stats->tx_lead_max = 0;
+        stats->cb_latency_min_ns = 0;
+    }
+    if(stats->slots > 0 && sim->n_added > 0)
+        stats->rx_time_mean_ns = (double)sim->rx_time_sum_ns/(stats->slots*sim->n_added);
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    stats->wall_secs = sim_ts_diff_ns(&sim->start, &ts)*1e-9;
+    if(stats->wall_secs > 0)
+        stats->realtime_factor = ((double)stats->samps/sim->samp_rate)/stats->wall_secs;
+}
@@ -0,0 +1,117 @@
+/*---------------------------------------------------------------------------*\
+
+  FILE........: sim_radio.h
+  AUTHOR......: Brady O'Brien
+  DATE CREATED: 19 October 2026
+
+  In-process simulated radio channel connecting several TDMA modems, for
+  testing the whole RX -> callback -> TX -> RX loop without hardware
+
+\*---------------------------------------------------------------------------*/
+
+/*
+  Copyright (C) 2026 Brady O'Brien
+
+  All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License version 2.1, as
+  published by the Free Software Foundation.  This program is
+  distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __SIM_RADIO_H
+#define __SIM_RADIO_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+#include "tdma.h"
+#include "tdma_frontend.h"
+
+/* How a station's transmissions look to everyone else */
+struct SIM_STATION_PARAMS {
+    i64 delay;                      /* Propagation and hardware delay, in samples */
+    float freq_offset;              /* Carrier offset, Hz */
+    float ppm;                      /* Sample clock error; stretches TX timestamps */
+    float gain;                     /* Amplitude of TX signal */
+    float noise_std;                /* AWGN std. dev. per I/Q component at this station's receiver */
+    int fe_decim;                   /* If not 0, run what this station hears through a CS16 radio */
+    float fe_shift;                 /*   front end at fe_decim times the modem rate, shift Hz off DC */
+};
+
+struct SIM_STATION {
+    tdma_t * tdma;
+    struct SIM_STATION_PARAMS params;
+    struct SIM_RADIO * sim;
+    COMP * air;                     /* Everyone else's bursts as heard here, indexed by air time mod air_len */
+    COMP * rx_slot_buf;             /* The slot being handed to tdma_rx */
+    tdma_fe_tx_t * fe_up;           /* Puts the slot up at the radio rate as CS16, like the radio's ADC */
+    tdma_fe_rx_t * fe_down;         /* Brings it back down to the modem */
+    int16_t * fe_buf;               /* One slot of CS16 radio samples */
+    struct timespec rx_start;       /* When the current tdma_rx call started */
+};
+
+/* Counters and timing kept by the simulator */
+struct SIM_RADIO_STATS {
+    u64 slots;                      /* Slot periods simulated */
+    u64 samps;                      /* Air time simulated, in samples */
+    u64 tx_bursts;                  /* Bursts put on the air */
+    u64 tx_late;                    /* Bursts that were at least partly in the past when scheduled */
+    u64 tx_dropped;                 /* Bursts scheduled too far in the future */
+    i64 tx_lead_min;                /* Samples between the end of the slot being demodulated and the */
+    i64 tx_lead_max;                /*   start of the burst it produced */
+    double tx_lead_mean;
+    u64 cb_latency_min_ns;          /* Wall time from the start of tdma_rx to the TX burst callback */
+    u64 cb_latency_max_ns;
+    double cb_latency_mean_ns;
+    u64 rx_time_max_ns;             /* Wall time of the longest tdma_rx call */
+    double rx_time_mean_ns;
+    double wall_secs;               /* Wall time since the simulation started */
+    double realtime_factor;         /* Air time / wall time */
+};
+
+struct SIM_RADIO {
+    struct SIM_STATION * stations;
+    int n_stations;
+    int n_added;
+    u32 samp_rate;                  /* Modem sample rate */
+    size_t nin;                     /* Samples per slot */
+    size_t air_len;                 /* Length of each station's air buffer, power of 2 */
+    i64 now;                        /* Air time of the next slot, in samples */
+    bool realtime;                  /* Pace slots to the wall clock */
+    struct timespec start;          /* Wall time of air time 0 */
+    u64 rng;                        /* State for noise generator */
+
+    struct SIM_RADIO_STATS stats;
+    u64 cb_latency_sum_ns;
+    u64 rx_time_sum_ns;
+    i64 tx_lead_sum;
+};
+
+typedef struct SIM_RADIO sim_radio_t;
+
+/*
+ * Create a simulator for n_stations modems at samp_rate with nin samples per
+ * slot. If realtime is set, sim_radio_step sleeps so air time keeps pace with
+ * the wall clock; otherwise it runs as fast as it can. Returns NULL on failure.
+ */
+sim_radio_t * sim_radio_create(int n_stations, u32 samp_rate, size_t nin, bool realtime, u64 seed);
+void sim_radio_destroy(sim_radio_t * sim);
+
+/* Hook up a modem. Takes over its TX burst callback. Returns the station index, or -1 */
+int sim_radio_add_station(sim_radio_t * sim, tdma_t * tdma, const struct SIM_STATION_PARAMS * params);
+
+/* Run one slot of air time through every station */
+void sim_radio_step(sim_radio_t * sim);
+
+/* Get a snapshot of the counters and timing */
+void sim_radio_get_stats(sim_radio_t * sim, struct SIM_RADIO_STATS * stats);
+
+#endif
@@ -6,6 +6,21 @@
 
   A small core to operate an instance of TDMA on a SoapySDR supporting radio
 
+  Radio I/O runs on two threads. The RX thread reads from the radio,
+  downconverts to the modem rate, and passes blocks of samples to the DSP
+  loop through a lock-free ring. The DSP loop (soapy_tdma_loop, run by the
+  caller) feeds the modem and queues TX bursts on a second ring, which the TX
+  thread upconverts and writes to the radio at the requested time. A slow
+  demod therefore only backs up the rings instead of stalling radio reads.
+
+  If the driver supports SoapySDR's direct buffer access API, the I/O threads
+  mix straight out of and into the driver's DMA buffers instead of copying
+  through readStream/writeStream.
+
+  Streams may be opened as CF32 or CS16. CS16 halves the bus bandwidth; the
+  conversion to and from float is folded into the front end filters in
+  tdma_frontend.c rather than done as a separate pass.
+
 \*---------------------------------------------------------------------------*/
 
 /*
@@ -25,63 +40,606 @@
   along with this program; if not, see <http://www.gnu.org/licenses/>.
 */
 
-
+#define _GNU_SOURCE
 #include <SoapySDR/Device.h>
 #include <SoapySDR/Formats.h>
 #include <tdma.h>
 #include <stdbool.h>
 #include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <math.h>
+#include <time.h>
+#include <sched.h>
+#include <pthread.h>
 #include <liquid/liquid.h>
 #include "soapy_tdma.h"
+#include "tdma_frontend.h"
+
+/* How long the I/O threads wait on the radio before checking for shutdown */
+#define SOAPY_TDMA_IO_TIMEOUT_US 100000
+
+/* How long to sleep when a ring is empty */
+#define SOAPY_TDMA_POLL_NS 200000
+
+/* Seconds of RX samples the RX ring can hold before blocks are dropped */
+#define SOAPY_TDMA_RX_RING_SECS .5
+
+/* Number of TX bursts that can be queued for the TX thread */
+#define SOAPY_TDMA_TX_RING_BURSTS 16
+
+/* Convert between radio time in ns and modem sample periods without overflowing */
+static i64 soapy_tdma_ns_to_samps(i64 ns, i64 rate){
+    return (ns/1000000000)*rate + ((ns%1000000000)*rate)/1000000000;
+}
+
+static i64 soapy_tdma_samps_to_ns(i64 samps, i64 rate){
+    return (samps/rate)*1000000000 + ((samps%rate)*1000000000)/rate;
+}
+
+static void soapy_tdma_sleep_poll(){
+    struct timespec ts = {0, SOAPY_TDMA_POLL_NS};
+    nanosleep(&ts, NULL);
+}
+
+int soapy_tdma_pin_self(int cpu){
+    cpu_set_t cpus;
+    if(cpu < 0) return 0;
+    CPU_ZERO(&cpus);
+    CPU_SET(cpu, &cpus);
+    return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpus);
+}
+
+/* Called by the modem from the DSP loop when a burst is ready. Queue it for the TX thread */
+static int soapy_tdma_cb_tx_burst(tdma_t * tdma,COMP* samples, size_t n_samples,i64 timestamp,void * cb_data){
+    soapy_tdma_radio_t * radio = (soapy_tdma_radio_t*) cb_data;
+
+    soapy_tdma_tx_burst * burst = tdma_ring_write_acquire(radio->tx_ring);
+    if(burst == NULL){
+        atomic_fetch_add_explicit(&radio->tx_ring_drops, 1, memory_order_relaxed);
+        return -1;
+    }
+
+    if(n_samples > radio->tx_burst_samps)
+        n_samples = radio->tx_burst_samps;
+    burst->timestamp = timestamp;
+    burst->n_samps = n_samples;
+    memcpy(&burst->samps[0], samples, sizeof(COMP)*n_samples);
+    tdma_ring_write_commit(radio->tx_ring);
+    return 0;
+}
 
 soapy_tdma_radio_t * soapy_tdma_create(SoapySDRDevice * sdr,
-                                        tdma_t * tdma, float shift,int * err,bool rx_only){
-    
-    /* TODO malloc null checking and cleanup */
-    soapy_tdma_radio_t * radio = malloc(sizeof(soapy_tdma_radio_t));
+                                        tdma_t * tdma, float shift,int * err,bool rx_only,const char * format){
+
+    soapy_tdma_radio_t * radio = calloc(1, sizeof(soapy_tdma_radio_t));
+    if(radio == NULL){
+        if(err != NULL) *err = -1;
+        return NULL;
+    }
 
-    
     radio->sdr = sdr;
+    radio->tdma = tdma;
     radio->shift = shift;
+    radio->rx_only_mode = rx_only;
+    radio->tx_gain = 1.;
+    radio->rx_cpu = -1;
+    radio->tx_cpu = -1;
+    radio->use_direct_access = true;
+    atomic_init(&radio->running, false);
+    atomic_init(&radio->rx_direct, false);
+    atomic_init(&radio->tx_direct, false);
+
+    if(format == NULL)
+        format = SOAPY_SDR_CF32;
+    if(strcmp(format, SOAPY_SDR_CS16) == 0){
+        radio->cs16 = true;
+    }else if(strcmp(format, SOAPY_SDR_CF32) != 0){
+        fprintf(stderr,"Unsupported stream format %s\n", format);
+        goto soapy_tdma_create_err;
+    }
+    radio->samp_size = SoapySDR_formatToSize(format);
 
-    if(SoapySDRDevice_setupStream(sdr, radio->rx_stream, SOAPY_SDR_RX, SOAPY_SDR_CF32, NULL, 0, NULL)){
-      err = -1;
+    if(SoapySDRDevice_setupStream(sdr, &radio->rx_stream, SOAPY_SDR_RX, format, NULL, 0, NULL)){
+      fprintf(stderr,"setupStream RX fail: %s\n", SoapySDRDevice_lastError());
       goto soapy_tdma_create_err;
     }
 
+    if(!rx_only){
+        if(SoapySDRDevice_setupStream(sdr, &radio->tx_stream, SOAPY_SDR_TX, format, NULL, 0, NULL)){
+          fprintf(stderr,"setupStream TX fail: %s\n", SoapySDRDevice_lastError());
+          goto soapy_tdma_create_err;
+        }
+        radio->tx_mtu = SoapySDRDevice_getStreamMTU(sdr, radio->tx_stream);
+    }
+
     size_t mtu = SoapySDRDevice_getStreamMTU(sdr, radio->rx_stream);
     radio->mtu = mtu;
     /* Get sample rates; make sure radio rate is divisible by tdma rate */
     float Fs_sdr = SoapySDRDevice_getSampleRate(sdr, SOAPY_SDR_RX, 0);
 
     float Fs_bb = tdma->settings.samp_rate;
-    float Fs_dr = fmodf(Fs_sdr,Fs_bb);  
+    float Fs_dr = fmodf(Fs_sdr,Fs_bb);
     if( Fs_dr > .01 ){
-      err = -1;
+      fprintf(stderr,"Radio rate %f is not a multiple of modem rate %f\n",Fs_sdr,Fs_bb);
       goto soapy_tdma_create_err;
     }
+    radio->radio_fs = Fs_sdr;
 
     float R = Fs_sdr/Fs_bb;
     float filtDb = 60;
 
-    
-    nco_crcf downmixer = nco_crcf_create(LIQUID_NCO);
-    nco_crcf upmixer = nco_crcf_create(LIQUID_NCO);
-    nco_crcf_set_phase(downmixer, 0.0f);
-    nco_crcf_set_phase(upmixer, 0.0f);
-    nco_crcf_set_frequency(downmixer,2.*M_PI*(shift/Fs_sdr));
-    nco_crcf_set_frequency(upmixer,2.*M_PI*(shift/Fs_sdr));
-
-    msresamp_crcf decim  = msresamp_crcf_create(1.0/((float)R),filtDb);
-    msresamp_crcf interp = msresamp_crcf_create(((float)R),filtDb);
-
-    radio->decim = decim;
-    radio->interp = interp;
-    radio->downmixer = downmixer;
-    radio->upmixer = upmixer;
-    radio->rx_only_mode = rx_only;
+    /* CS16 goes through the fused convert/filter kernels, which only do integer rate changes.
+       CF32 goes through liquid's mixers and resamplers */
+    if(radio->cs16){
+        radio->fe_rx = tdma_fe_rx_create(lroundf(R), shift, Fs_sdr, 1./32768.);
+        if(radio->fe_rx == NULL) goto soapy_tdma_create_err;
+        if(!rx_only){
+            radio->fe_tx = tdma_fe_tx_create(lroundf(R), shift, Fs_sdr, 32767.);
+            if(radio->fe_tx == NULL) goto soapy_tdma_create_err;
+        }
+    }else{
+        nco_crcf downmixer = nco_crcf_create(LIQUID_NCO);
+        nco_crcf upmixer = nco_crcf_create(LIQUID_NCO);
+        nco_crcf_set_phase(downmixer, 0.0f);
+        nco_crcf_set_phase(upmixer, 0.0f);
+        nco_crcf_set_frequency(downmixer,2.*M_PI*(shift/Fs_sdr));
+        nco_crcf_set_frequency(upmixer,2.*M_PI*(shift/Fs_sdr));
+
+        msresamp_crcf decim  = msresamp_crcf_create(1.0/((float)R),filtDb);
+        msresamp_crcf interp = msresamp_crcf_create(((float)R),filtDb);
+
+        radio->decim = decim;
+        radio->interp = interp;
+        radio->downmixer = downmixer;
+        radio->upmixer = upmixer;
+    }
+
+    /* RX ring; each block holds one radio MTU after decimation, plus some slack for the resampler */
+    size_t n_rx_blocks = (size_t)((Fs_sdr*SOAPY_TDMA_RX_RING_SECS)/(float)mtu);
+    if(n_rx_blocks < 16) n_rx_blocks = 16;
+    radio->rx_block_samps = (size_t)ceilf((float)mtu/R) + 16;
+    radio->rx_ring = tdma_ring_create(n_rx_blocks, sizeof(soapy_tdma_rx_block) + sizeof(COMP)*radio->rx_block_samps);
+    if(radio->rx_ring == NULL) goto soapy_tdma_create_err;
+
+    radio->rx_slot_buf = (COMP*) malloc(sizeof(COMP)*tdma_nin(tdma));
+    if(radio->rx_slot_buf == NULL) goto soapy_tdma_create_err;
+
+    if(!rx_only){
+        radio->tx_burst_samps = tdma_nout(tdma);
+        radio->tx_ring = tdma_ring_create(SOAPY_TDMA_TX_RING_BURSTS, sizeof(soapy_tdma_tx_burst) + sizeof(COMP)*radio->tx_burst_samps);
+        if(radio->tx_ring == NULL) goto soapy_tdma_create_err;
+        tdma_set_tx_burst_cb(tdma,soapy_tdma_cb_tx_burst,(void*)radio);
+    }
+
+    if(err != NULL) *err = 0;
+    return radio;
 
     soapy_tdma_create_err:
+    if(err != NULL) *err = -1;
+    soapy_tdma_destroy(radio);
     return NULL;
 }
+
+void soapy_tdma_destroy(soapy_tdma_radio_t * radio){
+    if(radio == NULL)
+        return;
+
+    if(radio->threads_started)
+        soapy_tdma_stop_streams(radio);
+
+    if(radio->tx_ring != NULL)
+        tdma_set_tx_burst_cb(radio->tdma,NULL,NULL);
+
+    if(radio->rx_stream != NULL) SoapySDRDevice_closeStream(radio->sdr, radio->rx_stream);
+    if(radio->tx_stream != NULL) SoapySDRDevice_closeStream(radio->sdr, radio->tx_stream);
+    if(radio->decim != NULL) msresamp_crcf_destroy(radio->decim);
+    if(radio->interp != NULL) msresamp_crcf_destroy(radio->interp);
+    if(radio->downmixer != NULL) nco_crcf_destroy(radio->downmixer);
+    if(radio->upmixer != NULL) nco_crcf_destroy(radio->upmixer);
+    tdma_fe_rx_destroy(radio->fe_rx);
+    tdma_fe_tx_destroy(radio->fe_tx);
+    tdma_ring_destroy(radio->rx_ring);
+    tdma_ring_destroy(radio->tx_ring);
+    free(radio->rx_slot_buf);
+    free(radio);
+}
+
+void soapy_tdma_set_affinity(soapy_tdma_radio_t * radio, int rx_cpu, int tx_cpu){
+    radio->rx_cpu = rx_cpu;
+    radio->tx_cpu = tx_cpu;
+}
+
+/* State kept by the RX thread between reads */
+struct soapy_tdma_rx_state {
+    i64 rx_radio_count;             /* Radio samples read, to extrapolate time if the radio doesn't give any */
+    i64 time_base_ns;               /* Radio time of sample 0 */
+    bool have_time;
+    bool discont;                   /* Samples were lost since the last block */
+    float complex * rx_buf_dm;      /* Downmixed radio-rate samples */
+    float complex * rx_buf_drop;    /* Decimator output when the ring is full */
+};
+
+/* Downconvert and decimate n radio samples into out. Returns the number of modem samples */
+static size_t soapy_tdma_rx_decim(soapy_tdma_radio_t * radio, struct soapy_tdma_rx_state * st,
+                                    const void * in, size_t n, COMP * out){
+    if(radio->cs16)
+        return tdma_fe_rx_cs16(radio->fe_rx, (const int16_t*)in, n, out);
+
+    /* liquid doesn't take const input, but the mixer doesn't write to it */
+    unsigned int n_decim = 0;
+    nco_crcf_mix_block_down(radio->downmixer, (float complex*)in, st->rx_buf_dm, n);
+    msresamp_crcf_execute(radio->decim, st->rx_buf_dm, n, (float complex*)out, &n_decim);
+    return n_decim;
+}
+
+/* Downconvert and decimate n radio samples straight into the next RX ring block.
+   in may point into a driver DMA buffer; it's only read by the front end. */
+static void soapy_tdma_rx_process(soapy_tdma_radio_t * radio, struct soapy_tdma_rx_state * st,
+                                    const void * in, size_t n, int flags, long long time_ns){
+    i64 Fs_bb = radio->tdma->settings.samp_rate;
+    i64 Fs_sdr = (i64)radio->radio_fs;
+
+    /* Work out the time of the first sample in this read */
+    if(flags & SOAPY_SDR_HAS_TIME){
+        st->time_base_ns = time_ns - soapy_tdma_samps_to_ns(st->rx_radio_count, Fs_sdr);
+        st->have_time = true;
+    }
+    time_ns = st->time_base_ns + soapy_tdma_samps_to_ns(st->rx_radio_count, Fs_sdr);
+    st->rx_radio_count += n;
+    atomic_fetch_add_explicit(&radio->rx_samps, n, memory_order_relaxed);
+
+    soapy_tdma_rx_block * block = tdma_ring_write_acquire(radio->rx_ring);
+    if(block == NULL){
+        /* DSP loop is behind; drop this block. Keep the resampler fed so its state stays sane */
+        soapy_tdma_rx_decim(radio, st, in, n, (COMP*)st->rx_buf_drop);
+        atomic_fetch_add_explicit(&radio->rx_ring_drops, 1, memory_order_relaxed);
+        st->discont = true;
+        return;
+    }
+
+    size_t n_decim = soapy_tdma_rx_decim(radio, st, in, n, &block->samps[0]);
+    block->timestamp = soapy_tdma_ns_to_samps(time_ns, Fs_bb);
+    block->n_samps = n_decim;
+    block->flags = st->discont ? SOAPY_TDMA_BLOCK_DISCONT : 0;
+    st->discont = false;
+    tdma_ring_write_commit(radio->rx_ring);
+}
+
+/* Sort out an error code from readStream or acquireReadBuffer */
+static void soapy_tdma_rx_error(soapy_tdma_radio_t * radio, struct soapy_tdma_rx_state * st, int ret){
+    if(ret == SOAPY_SDR_TIMEOUT)
+        return;
+    if(ret == SOAPY_SDR_OVERFLOW)
+        atomic_fetch_add_explicit(&radio->rx_overflows, 1, memory_order_relaxed);
+    else
+        atomic_fetch_add_explicit(&radio->rx_errors, 1, memory_order_relaxed);
+    st->discont = true;
+}
+
+/* RX thread. Read from the radio, downconvert, decimate, and pass blocks on to the DSP loop */
+static void * soapy_tdma_rx_thread(void * arg){
+    soapy_tdma_radio_t * radio = (soapy_tdma_radio_t*) arg;
+    size_t mtu = radio->mtu;
+    struct soapy_tdma_rx_state st;
+    bool direct = radio->use_direct_access;
+
+    if(soapy_tdma_pin_self(radio->rx_cpu))
+        fprintf(stderr,"Couldn't pin RX thread to CPU %d\n",radio->rx_cpu);
+
+    memset(&st, 0, sizeof(st));
+    float complex * rx_buf = (float complex*) malloc(sizeof(float complex)*mtu);
+    st.rx_buf_dm = (float complex*) malloc(sizeof(float complex)*mtu);
+    st.rx_buf_drop = (float complex*) malloc(sizeof(float complex)*radio->rx_block_samps);
+    if(rx_buf == NULL || st.rx_buf_dm == NULL || st.rx_buf_drop == NULL){
+        fprintf(stderr,"RX thread couldn't allocate buffers\n");
+        goto soapy_tdma_rx_thread_exit;
+    }
+
+    /* Only read straight out of the driver's buffers if it has any to give */
+    if(direct && SoapySDRDevice_getNumDirectAccessBuffers(radio->sdr, radio->rx_stream) == 0)
+        direct = false;
+    atomic_store(&radio->rx_direct, direct);
+
+    while(atomic_load_explicit(&radio->running, memory_order_relaxed)){
+        int flags = 0;
+        long long time_ns = 0;
+        int ret;
+
+        if(direct){
+            size_t handle;
+            const void *rx_buffs[1];
+            ret = SoapySDRDevice_acquireReadBuffer(radio->sdr, radio->rx_stream, &handle, rx_buffs, &flags, &time_ns, SOAPY_TDMA_IO_TIMEOUT_US);
+            if(ret == SOAPY_SDR_NOT_SUPPORTED){
+                /* Driver advertised buffers but can't hand them out; go back to copying */
+                direct = false;
+                atomic_store(&radio->rx_direct, false);
+                continue;
+            }
+            if(ret < 0){
+                soapy_tdma_rx_error(radio, &st, ret);
+                continue;
+            }
+            /* DMA buffers may be bigger than the MTU our scratch buffers are sized for */
+            const u8 * dma_buf = (const u8*) rx_buffs[0];
+            size_t i;
+            for(i = 0; i < (size_t)ret; i += mtu){
+                size_t n = ((size_t)ret-i) > mtu ? mtu : ((size_t)ret-i);
+                soapy_tdma_rx_process(radio, &st, &dma_buf[i*radio->samp_size], n, i == 0 ? flags : 0, time_ns);
+            }
+            SoapySDRDevice_releaseReadBuffer(radio->sdr, radio->rx_stream, handle);
+        }else{
+            void *rx_buffs[] = { rx_buf };
+            ret = SoapySDRDevice_readStream(radio->sdr, radio->rx_stream, rx_buffs, mtu, &flags, &time_ns, SOAPY_TDMA_IO_TIMEOUT_US);
+            if(ret < 0){
+                soapy_tdma_rx_error(radio, &st, ret);
+                continue;
+            }
+            soapy_tdma_rx_process(radio, &st, rx_buf, ret, flags, time_ns);
+        }
+    }
+
+    soapy_tdma_rx_thread_exit:
+    free(rx_buf);
+    free(st.rx_buf_dm);
+    free(st.rx_buf_drop);
+    return NULL;
+}
+
+/* Count anything the radio has to say about how TX is going */
+static void soapy_tdma_check_tx_status(soapy_tdma_radio_t * radio){
+    size_t chan_mask;
+    int flags;
+    long long time_ns;
+    int ret;
+    while((ret = SoapySDRDevice_readStreamStatus(radio->sdr, radio->tx_stream, &chan_mask, &flags, &time_ns, 0)) != SOAPY_SDR_TIMEOUT){
+        if(ret == SOAPY_SDR_UNDERFLOW)
+            atomic_fetch_add_explicit(&radio->tx_underflows, 1, memory_order_relaxed);
+        else if(ret == SOAPY_SDR_TIME_ERROR)
+            atomic_fetch_add_explicit(&radio->tx_late, 1, memory_order_relaxed);
+        else if(ret < 0)
+            break;
+    }
+}
+
+/* Sort out an error code from writeStream or acquireWriteBuffer. Returns true if the burst should be abandoned */
+static bool soapy_tdma_tx_error(soapy_tdma_radio_t * radio, int ret){
+    if(ret == SOAPY_SDR_TIMEOUT)
+        return false;
+    if(ret == SOAPY_SDR_UNDERFLOW)
+        atomic_fetch_add_explicit(&radio->tx_underflows, 1, memory_order_relaxed);
+    else if(ret == SOAPY_SDR_TIME_ERROR)
+        atomic_fetch_add_explicit(&radio->tx_late, 1, memory_order_relaxed);
+    else
+        atomic_fetch_add_explicit(&radio->tx_errors, 1, memory_order_relaxed);
+    return true;
+}
+
+/* Upmix a burst straight into the driver's DMA buffers. Returns false if the driver can't do that.
+   CS16 bursts are already upmixed and converted in tx_buf by the front end and are just copied in. */
+static bool soapy_tdma_tx_direct(soapy_tdma_radio_t * radio, float complex * tx_buf_dm, const void * tx_buf, size_t n_bb, long long ts_tx_ns){
+    size_t nsamp_tx = 0;
+    while(nsamp_tx < n_bb){
+        size_t handle;
+        void *tx_buffs[1];
+        int ret = SoapySDRDevice_acquireWriteBuffer(radio->sdr, radio->tx_stream, &handle, tx_buffs, SOAPY_TDMA_IO_TIMEOUT_US);
+        if(ret == SOAPY_SDR_NOT_SUPPORTED)
+            return false;
+        if(ret < 0){
+            if(soapy_tdma_tx_error(radio, ret))
+                break;
+            continue;
+        }
+
+        size_t n = n_bb - nsamp_tx;
+        if(n > (size_t)ret) n = ret;
+        if(radio->cs16)
+            memcpy(tx_buffs[0], (const u8*)tx_buf + nsamp_tx*radio->samp_size, n*radio->samp_size);
+        else
+            nco_crcf_mix_block_up(radio->upmixer, &tx_buf_dm[nsamp_tx], (float complex*)tx_buffs[0], n);
+
+        int flags = 0;
+        if(nsamp_tx == 0) flags |= SOAPY_SDR_HAS_TIME;
+        if(nsamp_tx + n >= n_bb) flags |= SOAPY_SDR_END_BURST;
+        SoapySDRDevice_releaseWriteBuffer(radio->sdr, radio->tx_stream, handle, n, &flags, ts_tx_ns);
+        nsamp_tx += n;
+    }
+    return true;
+}
+
+/* Upmix a burst into a local buffer and copy it to the radio with writeStream */
+static void soapy_tdma_tx_copy(soapy_tdma_radio_t * radio, float complex * tx_buf_dm, void * tx_buf, size_t n_bb, long long ts_tx_ns){
+    if(!radio->cs16)
+        nco_crcf_mix_block_up(radio->upmixer, tx_buf_dm, (float complex*)tx_buf, n_bb);
+
+    size_t nsamp_tx = 0;
+    while(nsamp_tx < n_bb){
+        const void *tx_buffs[] = { (u8*)tx_buf + nsamp_tx*radio->samp_size };
+        int flags = SOAPY_SDR_END_BURST;
+        if(nsamp_tx == 0) flags |= SOAPY_SDR_HAS_TIME;
+        int ret = SoapySDRDevice_writeStream(radio->sdr, radio->tx_stream, tx_buffs, n_bb - nsamp_tx, &flags, ts_tx_ns, SOAPY_TDMA_IO_TIMEOUT_US);
+        if(ret < 0){
+            if(soapy_tdma_tx_error(radio, ret))
+                break;
+            continue;
+        }
+        nsamp_tx += ret;
+    }
+}
+
+/* TX thread. Take bursts from the DSP loop, upconvert, and write them to the radio with a timestamp */
+static void * soapy_tdma_tx_thread(void * arg){
+    soapy_tdma_radio_t * radio = (soapy_tdma_radio_t*) arg;
+    i64 Fs_bb = radio->tdma->settings.samp_rate;
+    float R = radio->radio_fs/(float)Fs_bb;
+    size_t n_bb_max = (size_t)ceilf(radio->tx_burst_samps*R) + 64;
+    bool direct = radio->use_direct_access;
+
+    if(soapy_tdma_pin_self(radio->tx_cpu))
+        fprintf(stderr,"Couldn't pin TX thread to CPU %d\n",radio->tx_cpu);
+
+    float complex * tx_buf = (float complex*) malloc(sizeof(float complex)*n_bb_max);
+    float complex * tx_buf_dm = (float complex*) malloc(sizeof(float complex)*n_bb_max);
+    if(tx_buf == NULL || tx_buf_dm == NULL){
+        fprintf(stderr,"TX thread couldn't allocate buffers\n");
+        free(tx_buf);
+        free(tx_buf_dm);
+        return NULL;
+    }
+
+    if(direct && SoapySDRDevice_getNumDirectAccessBuffers(radio->sdr, radio->tx_stream) == 0)
+        direct = false;
+    atomic_store(&radio->tx_direct, direct);
+
+    while(atomic_load_explicit(&radio->running, memory_order_relaxed)){
+        soapy_tdma_check_tx_status(radio);
+
+        soapy_tdma_tx_burst * burst = tdma_ring_read_acquire(radio->tx_ring);
+        if(burst == NULL){
+            soapy_tdma_sleep_poll();
+            continue;
+        }
+
+        float complex * samps = (float complex*)&burst->samps[0];
+        size_t i;
+        for(i = 0; i < burst->n_samps; i++)
+            samps[i] *= radio->tx_gain;
+
+        size_t n_bb = 0;
+        if(radio->cs16){
+            n_bb = tdma_fe_tx_cs16(radio->fe_tx, &burst->samps[0], burst->n_samps, (int16_t*)tx_buf);
+        }else{
+            unsigned int n_interp = 0;
+            msresamp_crcf_execute(radio->interp, samps, burst->n_samps, tx_buf_dm, &n_interp);
+            n_bb = n_interp;
+        }
+        long long ts_tx_ns = soapy_tdma_samps_to_ns(burst->timestamp, Fs_bb);
+        tdma_ring_read_release(radio->tx_ring);
+
+        if(direct && !soapy_tdma_tx_direct(radio, tx_buf_dm, tx_buf, n_bb, ts_tx_ns)){
+            direct = false;
+            atomic_store(&radio->tx_direct, false);
+        }
+        if(!direct)
+            soapy_tdma_tx_copy(radio, tx_buf_dm, tx_buf, n_bb, ts_tx_ns);
+        atomic_fetch_add_explicit(&radio->tx_bursts, 1, memory_order_relaxed);
+    }
+
+    free(tx_buf);
+    free(tx_buf_dm);
+    return NULL;
+}
+
+int soapy_tdma_start_streams(soapy_tdma_radio_t * radio){
+    if(radio->threads_started)
+        return 0;
+
+    if(!radio->rx_only_mode){
+        if(SoapySDRDevice_activateStream(radio->sdr, radio->tx_stream, 0, 0, 0)){
+            fprintf(stderr,"activateStream TX fail: %s\n", SoapySDRDevice_lastError());
+            return -1;
+        }
+    }
+    if(SoapySDRDevice_activateStream(radio->sdr, radio->rx_stream, 0, 0, 0)){
+        fprintf(stderr,"activateStream RX fail: %s\n", SoapySDRDevice_lastError());
+        if(!radio->rx_only_mode)
+            SoapySDRDevice_deactivateStream(radio->sdr, radio->tx_stream, 0, 0);
+        return -1;
+    }
+
+    atomic_store(&radio->running, true);
+    if(pthread_create(&radio->rx_thread, NULL, soapy_tdma_rx_thread, (void*)radio)){
+        atomic_store(&radio->running, false);
+        goto soapy_tdma_start_err;
+    }
+    if(!radio->rx_only_mode){
+        if(pthread_create(&radio->tx_thread, NULL, soapy_tdma_tx_thread, (void*)radio)){
+            atomic_store(&radio->running, false);
+            pthread_join(radio->rx_thread, NULL);
+            goto soapy_tdma_start_err;
+        }
+    }
+    radio->threads_started = true;
+    return 0;
+
+    soapy_tdma_start_err:
+    SoapySDRDevice_deactivateStream(radio->sdr, radio->rx_stream, 0, 0);
+    if(!radio->rx_only_mode)
+        SoapySDRDevice_deactivateStream(radio->sdr, radio->tx_stream, 0, 0);
+    return -1;
+}
+
+int soapy_tdma_stop_streams(soapy_tdma_radio_t * radio){
+    if(!radio->threads_started)
+        return 0;
+
+    atomic_store(&radio->running, false);
+    pthread_join(radio->rx_thread, NULL);
+    if(!radio->rx_only_mode)
+        pthread_join(radio->tx_thread, NULL);
+    radio->threads_started = false;
+
+    SoapySDRDevice_deactivateStream(radio->sdr, radio->rx_stream, 0, 0);
+    if(!radio->rx_only_mode)
+        SoapySDRDevice_deactivateStream(radio->sdr, radio->tx_stream, 0, 0);
+    return 0;
+}
+
+int soapy_tdma_loop(soapy_tdma_radio_t * radio){
+    size_t nin = tdma_nin(radio->tdma);
+    size_t fill = 0;
+    i64 slot_ts = 0;
+
+    while(fill < nin){
+        if(radio->rx_cur == NULL){
+            radio->rx_cur = tdma_ring_read_acquire(radio->rx_ring);
+            radio->rx_cur_off = 0;
+            if(radio->rx_cur == NULL){
+                if(!atomic_load_explicit(&radio->running, memory_order_relaxed))
+                    return -1;
+                soapy_tdma_sleep_poll();
+                continue;
+            }
+        }
+
+        soapy_tdma_rx_block * block = radio->rx_cur;
+        /* Samples were lost before this block; the partial slot isn't contiguous, so start again from here */
+        if(radio->rx_cur_off == 0 && (block->flags & SOAPY_TDMA_BLOCK_DISCONT) && fill > 0){
+            atomic_fetch_add_explicit(&radio->rx_slot_discards, 1, memory_order_relaxed);
+            fill = 0;
+        }
+        if(fill == 0)
+            slot_ts = block->timestamp + radio->rx_cur_off;
+
+        size_t n = block->n_samps - radio->rx_cur_off;
+        if(n > (nin-fill))
+            n = nin-fill;
+        memcpy(&radio->rx_slot_buf[fill], &block->samps[radio->rx_cur_off], sizeof(COMP)*n);
+        fill += n;
+        radio->rx_cur_off += n;
+
+        if(radio->rx_cur_off >= block->n_samps){
+            tdma_ring_read_release(radio->rx_ring);
+            radio->rx_cur = NULL;
+        }
+    }
+
+    tdma_rx(radio->tdma, radio->rx_slot_buf, slot_ts);
+    return 0;
+}
+
+void soapy_tdma_get_stats(soapy_tdma_radio_t * radio, struct SOAPY_TDMA_STATS * stats){
+    stats->rx_samps = atomic_load_explicit(&radio->rx_samps, memory_order_relaxed);
+    stats->rx_overflows = atomic_load_explicit(&radio->rx_overflows, memory_order_relaxed);
+    stats->rx_ring_drops = atomic_load_explicit(&radio->rx_ring_drops, memory_order_relaxed);
+    stats->rx_errors = atomic_load_explicit(&radio->rx_errors, memory_order_relaxed);
+    stats->rx_slot_discards = atomic_load_explicit(&radio->rx_slot_discards, memory_order_relaxed);
+    stats->tx_bursts = atomic_load_explicit(&radio->tx_bursts, memory_order_relaxed);
+    stats->tx_underflows = atomic_load_explicit(&radio->tx_underflows, memory_order_relaxed);
+    stats->tx_late = atomic_load_explicit(&radio->tx_late, memory_order_relaxed);
+    stats->tx_ring_drops = atomic_load_explicit(&radio->tx_ring_drops, memory_order_relaxed);
+    stats->tx_errors = atomic_load_explicit(&radio->tx_errors, memory_order_relaxed);
+    stats->rx_direct = atomic_load_explicit(&radio->rx_direct, memory_order_relaxed);
+    stats->tx_direct = atomic_load_explicit(&radio->tx_direct, memory_order_relaxed);
+}
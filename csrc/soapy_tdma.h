@@ -30,9 +30,47 @@
 #include <SoapySDR/Device.h>
 #include <SoapySDR/Formats.h>
 #include <tdma.h>
+#include <tdma_ring.h>
 #include <stdbool.h>
 #include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
 #include <liquid/liquid.h>
+#include "tdma_frontend.h"
+
+/* Flag set on an RX block if samples were lost before it */
+#define SOAPY_TDMA_BLOCK_DISCONT 0x1
+
+/* Block of modem-rate samples passed from the RX thread to the DSP loop */
+typedef struct {
+    i64 timestamp;                  /* Timestamp of samps[0], in modem sample periods */
+    u32 n_samps;                    /* Number of valid samples */
+    u32 flags;                      /* SOAPY_TDMA_BLOCK_* flags */
+    COMP samps[];
+} soapy_tdma_rx_block;
+
+/* Burst of modem-rate samples passed from the DSP loop to the TX thread */
+typedef struct {
+    i64 timestamp;                  /* Time to start the burst, in modem sample periods */
+    u32 n_samps;                    /* Number of valid samples */
+    COMP samps[];
+} soapy_tdma_tx_burst;
+
+/* Counters kept by the radio I/O threads */
+struct SOAPY_TDMA_STATS {
+    u64 rx_samps;                   /* Radio samples read */
+    u64 rx_overflows;               /* Overflows reported by the radio */
+    u64 rx_ring_drops;              /* RX blocks dropped because the DSP loop fell behind */
+    u64 rx_errors;                  /* Other errors from readStream */
+    u64 rx_slot_discards;           /* Partial slots thrown away because samples were lost under them */
+    u64 tx_bursts;                  /* Bursts written to the radio */
+    u64 tx_underflows;              /* Underflows reported by the radio */
+    u64 tx_late;                    /* Bursts the radio reported as late */
+    u64 tx_ring_drops;              /* Bursts dropped because the TX thread fell behind */
+    u64 tx_errors;                  /* Other errors from writeStream */
+    bool rx_direct;                 /* RX is mixing straight out of driver DMA buffers */
+    bool tx_direct;                 /* TX is mixing straight into driver DMA buffers */
+};
 
 typedef struct {
     SoapySDRStream * tx_stream;     /* Soapy stream for TX */
@@ -40,28 +78,77 @@ typedef struct {
     SoapySDRDevice * sdr;           /* Soapy SDR device */
     bool rx_only_mode;              /* Flag set if this modem is only rx-ing TDMA frames */
     tdma_t * tdma;                  /* TDMA modem */
-    msresamp_crcf  decim;          /* Radio -> TDMA decimator */
-    msresamp_crcf  interp;         /* TDMA -> radio interpolator */
+    msresamp_crcf  decim;          /* Radio -> TDMA decimator, owned by RX thread */
+    msresamp_crcf  interp;         /* TDMA -> radio interpolator, owned by TX thread */
     nco_crcf downmixer;
     nco_crcf upmixer;
 
-
-
     float radio_fs;                /* SDR sample rate */
     float radio_fc;                /* SDR center frequency */
     float shift;                   /* Frequency shift */
-    size_t mtu;                     /* MTU of tx stream */
-
-    /* TX stuff */
-    float complex * tx_buf_bb;
-    uint64_t tx_time;
-    bool tx_ready;
-    
+    size_t mtu;                     /* MTU of rx stream */
+    size_t tx_mtu;                  /* MTU of tx stream */
+    float tx_gain;                  /* Scale applied to TX samples before upconversion */
+    bool use_direct_access;         /* Use driver DMA buffers if available. Set before starting streams */
+    bool cs16;                      /* Streams are CS16 rather than CF32 */
+    size_t samp_size;               /* Bytes per radio sample in the stream format */
+    tdma_fe_rx_t * fe_rx;           /* CS16 radio -> TDMA front end, owned by RX thread */
+    tdma_fe_tx_t * fe_tx;           /* TDMA -> CS16 radio front end, owned by TX thread */
+
+    /* Threading */
+    pthread_t rx_thread;            /* Radio RX thread; reads, downconverts, and fills rx_ring */
+    pthread_t tx_thread;            /* Radio TX thread; drains tx_ring, upconverts, and writes */
+    int rx_cpu;                     /* CPU to pin the RX thread to, -1 for none */
+    int tx_cpu;                     /* CPU to pin the TX thread to, -1 for none */
+    atomic_bool running;            /* Cleared to stop the I/O threads */
+    bool threads_started;
+
+    tdma_ring_t * rx_ring;          /* soapy_tdma_rx_block, RX thread -> DSP loop */
+    tdma_ring_t * tx_ring;          /* soapy_tdma_tx_burst, DSP loop -> TX thread */
+    size_t rx_block_samps;          /* Capacity of an RX block, in modem samples */
+    size_t tx_burst_samps;          /* Capacity of a TX burst, in modem samples */
+
+    /* DSP loop state */
+    COMP * rx_slot_buf;             /* One slot's worth of modem samples */
+    soapy_tdma_rx_block * rx_cur;   /* Partially consumed RX block */
+    u32 rx_cur_off;                 /* Samples of rx_cur already consumed */
+
+    /* Counters, updated by the I/O threads */
+    _Atomic u64 rx_samps;
+    _Atomic u64 rx_overflows;
+    _Atomic u64 rx_ring_drops;
+    _Atomic u64 rx_errors;
+    _Atomic u64 rx_slot_discards;   /* Updated by the DSP loop */
+    _Atomic u64 tx_bursts;
+    _Atomic u64 tx_underflows;
+    _Atomic u64 tx_late;
+    _Atomic u64 tx_ring_drops;
+    _Atomic u64 tx_errors;
+    atomic_bool rx_direct;          /* Set by the I/O threads once they've picked a buffer path */
+    atomic_bool tx_direct;
 } soapy_tdma_radio_t;
 
-soapy_tdma_radio_t * soapy_tdma_create(SoapySDRDevice * sdr,tdma_t * tdma, float shift,int * err, bool rx_only);
+/* format is SOAPY_SDR_CF32 or SOAPY_SDR_CS16, or NULL for CF32 */
+soapy_tdma_radio_t * soapy_tdma_create(SoapySDRDevice * sdr,tdma_t * tdma, float shift,int * err, bool rx_only, const char * format);
+void soapy_tdma_destroy(soapy_tdma_radio_t * radio);
+
+/* Pin the radio I/O threads to CPUs. Must be called before soapy_tdma_start_streams. -1 to not pin. */
+void soapy_tdma_set_affinity(soapy_tdma_radio_t * radio, int rx_cpu, int tx_cpu);
+
+/* Pin the calling thread to a CPU. Returns 0 on success */
+int soapy_tdma_pin_self(int cpu);
+
+/* Activate the radio streams and start the I/O threads */
 int soapy_tdma_start_streams(soapy_tdma_radio_t * radio);
+
+/* Stop the I/O threads and deactivate the radio streams */
 int soapy_tdma_stop_streams(soapy_tdma_radio_t * radio);
+
+/* Wait for one slot of samples from the RX thread and run it through the modem.
+   Returns 0 on success, -1 if the streams have been stopped */
 int soapy_tdma_loop(soapy_tdma_radio_t * radio);
 
-#endif
\ No newline at end of file
+/* Get a snapshot of the I/O thread counters */
+void soapy_tdma_get_stats(soapy_tdma_radio_t * radio, struct SOAPY_TDMA_STATS * stats);
+
+#endif
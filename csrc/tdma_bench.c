@@ -0,0 +1,649 @@
+/*---------------------------------------------------------------------------*\
+
+  FILE........: tdma_bench.c
+  AUTHOR......: Brady O'Brien
+  DATE CREATED: 19 October 2026
+
+  Microbenchmarks for the modem's hot paths, in the 4800T mode. Each one is
+  run in batches until it has taken at least the minimum time, a few times
+  over, and the median is reported. Results are printed as JSON so runs can
+  be saved and compared. With -j, it also runs a modem per thread on that
+  many threads at once, to shake out shared state and to see how the
+  throughput scales.
+
+\*---------------------------------------------------------------------------*/
+
+/*
+  Copyright (C) 2026 Brady O'Brien
+
+  All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License version 2.1, as
+  published by the Free Software Foundation.  This program is
+  distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <math.h>
+#include <unistd.h>
+#include <time.h>
+#include <pthread.h>
+#include <tdma.h>
+#include <golay23.h>
+#include <modem_stats.h>
+#include <modem_spectrum.h>
+#include <modem_fft.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846264338327950288
+#endif
+
+/* Times each benchmark is measured; the median is reported */
+#define BENCH_REPEATS 5
+
+/* Slots of test signal to cycle through. The buffers have BENCH_SIG_PAD more
+   so that a demod wanting a little over a slot doesn't run off the end */
+#define BENCH_SIG_SLOTS 64
+#define BENCH_SIG_PAD 2
+
+/* Codewords per golay benchmark call */
+#define BENCH_GOLAY_N 4096
+
+struct BENCH_RESULT {
+    const char * name;
+    double ns_per_call;             /* Median over repeats */
+    double ns_per_call_min;
+    size_t samps_per_call;          /* Modem samples handled by one call; 0 if it doesn't apply */
+};
+
+/* A benchmark: fn is called once per iteration with ctx */
+struct BENCH {
+    const char * name;
+    void (*fn)(void * ctx);
+    void * ctx;
+    size_t samps_per_call;
+    size_t ops_per_call;            /* Underlying calls made by one fn call */
+};
+
+/* State shared by the benchmarks */
+struct BENCH_CTX {
+    struct TDMA_MODE_SETTINGS mode;
+    COMP * sig;                     /* BENCH_SIG_SLOTS slots of modulated frames */
+    COMP * noise;                   /* BENCH_SIG_SLOTS slots of noise */
+    size_t slot_samps;
+    size_t pos;
+    fsk_t * fsk;
+    u8 * bits;
+    float * sd;
+    float * spec;
+    tdma_t * tdma;
+    u64 timestamp;
+    struct MODEM_STATS * stats;
+    modem_spectrum_t * spectrum;
+    int * golay_in;
+    int * golay_out;
+    int * golay_dec;
+    float * golay_rel;
+    volatile int sink;              /* Keeps results alive past the optimiser */
+    size_t uw_nbits;
+};
+
+static u64 bench_rng = 1;
+
+static u64 bench_rand(void){
+    bench_rng ^= bench_rng >> 12;
+    bench_rng ^= bench_rng << 25;
+    bench_rng ^= bench_rng >> 27;
+    return bench_rng * 2685821657736338717ULL;
+}
+
+static double bench_gauss(void){
+    double u1 = ((bench_rand() >> 11) + 1) * (1.0/9007199254740993.0);
+    double u2 = ((bench_rand() >> 11) + 1) * (1.0/9007199254740993.0);
+    return sqrt(-2.*log(u1))*cos(2.*M_PI*u2);
+}
+
+static double bench_now_ns(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec*1e9 + ts.tv_nsec;
+}
+
+static int bench_cmp_double(const void * a, const void * b){
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+/* Time a benchmark. Batches grow until one takes min_secs */
+static void bench_run(struct BENCH * b, double min_secs, struct BENCH_RESULT * res){
+    double per_call[BENCH_REPEATS];
+    size_t iters = 1;
+    size_t i;
+    int r;
+
+    /* Warm up caches, and let adaptive state (nin, sync) settle */
+    for(i = 0; i < 8; i++)
+        b->fn(b->ctx);
+
+    for(;;){
+        double t0 = bench_now_ns();
+        for(i = 0; i < iters; i++)
+            b->fn(b->ctx);
+        double t = bench_now_ns() - t0;
+        if(t >= min_secs*1e9 || iters >= ((size_t)1 << 30))
+            break;
+        iters *= 2;
+    }
+
+    for(r = 0; r < BENCH_REPEATS; r++){
+        double t0 = bench_now_ns();
+        for(i = 0; i < iters; i++)
+            b->fn(b->ctx);
+        per_call[r] = (bench_now_ns() - t0)/(iters*b->ops_per_call);
+    }
+    qsort(per_call, BENCH_REPEATS, sizeof(double), bench_cmp_double);
+
+    res->name = b->name;
+    res->ns_per_call = per_call[BENCH_REPEATS/2];
+    res->ns_per_call_min = per_call[0];
+    res->samps_per_call = b->samps_per_call/b->ops_per_call;
+}
+
+/* Next slot of test signal */
+static COMP * bench_next_slot(struct BENCH_CTX * c, COMP * buf){
+    COMP * p = &buf[c->pos*c->slot_samps];
+    c->pos = (c->pos+1) % BENCH_SIG_SLOTS;
+    return p;
+}
+
+static void bench_fsk2_demod(void * ctx){
+    struct BENCH_CTX * c = (struct BENCH_CTX*) ctx;
+    fsk2_demod(c->fsk, c->bits, c->sd, bench_next_slot(c, c->sig));
+}
+
+static void bench_fsk_freq_est(void * ctx){
+    struct BENCH_CTX * c = (struct BENCH_CTX*) ctx;
+    float freqs[4];
+    fsk_demod_freq_est(c->fsk, bench_next_slot(c, c->sig), freqs, c->fsk->mode);
+}
+
+static void bench_fsk_mod_c(void * ctx){
+    struct BENCH_CTX * c = (struct BENCH_CTX*) ctx;
+    fsk_mod_c(c->fsk, c->sig, c->bits);
+}
+
+static void bench_search_uw(void * ctx){
+    struct BENCH_CTX * c = (struct BENCH_CTX*) ctx;
+    size_t delta, uw_type;
+    c->sink += tdma_search_uw(c->tdma, c->bits, c->uw_nbits, &delta, &uw_type);
+}
+
+static void bench_tdma_rx_sig(void * ctx){
+    struct BENCH_CTX * c = (struct BENCH_CTX*) ctx;
+    tdma_rx(c->tdma, bench_next_slot(c, c->sig), c->timestamp);
+    c->timestamp += c->slot_samps;
+}
+
+static void bench_tdma_rx_noise(void * ctx){
+    struct BENCH_CTX * c = (struct BENCH_CTX*) ctx;
+    tdma_rx(c->tdma, bench_next_slot(c, c->noise), c->timestamp);
+    c->timestamp += c->slot_samps;
+}
+
+static void bench_golay_encode(void * ctx){
+    struct BENCH_CTX * c = (struct BENCH_CTX*) ctx;
+    int i, s = 0;
+    for(i = 0; i < BENCH_GOLAY_N; i++)
+        s += golay23_encode(c->golay_in[i]);
+    c->sink += s;
+}
+
+static void bench_golay_decode(void * ctx){
+    struct BENCH_CTX * c = (struct BENCH_CTX*) ctx;
+    int i, s = 0;
+    for(i = 0; i < BENCH_GOLAY_N; i++)
+        s += golay23_decode(c->golay_out[i]);
+    c->sink += s;
+}
+
+static void bench_golay_decode_soft(void * ctx){
+    struct BENCH_CTX * c = (struct BENCH_CTX*) ctx;
+    int i, s = 0;
+    for(i = 0; i < BENCH_GOLAY_N; i++)
+        s += golay23_decode_soft(c->golay_out[i], &c->golay_rel[i*23], NULL);
+    c->sink += s;
+}
+
+static void bench_golay_decode_batch(void * ctx){
+    struct BENCH_CTX * c = (struct BENCH_CTX*) ctx;
+    golay23_decode_batch(c->golay_out, c->golay_dec, NULL, BENCH_GOLAY_N);
+    c->sink += c->golay_dec[BENCH_GOLAY_N-1];
+}
+
+static void bench_rx_spectrum(void * ctx){
+    struct BENCH_CTX * c = (struct BENCH_CTX*) ctx;
+    modem_stats_get_rx_spectrum(c->stats, c->spec, bench_next_slot(c, c->sig), c->slot_samps);
+}
+
+/* Bring up and tear down a channelised receiver's worth of modems */
+#define BENCH_N_MODEMS 64
+
+static void bench_tdma_create(void * ctx){
+    struct BENCH_CTX * c = (struct BENCH_CTX*) ctx;
+    tdma_t * t[BENCH_N_MODEMS];
+    int i;
+    for(i = 0; i < BENCH_N_MODEMS; i++)
+        t[i] = tdma_create(c->mode);
+    for(i = 0; i < BENCH_N_MODEMS; i++)
+        if(t[i] != NULL) tdma_destroy(t[i]);
+}
+
+static void bench_spectrum(void * ctx){
+    struct BENCH_CTX * c = (struct BENCH_CTX*) ctx;
+    modem_spectrum_push(c->spectrum, bench_next_slot(c, c->sig), c->slot_samps);
+    while(modem_spectrum_read(c->spectrum, c->spec));
+}
+
+/* Independent modems on their own threads, sharing only the read only test signal */
+struct BENCH_THREAD {
+    pthread_t thread;
+    const struct BENCH_CTX * c;
+    double min_secs;
+    size_t slots;                   /* tdma_rx calls timed */
+    double ns;                      /* Time they took */
+    bool synced;
+    int golay_errs;                 /* Decodes that came out differently to the single threaded ones */
+    int failed;
+};
+
+static void * bench_thread(void * arg){
+    struct BENCH_THREAD * bt = (struct BENCH_THREAD*) arg;
+    const struct BENCH_CTX * c = bt->c;
+    tdma_t * tdma;
+    size_t pos = 0;
+    int i;
+
+    /* Churn through modems first, so plan creation races on every thread */
+    for(i = 0; i < 8; i++){
+        tdma = tdma_create(c->mode);
+        if(tdma == NULL){
+            bt->failed = 1;
+            return NULL;
+        }
+        tdma_destroy(tdma);
+    }
+    tdma = tdma_create(c->mode);
+    if(tdma == NULL){
+        bt->failed = 1;
+        return NULL;
+    }
+    tdma->tx_multislot_delay = 0;
+    tdma->loop_delay = 0;
+
+    u64 timestamp = 0;
+    for(i = 0; i < 4*BENCH_SIG_SLOTS; i++){
+        tdma_rx(tdma, &c->sig[pos*c->slot_samps], timestamp);
+        pos = (pos+1) % BENCH_SIG_SLOTS;
+        timestamp += c->slot_samps;
+    }
+
+    double t0 = bench_now_ns();
+    do{
+        for(i = 0; i < BENCH_SIG_SLOTS; i++){
+            tdma_rx(tdma, &c->sig[pos*c->slot_samps], timestamp);
+            pos = (pos+1) % BENCH_SIG_SLOTS;
+            timestamp += c->slot_samps;
+        }
+        bt->slots += BENCH_SIG_SLOTS;
+        bt->ns = bench_now_ns() - t0;
+    }while(bt->ns < bt->min_secs*1e9);
+    bt->synced = tdma_get_slot(tdma, 0)->state == rx_sync || tdma_get_slot(tdma, 1)->state == rx_sync;
+    tdma_destroy(tdma);
+
+    /* Golay tables are shared by every thread. golay_dec holds the soft decodes made on one thread */
+    for(i = 0; i < BENCH_GOLAY_N; i++){
+        if((golay23_decode(c->golay_out[i]) >> 11) != c->golay_in[i])
+            bt->golay_errs++;
+        if(golay23_decode_soft(c->golay_out[i], &c->golay_rel[i*23], NULL) != c->golay_dec[i])
+            bt->golay_errs++;
+    }
+    return NULL;
+}
+
+/* Fill c->sig with slots of centred master frames, plus a little noise, and c->noise with only noise */
+static int bench_make_signal(struct BENCH_CTX * c){
+    struct TDMA_MODE_SETTINGS mode = c->mode;
+    u32 Ts = mode.samp_rate/mode.sym_rate;
+    size_t bps = (mode.fsk_m == 2) ? 1 : 2;
+    size_t frame_bits = mode.frame_size*bps;
+    size_t uw_offset = (frame_bits - mode.uw_len)/2;
+    size_t pad = ((mode.slot_size - mode.frame_size)/2)*Ts;
+    u8 bits[frame_bits];
+    size_t i, s;
+
+    fsk_t * fsk = fsk_create_hbr(mode.samp_rate,mode.sym_rate,Ts,mode.fsk_m,mode.sym_rate,mode.sym_rate);
+    if(fsk == NULL) return -1;
+    if(fsk_set_nsym(fsk, mode.frame_size)){
+        fsk_destroy(fsk);
+        return -1;
+    }
+
+    for(s = 0; s < BENCH_SIG_SLOTS; s++){
+        COMP * slot = &c->sig[s*c->slot_samps];
+        for(i = 0; i < frame_bits; i++)
+            bits[i] = bench_rand() >> 63;
+        memcpy(&bits[uw_offset], c->tdma->uw_list[0], mode.uw_len);
+        bits[c->tdma->master_bit_pos] = 1;
+        memset(slot, 0, sizeof(COMP)*c->slot_samps);
+        fsk_mod_c(fsk, &slot[pad], bits);
+        for(i = 0; i < c->slot_samps; i++){
+            slot[i].real = slot[i].real*.5 + bench_gauss()*.05;
+            slot[i].imag = slot[i].imag*.5 + bench_gauss()*.05;
+            c->noise[s*c->slot_samps + i].real = bench_gauss()*M_SQRT1_2;
+            c->noise[s*c->slot_samps + i].imag = bench_gauss()*M_SQRT1_2;
+        }
+    }
+    fsk_destroy(fsk);
+    return 0;
+}
+
+static void usage(const char * name){
+    fprintf(stderr,"usage: %s [-t min_secs] [-f filter] [-k] [-w wisdom_file] [-j threads]\n",name);
+    fprintf(stderr,"  -t  minimum time for each measurement (default 0.2)\n");
+    fprintf(stderr,"  -f  only run benchmarks whose name contains filter\n");
+    fprintf(stderr,"  -k  use kiss_fft rather than FFTW\n");
+    fprintf(stderr,"  -w  use measured FFTW plans, kept in wisdom_file between runs\n");
+    fprintf(stderr,"  -j  also run a synced modem on each of this many threads at once\n");
+}
+
+int main(int argc,char ** argv){
+    struct BENCH_CTX c;
+    struct TDMA_MODE_SETTINGS mode = FREEDV_4800T;
+    double min_secs = .2;
+    const char * filter = NULL;
+    const char * wisdom = NULL;
+    int n_threads = 0;
+    int opt, i;
+
+    while((opt = getopt(argc, argv, "t:f:kw:j:h")) != -1){
+        switch(opt){
+            case 't': min_secs = atof(optarg); break;
+            case 'f': filter = optarg; break;
+            case 'k':
+                if(modem_fft_set_backend(MODEM_FFT_KISS)){
+                    fprintf(stderr,"kiss_fft isn't built in\n");
+                    return EXIT_FAILURE;
+                }
+                break;
+            case 'w': wisdom = optarg; break;
+            case 'j': n_threads = atoi(optarg); break;
+            default:
+                usage(argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+
+    /* Measure whatever the wisdom doesn't already cover */
+    if(wisdom != NULL && modem_fft_load_wisdom(wisdom))
+        modem_fft_set_planning(MODEM_FFT_MEASURE);
+
+    u32 Fs = mode.samp_rate;
+    u32 Rs = mode.sym_rate;
+    u32 Ts = Fs/Rs;
+    size_t bps = (mode.fsk_m == 2) ? 1 : 2;
+
+    memset(&c, 0, sizeof(c));
+    c.mode = mode;
+    c.slot_samps = mode.slot_size*Ts;
+    c.sig = (COMP*) calloc(c.slot_samps*(BENCH_SIG_SLOTS+BENCH_SIG_PAD), sizeof(COMP));
+    c.noise = (COMP*) calloc(c.slot_samps*(BENCH_SIG_SLOTS+BENCH_SIG_PAD), sizeof(COMP));
+    c.bits = (u8*) malloc(4*(mode.slot_size+2)*bps);
+    c.sd = (float*) malloc(sizeof(float)*4*(mode.slot_size+2)*bps);
+    c.spec = (float*) malloc(sizeof(float)*MODEM_STATS_NSPEC);
+    c.golay_in = (int*) malloc(sizeof(int)*BENCH_GOLAY_N);
+    c.golay_out = (int*) malloc(sizeof(int)*BENCH_GOLAY_N);
+    c.golay_dec = (int*) malloc(sizeof(int)*BENCH_GOLAY_N);
+    c.golay_rel = (float*) malloc(sizeof(float)*23*BENCH_GOLAY_N);
+    c.stats = (struct MODEM_STATS*) malloc(sizeof(struct MODEM_STATS));
+    c.tdma = tdma_create(mode);
+    if(c.sig == NULL || c.noise == NULL || c.bits == NULL || c.sd == NULL || c.spec == NULL
+        || c.golay_in == NULL || c.golay_out == NULL || c.golay_dec == NULL || c.golay_rel == NULL || c.stats == NULL || c.tdma == NULL){
+        fprintf(stderr,"Couldn't allocate benchmark state\n");
+        return EXIT_FAILURE;
+    }
+    c.tdma->tx_multislot_delay = 0;
+    c.tdma->loop_delay = 0;
+    if(bench_make_signal(&c)){
+        fprintf(stderr,"Couldn't make test signal\n");
+        return EXIT_FAILURE;
+    }
+
+    struct BENCH_RESULT results[32];
+    int n_results = 0;
+
+    #define BENCH_DO(b_name, b_fn, b_samps, b_ops) do { \
+        struct BENCH b = {b_name, b_fn, (void*)&c, b_samps, b_ops}; \
+        if(filter == NULL || strstr(b_name, filter) != NULL){ \
+            c.pos = 0; \
+            bench_run(&b, min_secs, &results[n_results++]); \
+        } \
+    } while(0)
+
+    /* FSK demod, both modes, as a slot demod and as a streaming demod */
+    int M;
+    for(M = 2; M <= 4; M += 2){
+        const char * name_burst = M == 2 ? "fsk2_demod_m2_burst" : "fsk2_demod_m4_burst";
+        const char * name_stream = M == 2 ? "fsk2_demod_m2_stream" : "fsk2_demod_m4_stream";
+        const char * name_est = M == 2 ? "fsk_demod_freq_est_m2" : "fsk_demod_freq_est_m4";
+
+        c.fsk = fsk_create_hbr(Fs,Rs,Ts,M,Rs,Rs);
+        if(c.fsk == NULL || fsk_enable_burst_mode(c.fsk, mode.slot_size+1)){
+            fprintf(stderr,"Couldn't create FSK modem\n");
+            return EXIT_FAILURE;
+        }
+        BENCH_DO(name_burst, bench_fsk2_demod, fsk_nin(c.fsk), 1);
+        BENCH_DO(name_est, bench_fsk_freq_est, fsk_nin(c.fsk), 1);
+        fsk_destroy(c.fsk);
+
+        /* Stream mode adjusts nin for timing, which the cycled slots don't need */
+        c.fsk = fsk_create_hbr(Fs,Rs,Ts,M,Rs,Rs);
+        if(c.fsk == NULL){
+            fprintf(stderr,"Couldn't create FSK modem\n");
+            return EXIT_FAILURE;
+        }
+        BENCH_DO(name_stream, bench_fsk2_demod, fsk_nin(c.fsk), 1);
+        fsk_destroy(c.fsk);
+    }
+
+    c.fsk = fsk_create_hbr(Fs,Rs,Ts,mode.fsk_m,Rs,Rs);
+    if(c.fsk == NULL || fsk_set_nsym(c.fsk, mode.frame_size)){
+        fprintf(stderr,"Couldn't create FSK modem\n");
+        return EXIT_FAILURE;
+    }
+    for(i = 0; i < (int)(mode.frame_size*bps); i++)
+        c.bits[i] = bench_rand() >> 63;
+    BENCH_DO("fsk_mod_c", bench_fsk_mod_c, mode.frame_size*Ts, 1);
+    fsk_destroy(c.fsk);
+    c.fsk = NULL;
+
+    /* UW search over a slot's worth of bits, as the slot demod does */
+    c.uw_nbits = (mode.slot_size+1)*bps;
+    for(i = 0; i < (int)c.uw_nbits; i++)
+        c.bits[i] = bench_rand() >> 63;
+    BENCH_DO("tdma_search_uw", bench_search_uw, 0, 1);
+    bench_make_signal(&c);
+
+    /* tdma_rx on a signal it can sync to. Prime it so it's synced before timing starts */
+    for(i = 0; i < 4*BENCH_SIG_SLOTS; i++)
+        bench_tdma_rx_sig(&c);
+    tdma_reset_perf(c.tdma);
+    BENCH_DO("tdma_rx_synced", bench_tdma_rx_sig, c.slot_samps, 1);
+    struct TDMA_PERF_STATS perf;
+    tdma_get_perf(c.tdma, &perf);
+    bool synced = tdma_get_slot(c.tdma, 0)->state == rx_sync || tdma_get_slot(c.tdma, 1)->state == rx_sync;
+    size_t footprint = tdma_get_footprint(c.tdma);
+    tdma_destroy(c.tdma);
+
+    c.tdma = tdma_create(mode);
+    c.tdma->tx_multislot_delay = 0;
+    c.tdma->loop_delay = 0;
+    BENCH_DO("tdma_rx_unsynced", bench_tdma_rx_noise, c.slot_samps, 1);
+    tdma_destroy(c.tdma);
+    c.tdma = NULL;
+
+    /* Plans come out of the cache, so this is mostly malloc */
+    BENCH_DO("tdma_create_64", bench_tdma_create, 0, BENCH_N_MODEMS);
+
+    /* Golay, over every data word and over codewords with up to 3 errors */
+    golay23_init();
+    for(i = 0; i < BENCH_GOLAY_N; i++){
+        int e = 0, k;
+        c.golay_in[i] = i & 0xFFF;
+        for(k = 0; k < (int)(bench_rand() % 4); k++)
+            e |= 1 << (bench_rand() % 23);
+        c.golay_out[i] = golay23_encode(c.golay_in[i]) ^ e;
+        /* Flipped bits tend to be the unreliable ones */
+        for(k = 0; k < 23; k++)
+            c.golay_rel[i*23+k] = (float)(bench_rand() % 1000)*((e >> k) & 1 ? .0005f : .001f);
+    }
+    BENCH_DO("golay23_encode", bench_golay_encode, 0, BENCH_GOLAY_N);
+    BENCH_DO("golay23_decode", bench_golay_decode, 0, BENCH_GOLAY_N);
+    BENCH_DO("golay23_decode_batch", bench_golay_decode_batch, 0, BENCH_GOLAY_N);
+    BENCH_DO("golay23_decode_soft", bench_golay_decode_soft, 0, BENCH_GOLAY_N);
+
+    modem_stats_open(c.stats);
+    BENCH_DO("modem_stats_get_rx_spectrum", bench_rx_spectrum, c.slot_samps, 1);
+    modem_stats_close(c.stats);
+
+    /* Same spectrum from the streaming engine */
+    struct MODEM_SPECTRUM_CONFIG spec_cfg;
+    modem_spectrum_default_config(&spec_cfg);
+    c.spectrum = modem_spectrum_create(&spec_cfg);
+    if(c.spectrum != NULL){
+        BENCH_DO("modem_spectrum", bench_spectrum, c.slot_samps, 1);
+        modem_spectrum_destroy(c.spectrum);
+    }
+
+    #undef BENCH_DO
+
+    /* Many modems at once */
+    struct BENCH_THREAD * threads = NULL;
+    size_t thread_slots = 0;
+    double thread_ns_max = 0;
+    bool threads_ok = true;
+    if(n_threads > 0){
+        for(i = 0; i < BENCH_GOLAY_N; i++)
+            c.golay_dec[i] = golay23_decode_soft(c.golay_out[i], &c.golay_rel[i*23], NULL);
+        threads = (struct BENCH_THREAD*) calloc(n_threads, sizeof(struct BENCH_THREAD));
+        if(threads == NULL){
+            fprintf(stderr,"Couldn't allocate benchmark state\n");
+            return EXIT_FAILURE;
+        }
+        for(i = 0; i < n_threads; i++){
+            threads[i].c = &c;
+            threads[i].min_secs = min_secs*BENCH_REPEATS;
+            if(pthread_create(&threads[i].thread, NULL, bench_thread, &threads[i])){
+                fprintf(stderr,"Couldn't start thread %d\n",i);
+                return EXIT_FAILURE;
+            }
+        }
+        for(i = 0; i < n_threads; i++){
+            pthread_join(threads[i].thread, NULL);
+            thread_slots += threads[i].slots;
+            if(threads[i].ns > thread_ns_max)
+                thread_ns_max = threads[i].ns;
+            if(threads[i].failed || !threads[i].synced || threads[i].golay_errs)
+                threads_ok = false;
+        }
+    }
+
+    /* Report */
+    time_t now = time(NULL);
+    char date[32];
+    strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", gmtime(&now));
+    printf("{\n");
+    printf("  \"date\": \"%s\",\n", date);
+    printf("  \"mode\": {\"name\": \"4800T\", \"samp_rate\": %u, \"sym_rate\": %u, \"fsk_m\": %u, \"slot_size\": %u, \"n_slots\": %u},\n",
+        mode.samp_rate, mode.sym_rate, mode.fsk_m, mode.slot_size, mode.n_slots);
+    printf("  \"min_secs\": %g,\n", min_secs);
+    printf("  \"fft_backend\": \"%s\",\n", modem_fft_get_backend() == MODEM_FFT_FFTW ? "fftw" : "kiss");
+    printf("  \"tdma_rx_synced_ok\": %s,\n", synced ? "true" : "false");
+    printf("  \"tdma_footprint_bytes\": %zu,\n", footprint);
+    printf("  \"results\": [\n");
+    for(i = 0; i < n_results; i++){
+        struct BENCH_RESULT * r = &results[i];
+        printf("    {\"name\": \"%s\", \"ns_per_call\": %.1f, \"ns_per_call_min\": %.1f", r->name, r->ns_per_call, r->ns_per_call_min);
+        if(r->samps_per_call > 0){
+            double sps = r->samps_per_call/(r->ns_per_call*1e-9);
+            printf(", \"samps_per_call\": %zu, \"samps_per_sec\": %.4g, \"realtime_factor\": %.2f",
+                r->samps_per_call, sps, sps/mode.samp_rate);
+        }
+        printf("}%s\n", i+1 < n_results ? "," : "");
+    }
+    printf("  ]");
+
+    /* Stage breakdown of the synced tdma_rx run, if the modem was built with TDMA_PERF_ENABLE */
+    if(perf.enabled){
+        static const char * stage_names[TDMA_PERF_N_STAGES] = {
+            "shift", "freq_est", "downmix", "timing_est", "uw_search", "redemod", "rx_cb", "tx_mod", "total"
+        };
+        printf(",\n  \"tdma_rx_stages\": {\"cycles\": %llu, \"budget_ns\": %llu, \"near_budget\": %llu, \"over_budget\": %llu, \"stages\": [\n",
+            (unsigned long long)perf.cycles, (unsigned long long)perf.budget_ns,
+            (unsigned long long)perf.near_budget, (unsigned long long)perf.over_budget);
+        for(i = 0; i < TDMA_PERF_N_STAGES; i++){
+            struct TDMA_PERF_STAGE_STATS * st = &perf.all[i];
+            printf("    {\"name\": \"%s\", \"count\": %llu, \"min_ns\": %llu, \"mean_ns\": %.1f, \"p99_ns\": %llu, \"max_ns\": %llu}%s\n",
+                stage_names[i], (unsigned long long)st->count, (unsigned long long)st->min_ns, st->mean_ns,
+                (unsigned long long)st->p99_ns, (unsigned long long)st->max_ns, i+1 < TDMA_PERF_N_STAGES ? "," : "");
+        }
+        printf("  ]}");
+    }
+
+    /* Each thread ran its own modem; the slowest one sets the aggregate rate */
+    if(n_threads > 0){
+        double sps = thread_slots*c.slot_samps/(thread_ns_max*1e-9);
+        printf(",\n  \"threads\": {\"n\": %d, \"ok\": %s, \"slots\": %zu, \"samps_per_sec\": %.4g, \"realtime_factor\": %.2f, \"modems\": [\n",
+            n_threads, threads_ok ? "true" : "false", thread_slots, sps, sps/mode.samp_rate);
+        for(i = 0; i < n_threads; i++){
+            struct BENCH_THREAD * bt = &threads[i];
+            printf("    {\"ns_per_slot\": %.1f, \"synced\": %s, \"golay_errs\": %d, \"failed\": %s}%s\n",
+                bt->slots > 0 ? bt->ns/bt->slots : 0., bt->synced ? "true" : "false", bt->golay_errs,
+                bt->failed ? "true" : "false", i+1 < n_threads ? "," : "");
+        }
+        printf("  ]}");
+        free(threads);
+    }
+    printf("\n}\n");
+
+    if(wisdom != NULL && modem_fft_save_wisdom(wisdom))
+        fprintf(stderr,"Couldn't save FFTW wisdom to %s\n",wisdom);
+    modem_fft_cleanup();
+
+    free(c.sig);
+    free(c.noise);
+    free(c.bits);
+    free(c.sd);
+    free(c.spec);
+    free(c.golay_in);
+    free(c.golay_out);
+    free(c.golay_dec);
+    free(c.golay_rel);
+    free(c.stats);
+
+    /* Scripts run this to check that modems can share a process */
+    if(n_threads > 0 && !threads_ok){
+        fprintf(stderr,"Modems running on threads lost sync or decoded wrong\n");
+        return EXIT_FAILURE;
+    }
+    return 0;
+}
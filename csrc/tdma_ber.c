@@ -0,0 +1,501 @@
+/*---------------------------------------------------------------------------*\
+
+  FILE........: tdma_ber.c
+  AUTHOR......: Brady O'Brien
+  DATE CREATED: 19 October 2026
+
+  Monte-Carlo BER/FER and sync benchmark for the TDMA modem. Builds
+  superframes from a set of simulated slot transmitters, like TdmaXmtr in
+  julia/tdma_channel_sim.jl, runs them through tdma_rx(), and matches the
+  frames it gets back against the ones that were sent. Runs across several
+  threads, each with its own modem, transmitters, and noise.
+
+\*---------------------------------------------------------------------------*/
+
+/*
+  Copyright (C) 2026 Brady O'Brien
+
+  All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License version 2.1, as
+  published by the Free Software Foundation.  This program is
+  distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <math.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <time.h>
+#include <tdma.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846264338327950288
+#endif
+
+/* Most slots a simulation can have */
+#define BER_MAX_SLOTS 16
+
+/* Sent frames waiting to be matched, per slot */
+#define BER_FIFO_LEN 8
+
+/* Superframes per job; each job is one thread's share of one Eb/N0 point */
+#define BER_JOB_SUPERFRAMES 250
+
+/* A received frame matches a sent one if it's at least this close */
+#define BER_MATCH_FRAC .25
+
+/* Fixed point demod input scale. Unit variance noise plus signal stays well inside +-8 */
+#define BER_FIXED_SCALE 4096
+
+/* A simulated slot transmitter */
+struct BER_XMTR {
+    fsk_t * fsk;
+    int timing_offset;              /* Timing offset in samples */
+    float freq_offset;              /* Frequency offset, Hz */
+    float ebno_delta;               /* Eb/N0 relative to the point being run, dB */
+    bool master;                    /* Set the master bit in frames */
+    bool enable;                    /* Whether this slot is transmitted at all */
+    COMP phase;                     /* Carrier offset oscillator */
+};
+
+/* A frame that's been sent and not yet matched */
+struct BER_SENT {
+    u8 * bits;
+    bool valid;
+};
+
+/* Counts for one Eb/N0 point */
+struct BER_RESULT {
+    u64 frames_sent;                /* Frames sent and since accounted for */
+    u64 frames_ok;                  /* Frames received with no bit errors */
+    u64 frames_missed;              /* Frames never delivered */
+    u64 frames_false;               /* Deliveries that didn't match anything sent */
+    u64 bits;                       /* Payload bits in delivered frames */
+    u64 bit_errs;                   /* Payload bit errors in delivered frames */
+    u64 slot_periods;               /* Enabled slot periods observed */
+    u64 slot_periods_sync;          /* ... where the receiving slot was in sync */
+    u64 desyncs;                    /* Times a slot went from sync to no sync */
+    u64 first_sync_sum;             /* Sum over jobs of slot periods until first sync */
+    u64 first_sync_jobs;            /* Jobs that got sync at all */
+    u64 jobs;
+};
+
+/* Everything a worker needs for one job */
+struct BER_JOB_CTX {
+    tdma_t * tdma;
+    struct BER_XMTR xmtrs[BER_MAX_SLOTS];
+    struct BER_SENT fifo[BER_MAX_SLOTS][BER_FIFO_LEN];
+    int fifo_head[BER_MAX_SLOTS];
+    struct BER_RESULT * res;
+    size_t frame_bits;
+    size_t uw_offset;
+    size_t uw_len;
+    u64 rng;
+};
+
+/* Shared between workers */
+struct BER_SIM {
+    struct TDMA_MODE_SETTINGS mode;
+    struct BER_XMTR xmtr_cfg[BER_MAX_SLOTS];
+    float * ebnos;
+    int n_points;
+    int jobs_per_point;
+    atomic_int next_job;
+    struct BER_RESULT * results;    /* One per job */
+    u64 seed;
+    bool randomize;                 /* Re-roll timing/freq offsets for every job */
+    bool fixed_point;               /* Run the receiver's demods in fixed point */
+};
+
+static u64 ber_rand(u64 * s){
+    *s ^= *s >> 12;
+    *s ^= *s << 25;
+    *s ^= *s >> 27;
+    return *s * 2685821657736338717ULL;
+}
+
+static double ber_uniform(u64 * s){
+    return ((ber_rand(s) >> 11) + 1) * (1.0/9007199254740993.0);
+}
+
+static double ber_gauss(u64 * s){
+    return sqrt(-2.*log(ber_uniform(s)))*cos(2.*M_PI*ber_uniform(s));
+}
+
+/* Called by the modem with each frame it gets. Find which frame it was */
+static void ber_rx_frame(u8* frame_bits,u32 slot_i, slot_t * slot, tdma_t * tdma,u8 uw_type, void * cb_data){
+    struct BER_JOB_CTX * ctx = (struct BER_JOB_CTX*) cb_data;
+    int n_slots = tdma->settings.n_slots;
+    int best_s = -1, best_k = -1;
+    size_t best_errs = ctx->frame_bits;
+    size_t i;
+    int s, k;
+
+    /* The modem's slot numbering needn't line up with ours, so look at every slot */
+    for(s = 0; s < n_slots; s++){
+        for(k = 0; k < BER_FIFO_LEN; k++){
+            struct BER_SENT * f = &ctx->fifo[s][k];
+            size_t errs = 0;
+            if(!f->valid) continue;
+            for(i = 0; i < ctx->frame_bits; i++){
+                if(i >= ctx->uw_offset && i < ctx->uw_offset+ctx->uw_len) continue;
+                errs += (frame_bits[i] != 0) != (f->bits[i] != 0);
+            }
+            if(errs < best_errs){
+                best_errs = errs;
+                best_s = s;
+                best_k = k;
+            }
+        }
+    }
+
+    size_t payload_bits = ctx->frame_bits - ctx->uw_len;
+    if(best_s < 0 || best_errs > payload_bits*BER_MATCH_FRAC){
+        ctx->res->frames_false++;
+        return;
+    }
+
+    /* Anything sent on this slot before the matched frame was missed */
+    for(k = 0; k < BER_FIFO_LEN; k++){
+        int idx = (ctx->fifo_head[best_s] + k) % BER_FIFO_LEN;
+        struct BER_SENT * f = &ctx->fifo[best_s][idx];
+        if(!f->valid) continue;
+        f->valid = false;
+        ctx->res->frames_sent++;
+        if(idx == best_k) break;
+        ctx->res->frames_missed++;
+    }
+
+    ctx->res->bits += payload_bits;
+    ctx->res->bit_errs += best_errs;
+    if(best_errs == 0)
+        ctx->res->frames_ok++;
+}
+
+/* Record a sent frame. If the FIFO is full, the oldest frame was never received */
+static u8 * ber_fifo_push(struct BER_JOB_CTX * ctx, int s){
+    int idx = ctx->fifo_head[s];
+    struct BER_SENT * f = &ctx->fifo[s][idx];
+    if(f->valid){
+        ctx->res->frames_sent++;
+        ctx->res->frames_missed++;
+    }
+    f->valid = true;
+    ctx->fifo_head[s] = (idx+1) % BER_FIFO_LEN;
+    return f->bits;
+}
+
+/* Modulate one slot from a transmitter into slot_buf, which is already zeroed */
+static void ber_modulate_slot(struct BER_JOB_CTX * ctx, struct TDMA_MODE_SETTINGS * mode, int s, COMP * slot_buf, float ebno_db){
+    struct BER_XMTR * x = &ctx->xmtrs[s];
+    u32 Ts = mode->samp_rate/mode->sym_rate;
+    size_t n_frame = mode->frame_size*Ts;
+    size_t pad = ((mode->slot_size - mode->frame_size)/2)*Ts;
+    size_t bps = (mode->fsk_m == 2) ? 1 : 2;
+    size_t i;
+
+    if(!x->enable) return;
+
+    u8 * bits = ber_fifo_push(ctx, s);
+    for(i = 0; i < ctx->frame_bits; i++)
+        bits[i] = ber_rand(&ctx->rng) >> 63;
+    memcpy(&bits[ctx->uw_offset], ctx->tdma->uw_list[0], ctx->uw_len);
+    bits[ctx->tdma->master_bit_pos] = x->master ? 1 : 0;
+
+    COMP frame[n_frame];
+    fsk_mod_c(x->fsk, frame, bits);
+
+    /* fsk_mod_c has amplitude 2. Scale so that Eb/N0 is right against unit variance noise */
+    float ebno = powf(10., (ebno_db + x->ebno_delta)/10.);
+    float amp = sqrtf(ebno*mode->sym_rate*bps/mode->samp_rate)/2.;
+    COMP dph = comp_exp_j(2.*M_PI*x->freq_offset/mode->samp_rate);
+    COMP ph = x->phase;
+    size_t start = pad + x->timing_offset;
+    for(i = 0; i < n_frame; i++){
+        COMP v = cmult(frame[i], ph);
+        slot_buf[start+i].real = v.real*amp;
+        slot_buf[start+i].imag = v.imag*amp;
+        ph = cmult(ph, dph);
+    }
+    x->phase = comp_normalize(ph);
+}
+
+/* Run one job: a fresh receiver and transmitters through BER_JOB_SUPERFRAMES superframes */
+static void ber_run_job(struct BER_SIM * sim, int job, struct BER_RESULT * res){
+    struct TDMA_MODE_SETTINGS mode = sim->mode;
+    float ebno_db = sim->ebnos[job / sim->jobs_per_point];
+    u32 Ts = mode.samp_rate/mode.sym_rate;
+    size_t slot_samps = mode.slot_size*Ts;
+    size_t bps = (mode.fsk_m == 2) ? 1 : 2;
+    size_t pad = ((mode.slot_size - mode.frame_size)/2)*Ts;
+    struct BER_JOB_CTX ctx;
+    int n_slots = mode.n_slots;
+    int s, k;
+    u64 sf;
+
+    memset(&ctx, 0, sizeof(ctx));
+    memset(res, 0, sizeof(*res));
+    ctx.res = res;
+    ctx.rng = sim->seed + 0x9E3779B97F4A7C15ULL*(job+1);
+    ctx.frame_bits = mode.frame_size*bps;
+    ctx.uw_len = mode.uw_len;
+    ctx.uw_offset = (ctx.frame_bits - ctx.uw_len)/2;
+
+    ctx.tdma = tdma_create(mode);
+    if(ctx.tdma != NULL && sim->fixed_point)
+        tdma_set_fixed_point(ctx.tdma, 1, BER_FIXED_SCALE);
+    for(s = 0; s < n_slots && ctx.tdma != NULL; s++){
+        ctx.xmtrs[s] = sim->xmtr_cfg[s];
+        ctx.xmtrs[s].fsk = fsk_create_hbr(mode.samp_rate,mode.sym_rate,Ts,mode.fsk_m,mode.sym_rate,mode.sym_rate);
+        if(ctx.xmtrs[s].fsk != NULL && fsk_set_nsym(ctx.xmtrs[s].fsk, mode.frame_size)){
+            fsk_destroy(ctx.xmtrs[s].fsk);
+            ctx.xmtrs[s].fsk = NULL;
+        }
+    }
+
+    u8 * fifo_bits = (u8*) malloc(n_slots*BER_FIFO_LEN*ctx.frame_bits);
+    COMP * slot_buf = (COMP*) malloc(sizeof(COMP)*slot_samps);
+    if(ctx.tdma == NULL || fifo_bits == NULL || slot_buf == NULL)
+        goto ber_run_job_cleanup;
+    for(s = 0; s < n_slots; s++){
+        if(ctx.xmtrs[s].fsk == NULL) goto ber_run_job_cleanup;
+        for(k = 0; k < BER_FIFO_LEN; k++)
+            ctx.fifo[s][k].bits = &fifo_bits[(s*BER_FIFO_LEN + k)*ctx.frame_bits];
+    }
+
+    for(s = 0; s < n_slots; s++){
+        struct BER_XMTR * x = &ctx.xmtrs[s];
+        x->phase.real = 1.;
+        x->phase.imag = 0.;
+        /* Random mode rolls offsets within the configured magnitudes */
+        if(sim->randomize){
+            x->timing_offset = (int)lround((2.*ber_uniform(&ctx.rng)-1.)*x->timing_offset);
+            x->freq_offset = (2.*ber_uniform(&ctx.rng)-1.)*x->freq_offset;
+        }
+        if(abs(x->timing_offset) >= (int)pad)
+            x->timing_offset = x->timing_offset > 0 ? (int)(pad-1) : -(int)(pad-1);
+    }
+
+    tdma_set_rx_cb(ctx.tdma, ber_rx_frame, (void*)&ctx);
+
+    enum slot_state last_state[BER_MAX_SLOTS];
+    for(s = 0; s < n_slots; s++)
+        last_state[s] = rx_no_sync;
+    bool got_sync = false;
+    u64 periods = 0;
+    u64 timestamp = 0;
+
+    for(sf = 0; sf < BER_JOB_SUPERFRAMES; sf++){
+        for(s = 0; s < n_slots; s++){
+            size_t i;
+            for(i = 0; i < slot_samps; i++){
+                slot_buf[i].real = 0;
+                slot_buf[i].imag = 0;
+            }
+            ber_modulate_slot(&ctx, &mode, s, slot_buf, ebno_db);
+            /* Unit variance complex noise */
+            for(i = 0; i < slot_samps; i++){
+                slot_buf[i].real += ber_gauss(&ctx.rng)*M_SQRT1_2;
+                slot_buf[i].imag += ber_gauss(&ctx.rng)*M_SQRT1_2;
+            }
+
+            tdma_rx(ctx.tdma, slot_buf, timestamp);
+            timestamp += slot_samps;
+            periods++;
+
+            /* Sync bookkeeping, over the modem's own slots */
+            int r;
+            bool any_sync = false;
+            for(r = 0; r < n_slots; r++){
+                enum slot_state st = tdma_get_slot(ctx.tdma, r)->state;
+                if(last_state[r] == rx_sync && st == rx_no_sync)
+                    res->desyncs++;
+                last_state[r] = st;
+                any_sync = any_sync || (st == rx_sync);
+            }
+            if(ctx.xmtrs[s].enable){
+                res->slot_periods++;
+                if(any_sync) res->slot_periods_sync++;
+            }
+            if(any_sync && !got_sync){
+                got_sync = true;
+                res->first_sync_sum += periods;
+                res->first_sync_jobs++;
+            }
+        }
+    }
+
+    /* Push a superframe of noise through so frames still in the demod come out */
+    for(s = 0; s < n_slots; s++){
+        size_t i;
+        for(i = 0; i < slot_samps; i++){
+            slot_buf[i].real = ber_gauss(&ctx.rng)*M_SQRT1_2;
+            slot_buf[i].imag = ber_gauss(&ctx.rng)*M_SQRT1_2;
+        }
+        tdma_rx(ctx.tdma, slot_buf, timestamp);
+        timestamp += slot_samps;
+    }
+    /* Whatever is still waiting was never received */
+    for(s = 0; s < n_slots; s++){
+        for(k = 0; k < BER_FIFO_LEN; k++){
+            if(!ctx.fifo[s][k].valid) continue;
+            ctx.fifo[s][k].valid = false;
+            res->frames_sent++;
+            res->frames_missed++;
+        }
+    }
+    res->jobs = 1;
+
+    ber_run_job_cleanup:
+    for(s = 0; s < n_slots; s++)
+        if(ctx.xmtrs[s].fsk != NULL) fsk_destroy(ctx.xmtrs[s].fsk);
+    if(ctx.tdma != NULL) tdma_destroy(ctx.tdma);
+    free(fifo_bits);
+    free(slot_buf);
+}
+
+static void * ber_worker(void * arg){
+    struct BER_SIM * sim = (struct BER_SIM*) arg;
+    int n_jobs = sim->n_points*sim->jobs_per_point;
+    int job;
+    while((job = atomic_fetch_add(&sim->next_job, 1)) < n_jobs)
+        ber_run_job(sim, job, &sim->results[job]);
+    return NULL;
+}
+
+static void usage(const char * name){
+    fprintf(stderr,"usage: %s [-e start:stop:step] [-n superframes] [-j threads] [-s seed] [-x slot:timing:freq:ebno_delta:enable] [-r] [-f]\n",name);
+    fprintf(stderr,"  -e  Eb/N0 sweep in dB (default 4:14:1)\n");
+    fprintf(stderr,"  -n  superframes per Eb/N0 point (default 2000)\n");
+    fprintf(stderr,"  -j  worker threads (default: number of CPUs)\n");
+    fprintf(stderr,"  -x  set up one slot transmitter; may be repeated\n");
+    fprintf(stderr,"  -r  randomize timing within +-timing and frequency within +-freq for every job\n");
+    fprintf(stderr,"  -f  run the receiver's demods in fixed point\n");
+}
+
+int main(int argc,char ** argv){
+    struct BER_SIM sim;
+    struct TDMA_MODE_SETTINGS mode = FREEDV_4800T;
+    float e_start = 4, e_stop = 14, e_step = 1;
+    long n_superframes = 2000;
+    long n_threads = sysconf(_SC_NPROCESSORS_ONLN);
+    int opt, i, s;
+
+    memset(&sim, 0, sizeof(sim));
+    sim.mode = mode;
+    sim.seed = 1;
+    for(s = 0; s < BER_MAX_SLOTS; s++){
+        sim.xmtr_cfg[s].enable = true;
+        sim.xmtr_cfg[s].master = (s == 0);
+    }
+
+    while((opt = getopt(argc, argv, "e:n:j:s:x:rfh")) != -1){
+        switch(opt){
+            case 'e':
+                if(sscanf(optarg, "%f:%f:%f", &e_start, &e_stop, &e_step) < 2){
+                    usage(argv[0]);
+                    return EXIT_FAILURE;
+                }
+                break;
+            case 'n': n_superframes = atol(optarg); break;
+            case 'j': n_threads = atol(optarg); break;
+            case 's': sim.seed = strtoull(optarg, NULL, 0); break;
+            case 'x': {
+                int slot, timing, enable = 1;
+                float freq, delta;
+                if(sscanf(optarg, "%d:%d:%f:%f:%d", &slot, &timing, &freq, &delta, &enable) < 4
+                    || slot < 0 || slot >= (int)mode.n_slots){
+                    usage(argv[0]);
+                    return EXIT_FAILURE;
+                }
+                sim.xmtr_cfg[slot].timing_offset = timing;
+                sim.xmtr_cfg[slot].freq_offset = freq;
+                sim.xmtr_cfg[slot].ebno_delta = delta;
+                sim.xmtr_cfg[slot].enable = enable != 0;
+                break;
+            }
+            case 'r': sim.randomize = true; break;
+            case 'f': sim.fixed_point = true; break;
+            default:
+                usage(argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+    if(n_threads < 1) n_threads = 1;
+    if(e_step <= 0) e_step = 1;
+    if(mode.n_slots > BER_MAX_SLOTS){
+        fprintf(stderr,"Too many slots\n");
+        return EXIT_FAILURE;
+    }
+
+    sim.n_points = (int)floorf((e_stop - e_start)/e_step + 1.001);
+    if(sim.n_points < 1) sim.n_points = 1;
+    sim.ebnos = (float*) malloc(sizeof(float)*sim.n_points);
+    for(i = 0; i < sim.n_points; i++)
+        sim.ebnos[i] = e_start + i*e_step;
+    sim.jobs_per_point = (n_superframes + BER_JOB_SUPERFRAMES-1)/BER_JOB_SUPERFRAMES;
+    sim.results = (struct BER_RESULT*) calloc(sim.n_points*sim.jobs_per_point, sizeof(struct BER_RESULT));
+    atomic_init(&sim.next_job, 0);
+
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+
+    pthread_t threads[n_threads];
+    for(i = 0; i < n_threads; i++)
+        pthread_create(&threads[i], NULL, ber_worker, (void*)&sim);
+    for(i = 0; i < n_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+
+    printf("# %ld superframes/point, %d slots, %ld threads, %s demod, %.2fs\n",
+        (long)sim.jobs_per_point*BER_JOB_SUPERFRAMES, mode.n_slots, n_threads,
+        sim.fixed_point ? "fixed point" : "float",
+        (t1.tv_sec-t0.tv_sec) + (t1.tv_nsec-t0.tv_nsec)*1e-9);
+    printf("# EbN0     BER        FER        sent     missed   false    sync    first_sync desyncs\n");
+    for(i = 0; i < sim.n_points; i++){
+        struct BER_RESULT t;
+        int j;
+        memset(&t, 0, sizeof(t));
+        for(j = 0; j < sim.jobs_per_point; j++){
+            struct BER_RESULT * r = &sim.results[i*sim.jobs_per_point + j];
+            t.frames_sent += r->frames_sent;
+            t.frames_ok += r->frames_ok;
+            t.frames_missed += r->frames_missed;
+            t.frames_false += r->frames_false;
+            t.bits += r->bits;
+            t.bit_errs += r->bit_errs;
+            t.slot_periods += r->slot_periods;
+            t.slot_periods_sync += r->slot_periods_sync;
+            t.desyncs += r->desyncs;
+            t.first_sync_sum += r->first_sync_sum;
+            t.first_sync_jobs += r->first_sync_jobs;
+            t.jobs += r->jobs;
+        }
+        printf("%6.2f  %.3e  %.3e  %7llu  %7llu  %7llu  %.4f  %8.1f  %7llu\n",
+            sim.ebnos[i],
+            t.bits ? (double)t.bit_errs/t.bits : 0.,
+            t.frames_sent ? 1. - (double)t.frames_ok/t.frames_sent : 0.,
+            (unsigned long long)t.frames_sent, (unsigned long long)t.frames_missed,
+            (unsigned long long)t.frames_false,
+            t.slot_periods ? (double)t.slot_periods_sync/t.slot_periods : 0.,
+            t.first_sync_jobs ? (double)t.first_sync_sum/t.first_sync_jobs : -1.,
+            (unsigned long long)t.desyncs);
+    }
+
+    free(sim.ebnos);
+    free(sim.results);
+    return 0;
+}
@@ -0,0 +1,393 @@
+/*---------------------------------------------------------------------------*\
+
+  FILE........: tdma_decode.c
+  AUTHOR......: Brady O'Brien
+  DATE CREATED: 19 October 2026
+
+  Decodes a recorded IQ capture, CF32 or CS16 at any sample rate, and prints
+  every received frame as CSV. The file is memory mapped and cut into chunks
+  that are decoded in parallel, each by its own modem. A chunk's modem starts
+  a little before the chunk, so it has sync by the time its own samples
+  begin, and runs on a little past the end, to finish frames that straddle
+  it. When the chunks are put back together, frames seen by both neighbours
+  are only printed once, and slot numbers are carried across so they stay
+  consistent through the whole capture.
+
+\*---------------------------------------------------------------------------*/
+
+/*
+  Copyright (C) 2026 Brady O'Brien
+
+  All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License version 2.1, as
+  published by the Free Software Foundation.  This program is
+  distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <math.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <complex.h>
+#include <liquid/liquid.h>
+#include <tdma.h>
+
+/* Input samples converted and resampled at a time */
+#define DECODE_BLOCK 8192
+
+/* Frames the modem may hold in its ring between drains; it's drained every slot */
+#define DECODE_RING_FRAMES 16
+
+enum decode_format {
+    format_cf32 = 0,                /* Interleaved float I and Q */
+    format_cs16 = 1,                /* Interleaved int16 I and Q, full scale 32768 */
+};
+
+/* The whole job, shared read only by the workers */
+struct DECODE_JOB {
+    struct TDMA_MODE_SETTINGS mode;
+    const void * in;                /* Mapped capture */
+    enum decode_format format;
+    size_t n_in;                    /* Samples in the capture */
+    double in_rate;
+    double r;                       /* Modem rate over input rate */
+    size_t chunk_len;               /* Input samples per chunk */
+    size_t warmup_len;              /* Input samples decoded before each chunk */
+    size_t tail_len;                /* Input samples decoded after each chunk */
+    size_t frame_stride;            /* Bytes per stored struct TDMA_FRAME */
+    size_t n_chunks;
+    struct DECODE_CHUNK * chunks;
+    atomic_size_t next_chunk;
+};
+
+/* One chunk's frames, with timestamps in modem samples from the start of the capture */
+struct DECODE_CHUNK {
+    u8 * frames;                    /* n_frames struct TDMA_FRAMEs, frame_stride apart */
+    size_t n_frames;
+    size_t cap;
+    u64 dropped;
+    int failed;
+};
+
+static struct TDMA_FRAME * decode_frame_at(const struct DECODE_JOB * job, struct DECODE_CHUNK * ch, size_t i){
+    return (struct TDMA_FRAME*) &ch->frames[i*job->frame_stride];
+}
+
+static int decode_keep_frame(const struct DECODE_JOB * job, struct DECODE_CHUNK * ch, const struct TDMA_FRAME * frame, i64 timestamp){
+    if(ch->n_frames == ch->cap){
+        size_t cap = ch->cap ? ch->cap*2 : 256;
+        u8 * p = (u8*) realloc(ch->frames, cap*job->frame_stride);
+        if(p == NULL)
+            return -1;
+        ch->frames = p;
+        ch->cap = cap;
+    }
+    struct TDMA_FRAME * kept = decode_frame_at(job, ch, ch->n_frames++);
+    memcpy(kept, frame, job->frame_stride);
+    kept->timestamp = timestamp;
+    return 0;
+}
+
+/* Convert n input samples from pos on to float complex */
+static void decode_convert(const struct DECODE_JOB * job, size_t pos, size_t n, float complex * out){
+    size_t i;
+    if(job->format == format_cf32){
+        memcpy(out, &((const float complex*)job->in)[pos], n*sizeof(float complex));
+        return;
+    }
+    const int16_t * in = &((const int16_t*)job->in)[2*pos];
+    for(i = 0; i < n; i++)
+        out[i] = (in[2*i] + I*in[2*i+1])*(1.f/32768.f);
+}
+
+/* Decode chunk c. Frames starting within half a slot of the chunk are kept; the merge sorts out the overlap */
+static void decode_chunk(struct DECODE_JOB * job, size_t c){
+    struct DECODE_CHUNK * ch = &job->chunks[c];
+    struct TDMA_MODE_SETTINGS mode = job->mode;
+    size_t slot_samps = mode.slot_size*(mode.samp_rate/mode.sym_rate);
+    size_t start = c*job->chunk_len;
+    size_t end = start + job->chunk_len < job->n_in ? start + job->chunk_len : job->n_in;
+    size_t pos = start > job->warmup_len ? start - job->warmup_len : 0;
+    size_t stop = end + job->tail_len < job->n_in ? end + job->tail_len : job->n_in;
+    i64 own_lo = llround(start*job->r) - (i64)slot_samps/2;
+    i64 own_hi = llround(end*job->r) + (i64)slot_samps/2;
+    size_t buf_cap = slot_samps + (size_t)ceil(DECODE_BLOCK*job->r) + 64;
+    size_t buf_n = 0;
+    float complex * in_buf = NULL;
+    float complex * buf = NULL;
+    msresamp_crcf resamp = NULL;
+    tdma_t * tdma = NULL;
+    i64 delay = 0;
+    bool ok = false;
+
+    in_buf = (float complex*) malloc(sizeof(float complex)*DECODE_BLOCK);
+    buf = (float complex*) malloc(sizeof(float complex)*buf_cap);
+    tdma = tdma_create(mode);
+    if(in_buf == NULL || buf == NULL || tdma == NULL)
+        goto cleanup;
+    if(tdma_enable_frame_ring(tdma, DECODE_RING_FRAMES))
+        goto cleanup;
+    if(job->r != 1.){
+        resamp = msresamp_crcf_create((float)job->r, 60.f);
+        if(resamp == NULL)
+            goto cleanup;
+        delay = llround(msresamp_crcf_get_delay(resamp));
+    }
+
+    /* Modem timestamps count from the first sample this chunk decodes */
+    i64 ts0 = llround(pos*job->r) - delay;
+    u64 ts = 0;
+
+    while(pos < stop){
+        size_t n = stop - pos < DECODE_BLOCK ? stop - pos : DECODE_BLOCK;
+        decode_convert(job, pos, n, in_buf);
+        pos += n;
+        if(resamp != NULL){
+            unsigned int n_out;
+            msresamp_crcf_execute(resamp, in_buf, n, &buf[buf_n], &n_out);
+            buf_n += n_out;
+        }else{
+            memcpy(&buf[buf_n], in_buf, n*sizeof(float complex));
+            buf_n += n;
+        }
+
+        size_t nin;
+        size_t used = 0;
+        while(buf_n - used >= (nin = tdma_nin(tdma))){
+            const struct TDMA_FRAME * frame;
+            tdma_rx(tdma, (COMP*)&buf[used], ts);
+            ts += nin;
+            used += nin;
+            while((frame = tdma_frame_acquire(tdma)) != NULL){
+                i64 t = ts0 + frame->timestamp;
+                if(t >= own_lo && t < own_hi && decode_keep_frame(job, ch, frame, t))
+                    ch->failed = 1;
+                tdma_frame_release(tdma);
+            }
+        }
+        memmove(buf, &buf[used], (buf_n - used)*sizeof(float complex));
+        buf_n -= used;
+    }
+    ch->dropped = tdma_frames_dropped(tdma);
+    ok = true;
+
+    cleanup:
+    if(!ok)
+        ch->failed = 1;
+    if(resamp != NULL) msresamp_crcf_destroy(resamp);
+    if(tdma != NULL) tdma_destroy(tdma);
+    free(in_buf);
+    free(buf);
+}
+
+static void * decode_worker(void * arg){
+    struct DECODE_JOB * job = (struct DECODE_JOB*) arg;
+    size_t c;
+    while((c = atomic_fetch_add(&job->next_chunk, 1)) < job->n_chunks)
+        decode_chunk(job, c);
+    return NULL;
+}
+
+static double decode_now(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec*1e-9;
+}
+
+static void usage(const char * name){
+    fprintf(stderr,"usage: %s [-f cf32|cs16] [-r samp_rate] [-j threads] [-c chunk_secs] [-w warmup_secs] capture\n",name);
+    fprintf(stderr,"  -f  sample format (default cf32)\n");
+    fprintf(stderr,"  -r  capture sample rate; resampled to the modem's if it differs (default the modem's)\n");
+    fprintf(stderr,"  -j  decoding threads (default one per CPU)\n");
+    fprintf(stderr,"  -c  seconds of capture per chunk (default 60)\n");
+    fprintf(stderr,"  -w  seconds decoded before each chunk to get sync (default 2)\n");
+    fprintf(stderr,"Frames are printed to stdout as CSV; time is in seconds from the start of the capture\n");
+}
+
+int main(int argc,char ** argv){
+    struct DECODE_JOB job;
+    struct TDMA_MODE_SETTINGS mode = FREEDV_4800T;
+    enum decode_format format = format_cf32;
+    double in_rate = mode.samp_rate;
+    long n_threads = sysconf(_SC_NPROCESSORS_ONLN);
+    double chunk_secs = 60;
+    double warmup_secs = 2;
+    pthread_t * threads = NULL;
+    void * map = MAP_FAILED;
+    size_t map_len = 0;
+    int fd = -1;
+    int ret = EXIT_FAILURE;
+    int opt;
+    size_t i, c;
+
+    memset(&job, 0, sizeof(job));
+
+    while((opt = getopt(argc, argv, "f:r:j:c:w:h")) != -1){
+        switch(opt){
+            case 'f':
+                if(strcmp(optarg, "cf32") == 0){
+                    format = format_cf32;
+                }else if(strcmp(optarg, "cs16") == 0){
+                    format = format_cs16;
+                }else{
+                    usage(argv[0]);
+                    return EXIT_FAILURE;
+                }
+                break;
+            case 'r': in_rate = atof(optarg); break;
+            case 'j': n_threads = atol(optarg); break;
+            case 'c': chunk_secs = atof(optarg); break;
+            case 'w': warmup_secs = atof(optarg); break;
+            default:
+                usage(argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+    if(optind != argc-1 || in_rate <= 0 || chunk_secs <= 0 || warmup_secs < 0){
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    if(n_threads < 1)
+        n_threads = 1;
+
+    fd = open(argv[optind], O_RDONLY);
+    struct stat st;
+    if(fd < 0 || fstat(fd, &st)){
+        fprintf(stderr,"Couldn't open %s\n",argv[optind]);
+        goto cleanup;
+    }
+    map_len = st.st_size;
+    if(map_len == 0){
+        fprintf(stderr,"%s is empty\n",argv[optind]);
+        goto cleanup;
+    }
+    map = mmap(NULL, map_len, PROT_READ, MAP_PRIVATE, fd, 0);
+    if(map == MAP_FAILED){
+        fprintf(stderr,"Couldn't map %s\n",argv[optind]);
+        goto cleanup;
+    }
+    madvise(map, map_len, MADV_SEQUENTIAL);
+
+    u32 Ts = mode.samp_rate/mode.sym_rate;
+    size_t slot_samps = mode.slot_size*Ts;
+    size_t bps = (mode.fsk_m == 2) ? 1 : 2;
+
+    job.mode = mode;
+    job.in = map;
+    job.format = format;
+    job.n_in = map_len/(format == format_cf32 ? 2*sizeof(float) : 2*sizeof(int16_t));
+    job.in_rate = in_rate;
+    job.r = mode.samp_rate/in_rate;
+    job.chunk_len = (size_t)(chunk_secs*in_rate);
+    if(job.chunk_len < 1)
+        job.chunk_len = 1;
+    job.warmup_len = (size_t)(warmup_secs*in_rate);
+    /* Enough to finish the last frame that starts in the chunk, plus the resampler's delay */
+    job.tail_len = (size_t)ceil((2*mode.n_slots*slot_samps + 1024)/job.r);
+    job.frame_stride = (sizeof(struct TDMA_FRAME) + (mode.frame_size*bps+7)/8 + 7) & ~(size_t)7;
+    job.n_chunks = (job.n_in + job.chunk_len - 1)/job.chunk_len;
+    job.chunks = (struct DECODE_CHUNK*) calloc(job.n_chunks, sizeof(struct DECODE_CHUNK));
+    atomic_init(&job.next_chunk, 0);
+    if((size_t)n_threads > job.n_chunks)
+        n_threads = job.n_chunks;
+    threads = (pthread_t*) calloc(n_threads, sizeof(pthread_t));
+    if(job.chunks == NULL || threads == NULL){
+        fprintf(stderr,"Couldn't allocate decoder state\n");
+        goto cleanup;
+    }
+
+    double t0 = decode_now();
+    long n_started;
+    for(n_started = 0; n_started < n_threads; n_started++){
+        if(pthread_create(&threads[n_started], NULL, decode_worker, &job)){
+            fprintf(stderr,"Couldn't start decoding thread\n");
+            break;
+        }
+    }
+    /* Whatever threads did start will get through every chunk */
+    if(n_started == 0)
+        decode_worker(&job);
+    for(i = 0; i < (size_t)n_started; i++)
+        pthread_join(threads[i], NULL);
+    double wall = decode_now() - t0;
+
+    /* Stitch the chunks together. A frame within half a slot of the last one printed is
+       the same frame seen by both chunks. Each chunk's modem numbers its slots from
+       wherever it got sync, so they're shifted to follow on from the previous chunk */
+    printf("time,sample,slot,type,uw,uw_errs,EbNodB,ppm,bits\n");
+    bool have_last = false;
+    i64 last_ts = 0;
+    int last_slot = 0;
+    size_t n_frames = 0;
+    u64 dropped = 0;
+    int failed = 0;
+    for(c = 0; c < job.n_chunks; c++){
+        struct DECODE_CHUNK * ch = &job.chunks[c];
+        bool have_shift = false;
+        int shift = 0;
+        dropped += ch->dropped;
+        failed |= ch->failed;
+        for(i = 0; i < ch->n_frames; i++){
+            struct TDMA_FRAME * f = decode_frame_at(&job, ch, i);
+            size_t k;
+            if(have_last && f->timestamp < last_ts + (i64)slot_samps/2)
+                continue;
+            if(!have_shift){
+                if(have_last){
+                    i64 slots = llround((double)(f->timestamp - last_ts)/slot_samps);
+                    shift = (int)((last_slot + slots - f->slot_idx) % (i64)mode.n_slots);
+                    if(shift < 0) shift += mode.n_slots;
+                }
+                have_shift = true;
+            }
+            int slot = (f->slot_idx + shift) % mode.n_slots;
+            printf("%.6f,%.0f,%d,%s,%s,%u,%.1f,%.1f,",
+                (double)f->timestamp/mode.samp_rate, f->timestamp/job.r, slot,
+                f->type == frame_master ? "master" : "client", f->uw_type == uw_data ? "data" : "voice",
+                f->uw_errs, f->EbNodB, f->ppm);
+            for(k = 0; k < (size_t)(f->n_bits+7)/8; k++)
+                printf("%02x", f->frame_payload[k]);
+            printf("\n");
+            last_ts = f->timestamp;
+            last_slot = slot;
+            have_last = true;
+            n_frames++;
+        }
+    }
+
+    double secs = job.n_in/in_rate;
+    fprintf(stderr,"Decoded %.1fs of capture in %.2fs on %ld threads, %.1fx real time; %zu chunks, %zu frames, %llu dropped\n",
+        secs, wall, n_started ? n_started : 1, wall > 0 ? secs/wall : 0., job.n_chunks, n_frames, (unsigned long long)dropped);
+    if(failed){
+        fprintf(stderr,"Some chunks couldn't be decoded\n");
+        goto cleanup;
+    }
+    ret = EXIT_SUCCESS;
+
+    cleanup:
+    if(job.chunks != NULL){
+        for(c = 0; c < job.n_chunks; c++)
+            free(job.chunks[c].frames);
+        free(job.chunks);
+    }
+    free(threads);
+    if(map != MAP_FAILED) munmap(map, map_len);
+    if(fd >= 0) close(fd);
+    return ret;
+}
@@ -0,0 +1,426 @@
+/*---------------------------------------------------------------------------*\
+
+  FILE........: tdma_frontend.c
+  AUTHOR......: Brady O'Brien
+  DATE CREATED: 19 October 2026
+
+  Radio front end kernels; frequency shift and integer rate change between
+  the radio sample rate and the TDMA modem rate, for CF32 or CS16 samples.
+
+  CS16 input is converted, mixed, and filtered one L1-sized chunk at a time,
+  so the float version of the radio samples never goes out to memory. The
+  inner loops are kept branch-free so the compiler can vectorize them.
+
+\*---------------------------------------------------------------------------*/
+
+/*
+  Copyright (C) 2026 Brady O'Brien
+
+  All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License version 2.1, as
+  published by the Free Software Foundation.  This program is
+  distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "tdma_frontend.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846264338327950288
+#endif
+
+/* Anti-alias filter; passband to .4 and stopband from .6 of the modem rate, 60dB down */
+#define TDMA_FE_ATTEN_DB 60.
+#define TDMA_FE_TRANSITION .2
+
+/* Zeroth order modified Bessel function, for the Kaiser window */
+static double fe_bessel_i0(double x){
+    double sum = 1., term = 1.;
+    int k;
+    for(k = 1; k < 32; k++){
+        term *= (x/(2.*k))*(x/(2.*k));
+        sum += term;
+    }
+    return sum;
+}
+
+/* Kaiser windowed sinc lowpass for a rate change of R. Gain is R so it works for interpolation too */
+static float * fe_design_lowpass(int R, int * n_taps_out){
+    double A = TDMA_FE_ATTEN_DB;
+    double beta = 0.1102*(A-8.7);
+    double fc = .5/R;
+    int n_taps = (int)ceil((A-8.)/(2.285*2.*M_PI*(TDMA_FE_TRANSITION/R))) | 1;
+    int i;
+
+    float * taps = (float*) malloc(sizeof(float)*n_taps);
+    if(taps == NULL) return NULL;
+
+    double sum = 0;
+    for(i = 0; i < n_taps; i++){
+        double t = i - (n_taps-1)/2.;
+        double r = 2.*i/(n_taps-1) - 1.;
+        double w = fe_bessel_i0(beta*sqrt(1.-r*r))/fe_bessel_i0(beta);
+        double s = (t == 0) ? 2.*fc : sin(2.*M_PI*fc*t)/(M_PI*t);
+        taps[i] = s*w;
+        sum += taps[i];
+    }
+    for(i = 0; i < n_taps; i++)
+        taps[i] *= R/sum;
+
+    *n_taps_out = n_taps;
+    return taps;
+}
+
+static int fe_gcd(long a, long b){
+    while(b != 0){
+        long t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+/* Set up the LO. Uses a table if the shift repeats within TDMA_FE_LO_MAX_TABLE samples */
+static int fe_lo_init(struct TDMA_FE_LO * lo, float shift, float fs){
+    long shift_i = lroundf(shift);
+    long fs_i = lroundf(fs);
+    double w = 2.*M_PI*shift/fs;
+    size_t i;
+
+    memset(lo, 0, sizeof(struct TDMA_FE_LO));
+    lo->phasor.real = 1.;
+    lo->step.real = cos(w);
+    lo->step.imag = sin(w);
+
+    if(fabsf(shift - shift_i) > 1e-3 || fabsf(fs - fs_i) > 1e-3 || fs_i <= 0)
+        return 0;
+
+    lo->len = fs_i/fe_gcd(labs(shift_i), fs_i);
+    if(lo->len > TDMA_FE_LO_MAX_TABLE){
+        lo->len = 0;
+        return 0;
+    }
+    lo->table = (COMP*) malloc(sizeof(COMP)*lo->len);
+    if(lo->table == NULL) return -1;
+    for(i = 0; i < lo->len; i++){
+        /* Signed; a negative shift must not wrap round as size_t */
+        long k = (((long)i*shift_i) % fs_i + fs_i) % fs_i;
+        double ph = 2.*M_PI*(double)k/fs_i;
+        lo->table[i].real = cos(ph);
+        lo->table[i].imag = sin(ph);
+    }
+    return 0;
+}
+
+static void fe_lo_reset(struct TDMA_FE_LO * lo){
+    lo->idx = 0;
+    lo->phasor.real = 1.;
+    lo->phasor.imag = 0.;
+}
+
+/*
+ * Mix n samples in place. sign is -1 to shift down, 1 to shift up.
+ * If the input is CS16, it is converted on the way in.
+ */
+static void fe_lo_mix(struct TDMA_FE_LO * lo, COMP * restrict x, const int16_t * restrict in16, float scale, size_t n, float sign){
+    size_t i = 0;
+
+    if(in16 != NULL){
+        for(i = 0; i < n; i++){
+            x[i].real = (float)in16[2*i]*scale;
+            x[i].imag = (float)in16[2*i+1]*scale;
+        }
+    }
+
+    if(lo->table != NULL){
+        i = 0;
+        while(i < n){
+            size_t seg = lo->len - lo->idx;
+            size_t j;
+            if(seg > n-i) seg = n-i;
+            const COMP * restrict t = &lo->table[lo->idx];
+            COMP * restrict y = &x[i];
+            for(j = 0; j < seg; j++){
+                float lr = t[j].real, li = sign*t[j].imag;
+                float xr = y[j].real, xi = y[j].imag;
+                y[j].real = xr*lr - xi*li;
+                y[j].imag = xr*li + xi*lr;
+            }
+            i += seg;
+            lo->idx += seg;
+            if(lo->idx == lo->len) lo->idx = 0;
+        }
+    }else{
+        float pr = lo->phasor.real, pi = lo->phasor.imag;
+        float sr = lo->step.real, si = lo->step.imag;
+        for(i = 0; i < n; i++){
+            float li = sign*pi;
+            float xr = x[i].real, xi = x[i].imag;
+            x[i].real = xr*pr - xi*li;
+            x[i].imag = xr*li + xi*pr;
+            float t = pr*sr - pi*si;
+            pi = pr*si + pi*sr;
+            pr = t;
+        }
+        /* Pull the phasor back onto the unit circle */
+        float mag = sqrtf(pr*pr + pi*pi);
+        lo->phasor.real = pr/mag;
+        lo->phasor.imag = pi/mag;
+    }
+}
+
+tdma_fe_rx_t * tdma_fe_rx_create(int decim, float shift, float fs_in, float cs16_scale){
+    tdma_fe_rx_t * fe;
+    float * taps;
+    int n_taps, i;
+
+    if(decim < 1) return NULL;
+
+    fe = (tdma_fe_rx_t*) calloc(1, sizeof(tdma_fe_rx_t));
+    if(fe == NULL) return NULL;
+
+    fe->decim = decim;
+    fe->cs16_scale = cs16_scale;
+
+    if(decim == 1){
+        taps = (float*) malloc(sizeof(float));
+        if(taps == NULL) goto tdma_fe_rx_create_err;
+        taps[0] = 1.;
+        n_taps = 1;
+    }else{
+        taps = fe_design_lowpass(decim, &n_taps);
+        if(taps == NULL) goto tdma_fe_rx_create_err;
+        /* Gain of the prototype is decim; decimation wants unity */
+        for(i = 0; i < n_taps; i++) taps[i] /= decim;
+    }
+    fe->n_taps = n_taps;
+    fe->taps = (float*) malloc(sizeof(float)*n_taps);
+    if(fe->taps == NULL){
+        free(taps);
+        goto tdma_fe_rx_create_err;
+    }
+    for(i = 0; i < n_taps; i++)
+        fe->taps[i] = taps[n_taps-1-i];
+    free(taps);
+
+    fe->buf = (COMP*) calloc(n_taps-1 + TDMA_FE_CHUNK, sizeof(COMP));
+    if(fe->buf == NULL) goto tdma_fe_rx_create_err;
+
+    if(fe_lo_init(&fe->lo, shift, fs_in)) goto tdma_fe_rx_create_err;
+
+    return fe;
+
+    tdma_fe_rx_create_err:
+    tdma_fe_rx_destroy(fe);
+    return NULL;
+}
+
+void tdma_fe_rx_destroy(tdma_fe_rx_t * fe){
+    if(fe == NULL) return;
+    free(fe->taps);
+    free(fe->buf);
+    free(fe->lo.table);
+    free(fe);
+}
+
+void tdma_fe_rx_reset(tdma_fe_rx_t * fe){
+    memset(fe->buf, 0, sizeof(COMP)*(fe->n_taps-1 + TDMA_FE_CHUNK));
+    fe->next = 0;
+    fe_lo_reset(&fe->lo);
+}
+
+size_t tdma_fe_rx_max_out(tdma_fe_rx_t * fe, size_t n){
+    return n/fe->decim + 1;
+}
+
+/* Filter and decimate the m new samples in fe->buf, then slide the history along */
+static size_t fe_rx_decim_chunk(tdma_fe_rx_t * fe, size_t m, COMP * restrict out){
+    const float * restrict h = fe->taps;
+    const int n_taps = fe->n_taps;
+    const size_t hist = n_taps-1;
+    size_t p, n_out = 0;
+    int j;
+
+    for(p = fe->next; p < m; p += fe->decim){
+        const COMP * restrict x = &fe->buf[p];
+        float acc_r = 0, acc_i = 0;
+        for(j = 0; j < n_taps; j++){
+            acc_r += h[j]*x[j].real;
+            acc_i += h[j]*x[j].imag;
+        }
+        out[n_out].real = acc_r;
+        out[n_out].imag = acc_i;
+        n_out++;
+    }
+    fe->next = p - m;
+
+    memmove(&fe->buf[0], &fe->buf[m], sizeof(COMP)*hist);
+    return n_out;
+}
+
+size_t tdma_fe_rx_cf32(tdma_fe_rx_t * fe, const COMP * in, size_t n, COMP * out){
+    COMP * chunk = &fe->buf[fe->n_taps-1];
+    size_t i, n_out = 0;
+
+    for(i = 0; i < n; i += TDMA_FE_CHUNK){
+        size_t m = (n-i) > TDMA_FE_CHUNK ? TDMA_FE_CHUNK : (n-i);
+        memcpy(chunk, &in[i], sizeof(COMP)*m);
+        fe_lo_mix(&fe->lo, chunk, NULL, 0, m, -1.);
+        n_out += fe_rx_decim_chunk(fe, m, &out[n_out]);
+    }
+    return n_out;
+}
+
+size_t tdma_fe_rx_cs16(tdma_fe_rx_t * fe, const int16_t * in, size_t n, COMP * out){
+    COMP * chunk = &fe->buf[fe->n_taps-1];
+    size_t i, n_out = 0;
+
+    for(i = 0; i < n; i += TDMA_FE_CHUNK){
+        size_t m = (n-i) > TDMA_FE_CHUNK ? TDMA_FE_CHUNK : (n-i);
+        fe_lo_mix(&fe->lo, chunk, &in[2*i], fe->cs16_scale, m, -1.);
+        n_out += fe_rx_decim_chunk(fe, m, &out[n_out]);
+    }
+    return n_out;
+}
+
+tdma_fe_tx_t * tdma_fe_tx_create(int interp, float shift, float fs_out, float cs16_scale){
+    tdma_fe_tx_t * fe;
+    float * taps;
+    int n_taps, n_sub, q, j;
+
+    if(interp < 1) return NULL;
+
+    fe = (tdma_fe_tx_t*) calloc(1, sizeof(tdma_fe_tx_t));
+    if(fe == NULL) return NULL;
+
+    fe->interp = interp;
+    fe->cs16_scale = cs16_scale;
+
+    if(interp == 1){
+        taps = (float*) malloc(sizeof(float));
+        if(taps == NULL) goto tdma_fe_tx_create_err;
+        taps[0] = 1.;
+        n_taps = 1;
+    }else{
+        taps = fe_design_lowpass(interp, &n_taps);
+        if(taps == NULL) goto tdma_fe_tx_create_err;
+    }
+
+    /* Split the prototype into interp branches, padding the end with zeros */
+    n_sub = (n_taps + interp-1)/interp;
+    fe->n_sub = n_sub;
+    fe->taps = (float*) calloc(n_sub*interp, sizeof(float));
+    if(fe->taps == NULL){
+        free(taps);
+        goto tdma_fe_tx_create_err;
+    }
+    for(q = 0; q < interp; q++){
+        for(j = 0; j < n_sub; j++){
+            int k = (n_sub-1-j)*interp + q;
+            fe->taps[q*n_sub + j] = k < n_taps ? taps[k] : 0.;
+        }
+    }
+    free(taps);
+
+    fe->hist = (COMP*) calloc(n_sub-1 + TDMA_FE_CHUNK, sizeof(COMP));
+    if(fe->hist == NULL) goto tdma_fe_tx_create_err;
+
+    if(fe_lo_init(&fe->lo, shift, fs_out)) goto tdma_fe_tx_create_err;
+
+    return fe;
+
+    tdma_fe_tx_create_err:
+    tdma_fe_tx_destroy(fe);
+    return NULL;
+}
+
+void tdma_fe_tx_destroy(tdma_fe_tx_t * fe){
+    if(fe == NULL) return;
+    free(fe->taps);
+    free(fe->hist);
+    free(fe->lo.table);
+    free(fe);
+}
+
+void tdma_fe_tx_reset(tdma_fe_tx_t * fe){
+    memset(fe->hist, 0, sizeof(COMP)*(fe->n_sub-1 + TDMA_FE_CHUNK));
+    fe_lo_reset(&fe->lo);
+}
+
+/* Interpolate the m new samples in fe->hist into m*interp samples at out, then slide the history along */
+static void fe_tx_interp_chunk(tdma_fe_tx_t * fe, size_t m, COMP * restrict out){
+    const int n_sub = fe->n_sub;
+    const int interp = fe->interp;
+    size_t i;
+    int q, j;
+
+    for(i = 0; i < m; i++){
+        const COMP * restrict x = &fe->hist[i];
+        for(q = 0; q < interp; q++){
+            const float * restrict h = &fe->taps[q*n_sub];
+            float acc_r = 0, acc_i = 0;
+            for(j = 0; j < n_sub; j++){
+                acc_r += h[j]*x[j].real;
+                acc_i += h[j]*x[j].imag;
+            }
+            out[i*interp + q].real = acc_r;
+            out[i*interp + q].imag = acc_i;
+        }
+    }
+
+    memmove(&fe->hist[0], &fe->hist[m], sizeof(COMP)*(n_sub-1));
+}
+
+size_t tdma_fe_tx_cf32(tdma_fe_tx_t * fe, const COMP * in, size_t n, COMP * out){
+    COMP * chunk = &fe->hist[fe->n_sub-1];
+    size_t i, n_out = 0;
+
+    for(i = 0; i < n; i += TDMA_FE_CHUNK){
+        size_t m = (n-i) > TDMA_FE_CHUNK ? TDMA_FE_CHUNK : (n-i);
+        memcpy(chunk, &in[i], sizeof(COMP)*m);
+        fe_tx_interp_chunk(fe, m, &out[n_out]);
+        fe_lo_mix(&fe->lo, &out[n_out], NULL, 0, m*fe->interp, 1.);
+        n_out += m*fe->interp;
+    }
+    return n_out;
+}
+
+size_t tdma_fe_tx_cs16(tdma_fe_tx_t * fe, const COMP * in, size_t n, int16_t * out){
+    COMP * chunk = &fe->hist[fe->n_sub-1];
+    const float scale = fe->cs16_scale;
+    size_t i, k, n_out = 0;
+    /* Radio samples for one input chunk; interp is small, so this stays on the stack */
+    size_t chunk_in = TDMA_FE_CHUNK/fe->interp;
+    if(chunk_in == 0) chunk_in = 1;
+    COMP scratch[chunk_in*fe->interp];
+
+    for(i = 0; i < n; i += chunk_in){
+        size_t m = (n-i) > chunk_in ? chunk_in : (n-i);
+        size_t m_out = m*fe->interp;
+        memcpy(chunk, &in[i], sizeof(COMP)*m);
+        fe_tx_interp_chunk(fe, m, scratch);
+        fe_lo_mix(&fe->lo, scratch, NULL, 0, m_out, 1.);
+
+        int16_t * restrict o = &out[2*n_out];
+        for(k = 0; k < m_out; k++){
+            float r = scratch[k].real*scale;
+            float im = scratch[k].imag*scale;
+            r = r > 32767.f ? 32767.f : (r < -32768.f ? -32768.f : r);
+            im = im > 32767.f ? 32767.f : (im < -32768.f ? -32768.f : im);
+            o[2*k] = (int16_t)lrintf(r);
+            o[2*k+1] = (int16_t)lrintf(im);
+        }
+        n_out += m_out;
+    }
+    return n_out;
+}
@@ -0,0 +1,106 @@
+/*---------------------------------------------------------------------------*\
+
+  FILE........: tdma_frontend.h
+  AUTHOR......: Brady O'Brien
+  DATE CREATED: 19 October 2026
+
+  Radio front end kernels; frequency shift and integer rate change between
+  the radio sample rate and the TDMA modem rate, for CF32 or CS16 samples
+
+\*---------------------------------------------------------------------------*/
+
+/*
+  Copyright (C) 2026 Brady O'Brien
+
+  All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License version 2.1, as
+  published by the Free Software Foundation.  This program is
+  distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __TDMA_FRONTEND_H
+#define __TDMA_FRONTEND_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "comp.h"
+
+/* Radio samples processed per inner loop; keeps the working set in L1 */
+#define TDMA_FE_CHUNK 512
+
+/* Longest LO period that will be kept as a table */
+#define TDMA_FE_LO_MAX_TABLE 4096
+
+/* Local oscillator. Either one period of exp(jwn) in a table, or a renormalized phasor */
+struct TDMA_FE_LO {
+    COMP * table;                   /* One period of the LO, or NULL to use the phasor */
+    size_t len;                     /* Length of table */
+    size_t idx;                     /* Next table entry */
+    COMP phasor;                    /* Current LO value if there's no table */
+    COMP step;                      /* Per-sample rotation if there's no table */
+};
+
+/* Radio -> modem; mix down and decimate with a FIR */
+struct TDMA_FE_RX {
+    int decim;                      /* Decimation factor */
+    int n_taps;                     /* FIR length */
+    float * taps;                   /* FIR taps, time reversed */
+    float cs16_scale;               /* int16 -> float scale for CS16 input */
+    struct TDMA_FE_LO lo;
+    COMP * buf;                     /* n_taps-1 samples of history, then TDMA_FE_CHUNK new ones */
+    int next;                       /* Offset into the next chunk of the next output sample */
+};
+
+/* Modem -> radio; polyphase FIR interpolate and mix up */
+struct TDMA_FE_TX {
+    int interp;                     /* Interpolation factor */
+    int n_sub;                      /* Taps per polyphase branch */
+    float * taps;                   /* interp branches of n_sub taps, each time reversed */
+    float cs16_scale;               /* float -> int16 scale for CS16 output */
+    struct TDMA_FE_LO lo;
+    COMP * hist;                    /* n_sub-1 samples of history, then TDMA_FE_CHUNK new ones */
+};
+
+typedef struct TDMA_FE_RX tdma_fe_rx_t;
+typedef struct TDMA_FE_TX tdma_fe_tx_t;
+
+/*
+ * Create a receive front end. Input at fs_in is shifted down by shift Hz and
+ * decimated by decim. cs16_scale converts CS16 input to float, eg. 1/32768.
+ * Returns NULL on failure.
+ */
+tdma_fe_rx_t * tdma_fe_rx_create(int decim, float shift, float fs_in, float cs16_scale);
+void tdma_fe_rx_destroy(tdma_fe_rx_t * fe);
+
+/* Most output samples n input samples can produce */
+size_t tdma_fe_rx_max_out(tdma_fe_rx_t * fe, size_t n);
+
+/* Process n radio samples. Returns the number of modem samples written to out */
+size_t tdma_fe_rx_cf32(tdma_fe_rx_t * fe, const COMP * in, size_t n, COMP * out);
+size_t tdma_fe_rx_cs16(tdma_fe_rx_t * fe, const int16_t * in, size_t n, COMP * out);
+
+/*
+ * Create a transmit front end. Modem samples are interpolated by interp and
+ * shifted up by shift Hz at fs_out. cs16_scale converts float to CS16 output,
+ * eg. 32767. Returns NULL on failure.
+ */
+tdma_fe_tx_t * tdma_fe_tx_create(int interp, float shift, float fs_out, float cs16_scale);
+void tdma_fe_tx_destroy(tdma_fe_tx_t * fe);
+
+/* Process n modem samples into n*interp radio samples. Returns the number written */
+size_t tdma_fe_tx_cf32(tdma_fe_tx_t * fe, const COMP * in, size_t n, COMP * out);
+size_t tdma_fe_tx_cs16(tdma_fe_tx_t * fe, const COMP * in, size_t n, int16_t * out);
+
+/* Clear filter history and LO phase */
+void tdma_fe_rx_reset(tdma_fe_rx_t * fe);
+void tdma_fe_tx_reset(tdma_fe_tx_t * fe);
+
+#endif
@@ -0,0 +1,381 @@
+/*---------------------------------------------------------------------------*\
+
+  FILE........: tdma_frontend_test.c
+  AUTHOR......: Brady O'Brien
+  DATE CREATED: 19 October 2026
+
+  Host tests for the radio front end kernels, which otherwise only run
+  against hardware. A tone goes out through the TX kernels and back through
+  the RX kernels, with both LO types, and must come back at the same
+  amplitude and frequency. Output mustn't depend on how the input is cut
+  into calls, and CS16 output must clip rather than wrap. Last, two modems
+  talk over the simulated radio with both hearing through the front end at
+  4800T rates. Returns non-zero if anything fails.
+
+\*---------------------------------------------------------------------------*/
+
+/*
+  Copyright (C) 2026 Brady O'Brien
+
+  All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License version 2.1, as
+  published by the Free Software Foundation.  This program is
+  distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <math.h>
+#include <tdma.h>
+
+#include "tdma_frontend.h"
+#include "tdma_testframer.h"
+#include "sim_radio.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846264338327950288
+#endif
+
+/* 4800T modem rate, and a Pluto-like radio rate and IF */
+#define FT_FS 48000
+#define FT_DECIM 4
+#define FT_SHIFT 45000.f
+
+/* Modem samples per tone test, and how many to skip while the filters fill */
+#define FT_N 9600
+#define FT_SETTLE 200
+
+static int ft_failed = 0;
+
+#define FT_CHECK(cond, ...) do { \
+    if(!(cond)){ \
+        fprintf(stderr,"FAIL %s:%d: ",__FILE__,__LINE__); \
+        fprintf(stderr,__VA_ARGS__); \
+        fprintf(stderr,"\n"); \
+        ft_failed = 1; \
+    } \
+} while(0)
+
+static u64 ft_rng = 1;
+
+static u64 ft_rand(void){
+    ft_rng ^= ft_rng >> 12;
+    ft_rng ^= ft_rng << 25;
+    ft_rng ^= ft_rng >> 27;
+    return ft_rng * 2685821657736338717ULL;
+}
+
+static void ft_tone(COMP * x, size_t n, float f, float amp){
+    size_t i;
+    for(i = 0; i < n; i++){
+        double ph = 2.*M_PI*f*i/FT_FS;
+        x[i].real = amp*cos(ph);
+        x[i].imag = amp*sin(ph);
+    }
+}
+
+/* Amplitude and frequency of a tone near f in y, past the filter settling */
+static void ft_measure(const COMP * y, size_t n, float f, float * amp, float * freq){
+    double cr = 0, ci = 0, dr = 0, di = 0;
+    size_t i;
+    for(i = FT_SETTLE; i < n; i++){
+        double ph = -2.*M_PI*f*i/FT_FS;
+        cr += y[i].real*cos(ph) - y[i].imag*sin(ph);
+        ci += y[i].real*sin(ph) + y[i].imag*cos(ph);
+        if(i+1 < n){
+            dr += y[i+1].real*y[i].real + y[i+1].imag*y[i].imag;
+            di += y[i+1].imag*y[i].real - y[i+1].real*y[i].imag;
+        }
+    }
+    *amp = sqrt(cr*cr + ci*ci)/(n - FT_SETTLE);
+    *freq = atan2(di, dr)*FT_FS/(2.*M_PI);
+}
+
+/* TX -> CS16 -> RX; the tone must come back where it went in */
+static void ft_roundtrip(float shift, bool want_table){
+    tdma_fe_tx_t * tx = tdma_fe_tx_create(FT_DECIM, shift, FT_FS*FT_DECIM, 32767.);
+    tdma_fe_rx_t * rx = tdma_fe_rx_create(FT_DECIM, shift, FT_FS*FT_DECIM, 1./32768.);
+    COMP * x = (COMP*) malloc(sizeof(COMP)*FT_N);
+    COMP * y = (COMP*) malloc(sizeof(COMP)*(FT_N+1));
+    int16_t * radio = (int16_t*) malloc(2*sizeof(int16_t)*FT_N*FT_DECIM);
+    float amp, freq;
+
+    if(!(tx != NULL && rx != NULL && x != NULL && y != NULL && radio != NULL)){
+        FT_CHECK(0, "couldn't set up round trip");
+        goto cleanup;
+    }
+    FT_CHECK((tx->lo.table != NULL) == want_table && (rx->lo.table != NULL) == want_table,
+        "shift %.3f should use the %s LO", shift, want_table ? "table" : "phasor");
+
+    ft_tone(x, FT_N, 3000., .5);
+    size_t n_radio = tdma_fe_tx_cs16(tx, x, FT_N, radio);
+    FT_CHECK(n_radio == FT_N*FT_DECIM, "TX gave %zu radio samples for %d", n_radio, FT_N);
+    size_t n_out = tdma_fe_rx_cs16(rx, radio, n_radio, y);
+    FT_CHECK(n_out == FT_N, "RX gave %zu modem samples for %d", n_out, FT_N);
+
+    ft_measure(y, n_out, 3000., &amp, &freq);
+    FT_CHECK(fabsf(amp - .5f) < .01f, "shift %.3f: tone came back at amplitude %f, not .5", shift, amp);
+    FT_CHECK(fabsf(freq - 3000.f) < 1.f, "shift %.3f: tone came back at %f Hz, not 3000", shift, freq);
+
+    /* The radio side should have it at the IF */
+    tdma_fe_rx_t * rx_if = tdma_fe_rx_create(FT_DECIM, 0., FT_FS*FT_DECIM, 1./32768.);
+    if(rx_if != NULL){
+        tdma_fe_rx_cs16(rx_if, radio, n_radio, y);
+        ft_measure(y, n_out, 3000., &amp, &freq);
+        FT_CHECK(amp < .01f, "shift %.3f: tone was at baseband on the radio side too", shift);
+        tdma_fe_rx_destroy(rx_if);
+    }
+
+    cleanup:
+    tdma_fe_tx_destroy(tx);
+    tdma_fe_rx_destroy(rx);
+    free(x);
+    free(y);
+    free(radio);
+}
+
+/* Output mustn't depend on how the input is cut up between calls */
+static void ft_chunking(float shift){
+    const size_t n_in = 20000;
+    tdma_fe_rx_t * rx_a = tdma_fe_rx_create(FT_DECIM, shift, FT_FS*FT_DECIM, 1./32768.);
+    tdma_fe_rx_t * rx_b = tdma_fe_rx_create(FT_DECIM, shift, FT_FS*FT_DECIM, 1./32768.);
+    tdma_fe_tx_t * tx_a = tdma_fe_tx_create(FT_DECIM, shift, FT_FS*FT_DECIM, 32767.);
+    tdma_fe_tx_t * tx_b = tdma_fe_tx_create(FT_DECIM, shift, FT_FS*FT_DECIM, 32767.);
+    int16_t * in = (int16_t*) malloc(2*sizeof(int16_t)*n_in);
+    COMP * out_a = (COMP*) malloc(sizeof(COMP)*(n_in+1));
+    COMP * out_b = (COMP*) malloc(sizeof(COMP)*(n_in+1));
+    int16_t * rad_a = (int16_t*) malloc(2*sizeof(int16_t)*n_in*FT_DECIM);
+    int16_t * rad_b = (int16_t*) malloc(2*sizeof(int16_t)*n_in*FT_DECIM);
+    size_t i, n_a, n_b;
+
+    if(!(rx_a != NULL && rx_b != NULL && tx_a != NULL && tx_b != NULL && in != NULL
+        && out_a != NULL && out_b != NULL && rad_a != NULL && rad_b != NULL)){
+        FT_CHECK(0, "couldn't set up chunking test");
+        goto cleanup;
+    }
+
+    for(i = 0; i < 2*n_in; i++)
+        in[i] = (int16_t)(ft_rand() >> 48);
+
+    /* RX, all at once and in odd sized pieces */
+    n_a = tdma_fe_rx_cs16(rx_a, in, n_in, out_a);
+    n_b = 0;
+    for(i = 0; i < n_in;){
+        size_t m = 1 + ft_rand() % 1500;
+        if(m > n_in - i) m = n_in - i;
+        n_b += tdma_fe_rx_cs16(rx_b, &in[2*i], m, &out_b[n_b]);
+        i += m;
+    }
+    FT_CHECK(n_a == n_b, "shift %.3f: RX gave %zu samples in one call, %zu in pieces", shift, n_a, n_b);
+    for(i = 0; i < n_a && i < n_b; i++){
+        float e = fabsf(out_a[i].real - out_b[i].real) + fabsf(out_a[i].imag - out_b[i].imag);
+        if(e > 1e-4f){
+            FT_CHECK(0, "shift %.3f: RX sample %zu differs by %g when cut up", shift, i, e);
+            break;
+        }
+    }
+
+    /* TX; the modem samples are the RX output */
+    n_a = tdma_fe_tx_cs16(tx_a, out_a, n_a, rad_a);
+    n_b = 0;
+    for(i = 0; i < n_a/FT_DECIM;){
+        size_t m = 1 + ft_rand() % 700;
+        if(m > n_a/FT_DECIM - i) m = n_a/FT_DECIM - i;
+        n_b += tdma_fe_tx_cs16(tx_b, &out_a[i], m, &rad_b[2*n_b]);
+        i += m;
+    }
+    FT_CHECK(n_b == (n_a/FT_DECIM)*FT_DECIM, "shift %.3f: TX gave %zu samples in pieces", shift, n_b);
+    for(i = 0; i < 2*n_b; i++){
+        if(abs(rad_a[i] - rad_b[i]) > 1){
+            FT_CHECK(0, "shift %.3f: TX sample %zu is %d in one call, %d in pieces", shift, i/2, rad_a[i], rad_b[i]);
+            break;
+        }
+    }
+
+    cleanup:
+    tdma_fe_rx_destroy(rx_a);
+    tdma_fe_rx_destroy(rx_b);
+    tdma_fe_tx_destroy(tx_a);
+    tdma_fe_tx_destroy(tx_b);
+    free(in);
+    free(out_a);
+    free(out_b);
+    free(rad_a);
+    free(rad_b);
+}
+
+/* Too hot for CS16; it must clip to the rails, not wrap round */
+static void ft_saturation(void){
+    const size_t n = 2400;
+    tdma_fe_tx_t * tx_f = tdma_fe_tx_create(FT_DECIM, FT_SHIFT, FT_FS*FT_DECIM, 1.);
+    tdma_fe_tx_t * tx_s = tdma_fe_tx_create(FT_DECIM, FT_SHIFT, FT_FS*FT_DECIM, 32767.);
+    COMP * x = (COMP*) malloc(sizeof(COMP)*n);
+    COMP * ref = (COMP*) malloc(sizeof(COMP)*n*FT_DECIM);
+    int16_t * out = (int16_t*) malloc(2*sizeof(int16_t)*n*FT_DECIM);
+    size_t i;
+    int clipped = 0;
+
+    if(!(tx_f != NULL && tx_s != NULL && x != NULL && ref != NULL && out != NULL)){
+        FT_CHECK(0, "couldn't set up saturation test");
+        goto cleanup;
+    }
+
+    ft_tone(x, n, 1000., 3.);
+    tdma_fe_tx_cf32(tx_f, x, n, ref);
+    tdma_fe_tx_cs16(tx_s, x, n, out);
+    for(i = 0; i < 2*n*FT_DECIM; i++){
+        float r = (i & 1) ? ref[i/2].imag : ref[i/2].real;
+        float want = r*32767.f;
+        want = want > 32767.f ? 32767.f : (want < -32768.f ? -32768.f : want);
+        if(fabsf(want - out[i]) > 1.5f){
+            FT_CHECK(0, "sample %zu is %d, wanted %.0f", i/2, out[i], want);
+            break;
+        }
+        if(out[i] == 32767 || out[i] == -32768)
+            clipped++;
+    }
+    FT_CHECK(clipped > 0, "a tone at 3x full scale never clipped");
+
+    cleanup:
+    tdma_fe_tx_destroy(tx_f);
+    tdma_fe_tx_destroy(tx_s);
+    free(x);
+    free(ref);
+    free(out);
+}
+
+/* The table LO and the phasor LO must agree */
+static void ft_lo_match(void){
+    const size_t n = 4800;
+    tdma_fe_rx_t * rx_t = tdma_fe_rx_create(1, FT_SHIFT, FT_FS*FT_DECIM, 1.);
+    tdma_fe_rx_t * rx_p = tdma_fe_rx_create(1, FT_SHIFT + .01f, FT_FS*FT_DECIM, 1.);
+    COMP * x = (COMP*) malloc(sizeof(COMP)*n);
+    COMP * y_t = (COMP*) malloc(sizeof(COMP)*(n+1));
+    COMP * y_p = (COMP*) malloc(sizeof(COMP)*(n+1));
+    size_t i;
+
+    if(!(rx_t != NULL && rx_p != NULL && x != NULL && y_t != NULL && y_p != NULL)){
+        FT_CHECK(0, "couldn't set up LO test");
+        goto cleanup;
+    }
+    FT_CHECK(rx_t->lo.table != NULL && rx_p->lo.table == NULL, "wrong LO types for the LO test");
+
+    for(i = 0; i < n; i++){
+        x[i].real = 1.;
+        x[i].imag = 0.;
+    }
+    tdma_fe_rx_cf32(rx_t, x, n, y_t);
+    tdma_fe_rx_cf32(rx_p, x, n, y_p);
+    for(i = 0; i < n; i++){
+        float e = fabsf(y_t[i].real - y_p[i].real) + fabsf(y_t[i].imag - y_p[i].imag);
+        if(e > 5e-3f){
+            FT_CHECK(0, "LOs differ by %g at sample %zu", e, i);
+            break;
+        }
+    }
+
+    cleanup:
+    tdma_fe_rx_destroy(rx_t);
+    tdma_fe_rx_destroy(rx_p);
+    free(x);
+    free(y_t);
+    free(y_p);
+}
+
+/* Master and client over the simulated radio, both hearing through the front end */
+static void ft_loopback(void){
+    const int n_stations = 2;
+    const float secs = 5;
+    struct TDMA_MODE_SETTINGS mode = FREEDV_4800T;
+    tdma_t * tdmas[2] = {NULL, NULL};
+    tdma_test_framer * ttfs[2] = {NULL, NULL};
+    sim_radio_t * sim = NULL;
+    int i;
+
+    for(i = 0; i < n_stations; i++){
+        tdmas[i] = tdma_create(mode);
+        FT_CHECK(tdmas[i] != NULL, "couldn't create modem %d", i);
+        if(tdmas[i] == NULL) goto cleanup;
+        tdmas[i]->tx_multislot_delay = 3;
+        tdmas[i]->loop_delay = 0;
+        ttfs[i] = ttf_create(tdmas[i]);
+        ttf_clear_counts(ttfs[i]);
+        ttfs[i]->tx_seq = 0;
+        ttfs[i]->tx_id = 100+i;
+        ttfs[i]->rx_id_min = 100;
+        ttfs[i]->rx_id_max = 100+n_stations-1;
+        ttfs[i]->tx_repeat = false;
+        ttfs[i]->print_enable = false;
+        ttfs[i]->tx_enable = true;
+        ttfs[i]->tx_master = (i == 0);
+    }
+
+    sim = sim_radio_create(n_stations, mode.samp_rate, tdma_nin(tdmas[0]), false, 1);
+    FT_CHECK(sim != NULL, "couldn't create radio simulator");
+    if(sim == NULL) goto cleanup;
+    for(i = 0; i < n_stations; i++){
+        struct SIM_STATION_PARAMS p;
+        memset(&p, 0, sizeof(p));
+        p.gain = .5;
+        p.noise_std = .005;
+        p.fe_decim = FT_DECIM;
+        p.fe_shift = FT_SHIFT;
+        if(sim_radio_add_station(sim, tdmas[i], &p) < 0){
+            FT_CHECK(0, "couldn't add station %d", i);
+            goto cleanup;
+        }
+    }
+
+    tdma_set_master(tdmas[0], true);
+    tdma_start_tx(tdmas[0], 0);
+    bool client_tx = false;
+    u64 n_slots = (u64)(secs*mode.samp_rate/tdma_nin(tdmas[0]));
+    u64 s;
+    for(s = 0; s < n_slots; s++){
+        sim_radio_step(sim);
+        if(!client_tx && tdma_get_slot(tdmas[1],0)->state == rx_sync){
+            tdma_start_tx(tdmas[1], 1);
+            client_tx = true;
+        }
+    }
+
+    FT_CHECK(client_tx, "client never got sync through the front end");
+    FT_CHECK(ttfs[1]->nframes_rx >= .8*ttfs[0]->tx_frame_count, "client got %u frames of %u sent through the front end",
+        ttfs[1]->nframes_rx, ttfs[0]->tx_frame_count);
+    FT_CHECK(ttfs[1]->nbits_rx_err <= .01*ttfs[1]->nbits_rx, "client had %llu bit errors in %llu through the front end",
+        (unsigned long long)ttfs[1]->nbits_rx_err, (unsigned long long)ttfs[1]->nbits_rx);
+
+    cleanup:
+    sim_radio_destroy(sim);
+    for(i = 0; i < n_stations; i++){
+        if(ttfs[i] != NULL) ttf_destroy(ttfs[i]);
+        if(tdmas[i] != NULL) tdma_destroy(tdmas[i]);
+    }
+}
+
+int main(void){
+    /* Integer shifts that repeat in 64 and 8 samples; one that never repeats; and one off an integer */
+    ft_roundtrip(FT_SHIFT, true);
+    ft_roundtrip(-24000.f, true);
+    ft_roundtrip(45001.f, false);
+    ft_roundtrip(-30000.5f, false);
+    ft_chunking(FT_SHIFT);
+    ft_chunking(45001.f);
+    ft_chunking(-24000.f);
+    ft_saturation();
+    ft_lo_match();
+    ft_loopback();
+
+    printf("%s\n", ft_failed ? "FAIL" : "PASS");
+    return ft_failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
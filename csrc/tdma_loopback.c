@@ -0,0 +1,230 @@
+/*---------------------------------------------------------------------------*\
+
+  FILE........: tdma_loopback.c
+  AUTHOR......: Brady O'Brien
+  DATE CREATED: 19 October 2026
+
+  Runs several TDMA test framers against each other over the simulated
+  radio, and reports frame errors, TX scheduling latency, and throughput.
+  Station 0 is master on slot 0, station 1 answers on slot 1 once it has
+  sync, and any others just listen.
+
+\*---------------------------------------------------------------------------*/
+
+/*
+  Copyright (C) 2026 Brady O'Brien
+
+  All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License version 2.1, as
+  published by the Free Software Foundation.  This program is
+  distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <math.h>
+#include <unistd.h>
+#include <tdma.h>
+
+#include "tdma_testframer.h"
+#include "sim_radio.h"
+#include "modem_probe.h"
+
+static void usage(const char * name){
+    fprintf(stderr,"usage: %s [-n stations] [-s seconds] [-r] [-S snr_db] [-d delay] [-f freq_offset] [-p ppm] [-x slots] [-v] [-t] [-R] [-F decim] [-H shift] [-P capture]\n",name);
+    fprintf(stderr,"  -r  pace to real time instead of running as fast as possible\n");
+    fprintf(stderr,"  -S  per-sample SNR at each receiver, dB\n");
+    fprintf(stderr,"  -d, -f, -p  delay in samples, offset in Hz, and clock error of station 1;\n");
+    fprintf(stderr,"      station i gets i times these. Delay defaults to 40; below about 20\n");
+    fprintf(stderr,"      the client's bursts land too early for the master to hear them\n");
+    fprintf(stderr,"  -x  tx_multislot_delay\n");
+    fprintf(stderr,"  -v  print frames as they are received\n");
+    fprintf(stderr,"  -t  print every station's per-slot telemetry as CSV\n");
+    fprintf(stderr,"  -R  take received frames from the frame ring, not the RX callback\n");
+    fprintf(stderr,"  -F  hear through the CS16 radio front end at decim times the modem rate\n");
+    fprintf(stderr,"  -H  front end IF, Hz (default 45000)\n");
+    fprintf(stderr,"  -P  write a modem probe capture, if built with MODEMPROBE\n");
+}
+
+int main(int argc,char ** argv){
+    int n_stations = 2;
+    float secs = 10;
+    bool realtime = false;
+    float snr_db = 20;
+    int delay = 40;
+    float foff = 0;
+    float ppm = 0;
+    int multislot_delay = 3;
+    bool verbose = false;
+    bool telem = false;
+    bool frame_ring = false;
+    int fe_decim = 0;
+    float fe_shift = 45000;
+    char * probe_file = NULL;
+    int opt, i;
+
+    while((opt = getopt(argc, argv, "n:s:rS:d:f:p:x:vtRF:H:P:h")) != -1){
+        switch(opt){
+            case 'n': n_stations = atoi(optarg); break;
+            case 's': secs = atof(optarg); break;
+            case 'r': realtime = true; break;
+            case 'S': snr_db = atof(optarg); break;
+            case 'd': delay = atoi(optarg); break;
+            case 'f': foff = atof(optarg); break;
+            case 'p': ppm = atof(optarg); break;
+            case 'x': multislot_delay = atoi(optarg); break;
+            case 'v': verbose = true; break;
+            case 't': telem = true; break;
+            case 'R': frame_ring = true; break;
+            case 'F': fe_decim = atoi(optarg); break;
+            case 'H': fe_shift = atof(optarg); break;
+            case 'P': probe_file = optarg; break;
+            default:
+                usage(argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+    if(n_stations < 2){
+        fprintf(stderr,"Need at least 2 stations\n");
+        return EXIT_FAILURE;
+    }
+
+    if(probe_file != NULL){
+        modem_probe_init("tdma_loopback", probe_file);
+        modem_probe_thread_init();
+    }
+
+    struct TDMA_MODE_SETTINGS mode = FREEDV_4800T;
+    tdma_t * tdmas[n_stations];
+    tdma_test_framer * ttfs[n_stations];
+
+    for(i = 0; i < n_stations; i++){
+        tdmas[i] = tdma_create(mode);
+        if(tdmas[i] == NULL){
+            fprintf(stderr,"Couldn't create modem %d\n",i);
+            return EXIT_FAILURE;
+        }
+        tdmas[i]->tx_multislot_delay = multislot_delay;
+        tdmas[i]->loop_delay = 0;
+        ttfs[i] = ttf_create(tdmas[i]);
+        ttf_clear_counts(ttfs[i]);
+        ttfs[i]->tx_seq = 0;
+        ttfs[i]->tx_id = 100+i;
+        ttfs[i]->rx_id_min = 100;
+        ttfs[i]->rx_id_max = 100+n_stations-1;
+        ttfs[i]->tx_repeat = false;
+        ttfs[i]->print_enable = verbose;
+        ttfs[i]->tx_enable = (i < 2);
+        ttfs[i]->tx_master = (i == 0);
+        if(telem && tdma_enable_telemetry(tdmas[i], 64)){
+            fprintf(stderr,"Couldn't set up telemetry\n");
+            return EXIT_FAILURE;
+        }
+        if(frame_ring && ttf_use_frame_ring(ttfs[i], 16)){
+            fprintf(stderr,"Couldn't set up frame ring\n");
+            return EXIT_FAILURE;
+        }
+    }
+    if(telem)
+        printf("station,seq,timestamp,slot,slot_state,tdma_state,uw_valid,uw_errs,bad_uw,master_count,frame_offset,sync_offset,ebno,ppm,f1,f2,f3,f4\n");
+
+    sim_radio_t * sim = sim_radio_create(n_stations, mode.samp_rate, tdma_nin(tdmas[0]), realtime, 1);
+    if(sim == NULL){
+        fprintf(stderr,"Couldn't create radio simulator\n");
+        return EXIT_FAILURE;
+    }
+
+    /* fsk_mod_c output has amplitude 2; scale it to unit power so -S is the SNR */
+    float noise_std = sqrtf(.5/powf(10.,snr_db/10.));
+    for(i = 0; i < n_stations; i++){
+        struct SIM_STATION_PARAMS p;
+        p.delay = (i64)delay*i;
+        p.freq_offset = foff*i;
+        p.ppm = ppm*i;
+        p.gain = .5;
+        p.noise_std = noise_std;
+        p.fe_decim = fe_decim;
+        p.fe_shift = fe_shift;
+        if(sim_radio_add_station(sim, tdmas[i], &p) < 0){
+            fprintf(stderr,"Couldn't add station %d to the simulator\n",i);
+            return EXIT_FAILURE;
+        }
+    }
+
+    /* Master starts sending right away; the other TXing station waits for it */
+    tdma_set_master(tdmas[0], true);
+    tdma_start_tx(tdmas[0], 0);
+    bool client_tx = false;
+
+    u64 n_slots = (u64)(secs*mode.samp_rate/tdma_nin(tdmas[0]));
+    u64 s;
+    for(s = 0; s < n_slots; s++){
+        sim_radio_step(sim);
+        for(i = 0; frame_ring && i < n_stations; i++)
+            ttf_drain_frames(ttfs[i]);
+        for(i = 0; telem && i < n_stations; i++){
+            struct TDMA_TELEM r;
+            while(tdma_telemetry_pop(tdmas[i], &r)){
+                printf("%d,%llu,%lld,%u,%u,%u,%u,%u,%u,%d,%d,%d,%.2f,%.1f,%.1f,%.1f,%.1f,%.1f\n",
+                    i,(unsigned long long)r.seq,(long long)r.timestamp,r.slot_i,r.slot_state,r.tdma_state,
+                    r.uw_valid,r.uw_errs,r.bad_uw_count,r.master_count,r.slot_local_frame_offset,
+                    r.sample_sync_offset,r.EbNodB,r.ppm,r.f_est[0],r.f_est[1],r.f_est[2],r.f_est[3]);
+            }
+        }
+        if(!client_tx && tdma_get_slot(tdmas[1],0)->state == rx_sync){
+            tdma_start_tx(tdmas[1], 1);
+            client_tx = true;
+            fprintf(stderr,"Station 1 starting TX at %.3fs\n",(double)(s*tdma_nin(tdmas[0]))/mode.samp_rate);
+        }
+    }
+
+    struct SIM_RADIO_STATS st;
+    sim_radio_get_stats(sim, &st);
+
+    printf("Simulated %.2fs in %.2fs wall, %.1fx real time\n",(double)st.samps/mode.samp_rate,st.wall_secs,st.realtime_factor);
+    printf("tdma_rx time: mean %.1fus max %.1fus\n",st.rx_time_mean_ns*1e-3,st.rx_time_max_ns*1e-3);
+    printf("TX bursts %llu late %llu dropped %llu\n",(unsigned long long)st.tx_bursts,(unsigned long long)st.tx_late,(unsigned long long)st.tx_dropped);
+    printf("RX->TX callback latency: min %.1fus mean %.1fus max %.1fus\n",
+        st.cb_latency_min_ns*1e-3,st.cb_latency_mean_ns*1e-3,st.cb_latency_max_ns*1e-3);
+    printf("TX lead over RX: min %lld mean %.1f max %lld samples\n",
+        (long long)st.tx_lead_min,st.tx_lead_mean,(long long)st.tx_lead_max);
+
+    for(i = 0; i < n_stations; i++){
+        tdma_test_framer * ttf = ttfs[i];
+        /* Every other station's frames were on this one's air */
+        u64 n_expected = 0;
+        int j;
+        for(j = 0; j < n_stations; j++)
+            if(j != i)
+                n_expected += ttfs[j]->tx_frame_count;
+        u64 n_missed = n_expected > ttf->nframes_rx ? n_expected - ttf->nframes_rx : 0;
+        printf("Station %d: rx bits %llu errors %llu (BER %.2e), tx bits %llu\n",i,
+            (unsigned long long)ttf->nbits_rx,(unsigned long long)ttf->nbits_rx_err,
+            ttf->nbits_rx ? (double)ttf->nbits_rx_err/ttf->nbits_rx : 0.,
+            (unsigned long long)ttf->nbits_tx);
+        printf("Station %d: rx frames %u of %llu sent, missed %llu (FER %.2e), false frames %u\n",i,
+            ttf->nframes_rx,(unsigned long long)n_expected,(unsigned long long)n_missed,
+            n_expected ? (double)n_missed/n_expected : 0.,ttf->nframes_rx_false);
+        if(frame_ring)
+            printf("Station %d: frames dropped from ring %llu\n",i,(unsigned long long)tdma_frames_dropped(tdmas[i]));
+    }
+
+    sim_radio_destroy(sim);
+    if(probe_file != NULL)
+        modem_probe_close();
+    for(i = 0; i < n_stations; i++){
+        ttf_destroy(ttfs[i]);
+        tdma_destroy(tdmas[i]);
+    }
+
+    return 0;
+}
@@ -37,22 +37,7 @@
 #include <liquid/liquid.h>
 
 #include "tdma_testframer.h"
-
-typedef struct {
-    float complex *     tx_buffer;
-    bool                have_tx;
-    int64_t             tx_time;
-} tdma_stuff_holder;
-
-int cb_tx_burst(tdma_t * tdma,float complex* samples, size_t n_samples,i64 timestamp,void * cb_data){
-    tdma_stuff_holder * tx_stuff = (tdma_stuff_holder*) cb_data;
-    tx_stuff->have_tx = true;
-    tx_stuff->tx_time = timestamp;
-    for(int i = 0; i < tdma_nout(tdma); i++){
-        samples[i] = samples[i]*.2;
-    }
-    memcpy(tx_stuff->tx_buffer,samples,sizeof(float complex)*tdma_nout(tdma));
-}
+#include "soapy_tdma.h"
 
 static void json_error(json_error_t * err){
     fprintf(stderr,"Json Error line %d: %s \n",err->line,err->text);
@@ -129,36 +114,6 @@ int main(int argc,char ** argv){
     tdma_test_framer * ttf = ttf_create(tdma);
     ttf->print_enable = true;
 
-    int nin = tdma_nin(tdma);
-    int nout = tdma_nout(tdma);
-    float Fs_tdma = (float)mode.samp_rate;
-    float rs_ratio = Fs_bb / Fs_tdma;
-    float rrs_ratio = rs_ratio;
-    //int rrs_ratio = 20;
-    int nin_bb = nin*rrs_ratio;
-    int nout_bb = nout*rrs_ratio;
-
-    nco_crcf downmixer = nco_crcf_create(LIQUID_NCO);
-    nco_crcf upmixer = nco_crcf_create(LIQUID_NCO);
-    nco_crcf_set_phase(downmixer, 0.0f);
-    nco_crcf_set_phase(upmixer, 0.0f);
-    nco_crcf_set_frequency(downmixer,2.*M_PI*(band_shift/Fs_bb));
-    nco_crcf_set_frequency(upmixer,2.*M_PI*(band_shift/Fs_bb));
-    int decim_len = 21;
-
-    tdma_stuff_holder tx_stuff;
-    tx_stuff.tx_buffer = malloc(sizeof(complex float)*nout);
-    tx_stuff.have_tx = false;
-    tx_stuff.tx_time = 0;
-
-    if(enable_tx)
-        tdma_set_tx_burst_cb(tdma,cb_tx_burst,(void*)&tx_stuff);
-
-    //float filter_taps[decim_len]
-    //firdecim_crcf decim_filter = firdecim_crcf_create_prototype(rrs_ratio,20,50);
-    msresamp_crcf decim_filter = msresamp_crcf_create(1.0/((float)rs_ratio),50.0f);
-    msresamp_crcf interp_filter = msresamp_crcf_create((float)rs_ratio,50.0f);
-
     SoapySDRDevice_setBandwidth(sdr, SOAPY_SDR_RX,0, 5e6);
     SoapySDRDevice_setBandwidth(sdr, SOAPY_SDR_TX,0, 5e6);
 
@@ -232,49 +187,45 @@ int main(int argc,char ** argv){
         fprintf(stderr,"RC_JSON NULL!\n");
     }
 
-    //setup a stream (complex floats)
-    SoapySDRStream *rxStream;
-    SoapySDRStream *txStream;
-    if (SoapySDRDevice_setupStream(sdr, &rxStream, SOAPY_SDR_RX, SOAPY_SDR_CF32, NULL, 0, NULL) != 0){
-        fprintf(stderr,"setupStream fail: %s\n", SoapySDRDevice_lastError());
+    /* Which CPUs to pin the radio and DSP threads to, if any */
+    int rx_cpu = -1;
+    int tx_cpu = -1;
+    int dsp_cpu = -1;
+    if(json_is_integer(json_object_get(config_json,"rx_cpu")))
+        rx_cpu = json_integer_value(json_object_get(config_json,"rx_cpu"));
+    if(json_is_integer(json_object_get(config_json,"tx_cpu")))
+        tx_cpu = json_integer_value(json_object_get(config_json,"tx_cpu"));
+    if(json_is_integer(json_object_get(config_json,"dsp_cpu")))
+        dsp_cpu = json_integer_value(json_object_get(config_json,"dsp_cpu"));
+
+    /* Sample format between the radio and host; CS16 halves the bus bandwidth */
+    const char * sdr_format = json_string_value(json_object_get(config_json,"sdr_format"));
+
+    /* Set up radio streams, mixers, and resamplers */
+    int err;
+    soapy_tdma_radio_t * radio = soapy_tdma_create(sdr,tdma,band_shift,&err,!enable_tx,sdr_format);
+    if(radio == NULL){
+        fprintf(stderr,"Couldn't set up radio for TDMA\n");
+        return EXIT_FAILURE;
     }
-
-    if(enable_tx){
-        if (SoapySDRDevice_setupStream(sdr, &txStream, SOAPY_SDR_TX, SOAPY_SDR_CF32, NULL, 0, NULL) != 0){
-            fprintf(stderr,"setupStream fail: %s\n", SoapySDRDevice_lastError());
-        }   
+    radio->tx_gain = .2;
+    /* Direct buffer access is used if the driver supports it, unless turned off in config */
+    json_t * direct_json = json_object_get(config_json,"sdr_direct_access");
+    if(direct_json != NULL)
+        radio->use_direct_access = json_is_true(direct_json);
+    soapy_tdma_set_affinity(radio,rx_cpu,tx_cpu);
+    if(soapy_tdma_pin_self(dsp_cpu))
+        fprintf(stderr,"Couldn't pin DSP thread to CPU %d\n",dsp_cpu);
+
+    if(soapy_tdma_start_streams(radio)){
+        fprintf(stderr,"Couldn't start radio streams\n");
+        soapy_tdma_destroy(radio);
+        SoapySDRDevice_unmake(sdr);
+        ttf_destroy(ttf);
+        tdma_destroy(tdma);
+        return EXIT_FAILURE;
     }
 
-
-    if(enable_tx)    
-        SoapySDRDevice_activateStream(sdr, txStream, 0,0,0);    
-    
-    SoapySDRDevice_activateStream(sdr, rxStream, 0, 0, 0); //start streaming
-    //create a re-usable buffer for rx samples
-    complex float slot_bbrx_buffer[nin_bb];
-    complex float slot_bbrx_buffer_dm[nin_bb];
-    complex float slot_bbtx_buffer[nout_bb];
-    complex float slot_bbtx_buffer_dm[nout_bb];
-    complex float slot_rx_buffer[nin];
-
-    int flags_rx;
-    int flags_tx;
-    i64 timeNsRx;
-    i64 timeStartNsRx;
-    i64 ts_tx_ns;
-    i64 ts_tx_48k;
-    i64 ts_rx_48k;
-    int mtu_tx = 0;
-    if(enable_tx)
-        mtu_tx = SoapySDRDevice_getStreamMTU(sdr, txStream);
-    int nsamp_rx = 0;
-    int nsamp_tx = 0;
-    int n_written_decim;
-    bool first_rx_loop;
-    int ret_rx;
-    int ret_tx;
-    bool tx_done,rx_done;
-
     bool tx_started = false;
     printf("Running\n");
     for(size_t i = 0; i<30000; i++){
@@ -293,71 +244,31 @@ int main(int argc,char ** argv){
             //tdma_start_tx(tdma,0);
         }
 
-        /* If we have TX frame, upconvert for radio */
-        if(tx_stuff.have_tx){
-            msresamp_crcf_execute(interp_filter, tx_stuff.tx_buffer, nout, slot_bbtx_buffer_dm, &n_written_decim);
-            nco_crcf_mix_block_up(upmixer,slot_bbtx_buffer_dm,slot_bbtx_buffer,nout_bb);
-            ts_tx_ns = (tx_stuff.tx_time*62500)/3;
-        }
-
-        rx_done = false;
-        /* Do RX and TX with radio */
-        tx_done = ! (tx_stuff.have_tx && enable_tx);
-        first_rx_loop = true;
-        nsamp_rx = nsamp_tx = 0;
-        while(!(tx_done&&rx_done)){
-            if(!rx_done){
-                void *rx_buffs[] = { &slot_bbrx_buffer[nsamp_rx] }; 
-                flags_rx = 0;
-                int ret_rx =  SoapySDRDevice_readStream(sdr, rxStream, rx_buffs, nin_bb - nsamp_rx, &flags_rx, &timeNsRx, 100000);
-                if(ret_rx < 0){
-                    printf("err rx: %d\n",ret_rx);
-                    rx_done = true;
-                }
-                nsamp_rx += ret_rx;
-                if(nsamp_rx >= nin_bb) rx_done = true;
-                if(first_rx_loop)
-                    timeStartNsRx = timeNsRx;
-                first_rx_loop = false;
-            }
-            if(!tx_done){
-                void *tx_buffs[] = { &slot_bbtx_buffer[nsamp_tx] };
-                flags_tx = SOAPY_SDR_END_BURST;
-                if(nsamp_tx == 0) flags_tx |= SOAPY_SDR_HAS_TIME;
-                ret_tx = SoapySDRDevice_writeStream(sdr, txStream, tx_buffs, (nout_bb - nsamp_tx), &flags_tx, ts_tx_ns,100000);
-                if(ret_tx < 0){
-                    printf("err tx: %d\n",ret_tx);
-                    tx_done = true;
-                }
-                nsamp_tx += ret_tx;
-                if(nsamp_tx >= nout_bb) tx_done = true;
-            }
-        }
-        tx_stuff.have_tx = false;
-
-        /* Downconvert RX frame and give to TDMA stack */
-
-        nco_crcf_mix_block_down(downmixer, slot_bbrx_buffer, slot_bbrx_buffer_dm, nin_bb);
-        msresamp_crcf_execute(decim_filter, slot_bbrx_buffer_dm, nin_bb, slot_rx_buffer, &n_written_decim);
-        ts_rx_48k = (timeStartNsRx*3)/62500;
-        tdma_rx(tdma,slot_rx_buffer,ts_rx_48k);
+        /* Wait for a slot from the RX thread and demod it. TX bursts are queued to the TX thread */
+        if(soapy_tdma_loop(radio))
+            break;
     }
 
-    SoapySDRDevice_deactivateStream(sdr, rxStream, 0, 0); 
-    SoapySDRDevice_closeStream(sdr, rxStream);
+    soapy_tdma_stop_streams(radio);
 
-    if(enable_tx){
-        SoapySDRDevice_deactivateStream(sdr, txStream, 0, 0); 
-        SoapySDRDevice_closeStream(sdr, txStream);
-    }
+    struct SOAPY_TDMA_STATS stats;
+    soapy_tdma_get_stats(radio,&stats);
+    fprintf(stderr,"RX %s, TX %s\n",stats.rx_direct?"direct":"readStream",stats.tx_direct?"direct":"writeStream");
+    fprintf(stderr,"RX samps %llu overflows %llu dropped blocks %llu errors %llu discarded slots %llu\n",
+        (unsigned long long)stats.rx_samps,(unsigned long long)stats.rx_overflows,
+        (unsigned long long)stats.rx_ring_drops,(unsigned long long)stats.rx_errors,
+        (unsigned long long)stats.rx_slot_discards);
+    fprintf(stderr,"TX bursts %llu underflows %llu late %llu dropped bursts %llu errors %llu\n",
+        (unsigned long long)stats.tx_bursts,(unsigned long long)stats.tx_underflows,
+        (unsigned long long)stats.tx_late,(unsigned long long)stats.tx_ring_drops,
+        (unsigned long long)stats.tx_errors);
+
+    soapy_tdma_destroy(radio);
 
     SoapySDRDevice_unmake(sdr);
 
     ttf_destroy(ttf);
     tdma_destroy(tdma);
-    nco_crcf_destroy(downmixer);
-    nco_crcf_destroy(upmixer);
-    msresamp_crcf_destroy(decim_filter);
 
     return EXIT_SUCCESS;
 
@@ -25,6 +25,7 @@
   along with this program; if not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <math.h>
 #include "tdma_testframer.h"
 
 static int ttf_tx_frame(u8* frame_bits,u32 slot_i, slot_t * slot, tdma_t * tdma,u8 * uw_type, void * cb_data){
@@ -38,12 +39,15 @@ static int ttf_tx_frame(u8* frame_bits,u32 slot_i, slot_t * slot, tdma_t * tdma,
         return 0;
     }
 
+    /* This runs inside tdma_rx, so the state can change for this slot rather than
+       the next. A client drops back to no_sync every frame it sends, so it starts
+       hunting for the master as soon as it loses slot sync */
     if(ttf->tx_master){
         frame_bits[tdma->master_bit_pos] = 1;
-        tdma->state = master_sync;
+        tdma_set_state_now(tdma,master_sync);
     }else{
         frame_bits[tdma->master_bit_pos] = 0;
-        tdma->state = rx_no_sync;
+        tdma_set_state_now(tdma,no_sync);
     }
 
     /* TODO: implement repeater mode */
@@ -59,6 +63,7 @@ static int ttf_tx_frame(u8* frame_bits,u32 slot_i, slot_t * slot, tdma_t * tdma,
     int tx_id_enc = golay23_encode((uint32_t)(ttf->tx_id&0xFFF));
 
     ttf->nbits_tx += 23*2;
+    ttf->tx_frame_count++;
 
     int bit_idx = 0;
     int word_idx = 0;
@@ -72,57 +77,113 @@ static int ttf_tx_frame(u8* frame_bits,u32 slot_i, slot_t * slot, tdma_t * tdma,
         frame_bits[bit_idx] = (tx_id_enc>>word_idx)&1;
     }
 
-    *uw_type = 1;
+    *uw_type = uw_data;
 
     return 1;
 }
 
-static void ttf_rx_frame(u8* frame_bits,u32 slot_i, slot_t * slot, tdma_t * tdma,u8 uw_type, void * cb_data){
-    tdma_test_framer * ttf = (tdma_test_framer*) cb_data;
-    if(ttf == NULL)
-        return;
-
+/* Decode a received frame. frame_sd is NULL for hard decisions only */
+static void ttf_rx_bits(tdma_test_framer * ttf, u8* frame_bits, float* frame_sd, u32 slot_i, u8 uw_type, int sso){
     int bit_idx = 0;
     int word_idx = 0;
     int rx_seq_enc = 0;
     int rx_id_enc = 0;
+    float rx_seq_rel[23];
+    float rx_id_rel[23];
 
     for(;bit_idx<23;bit_idx++,word_idx++){
         rx_seq_enc |= (frame_bits[bit_idx]?1:0)<<word_idx;
+        if(frame_sd != NULL)
+            rx_seq_rel[word_idx] = fabsf(frame_sd[bit_idx]);
     }
 
     word_idx = 0;
     bit_idx = 62;
     for(;word_idx<23;bit_idx++,word_idx++){
         rx_id_enc |= (frame_bits[bit_idx]?1:0)<<word_idx;
+        if(frame_sd != NULL)
+            rx_id_rel[word_idx] = fabsf(frame_sd[bit_idx]);
     }
 
-    int rx_seq_dec = golay23_decode(rx_seq_enc);
-    int rx_id_dec = golay23_decode(rx_id_enc);
-
-    int errs = golay23_count_errors(rx_seq_dec,rx_seq_enc);
-    errs += golay23_count_errors(rx_id_enc,rx_id_dec);
+    int rx_seq_dec,rx_id_dec;
+    int errs;
+    if(frame_sd != NULL){
+        /* Soft decode, using how sure the demod was of each bit */
+        int seq_errs,id_errs;
+        rx_seq_dec = golay23_decode_soft(rx_seq_enc,rx_seq_rel,&seq_errs);
+        rx_id_dec = golay23_decode_soft(rx_id_enc,rx_id_rel,&id_errs);
+        errs = seq_errs + id_errs;
+    }else{
+        rx_seq_dec = golay23_decode(rx_seq_enc);
+        rx_id_dec = golay23_decode(rx_id_enc);
+        errs = golay23_count_errors(rx_seq_dec,rx_seq_enc);
+        errs += golay23_count_errors(rx_id_enc,rx_id_dec);
+    }
 
     uint16_t rx_seq = (uint16_t)(rx_seq_dec>>11);
     uint16_t rx_id  = (uint16_t)(rx_id_dec>>11);
+
+    /* Noise that got past the UW check decodes to some ID nobody sent. Its 'errors'
+       aren't bit errors in a real frame, so keep it out of the BER */
+    if(rx_id < ttf->rx_id_min || rx_id > ttf->rx_id_max){
+        ttf->nframes_rx_false++;
+        if(ttf->print_enable)
+            fprintf(stdout,"Got false %s Frame seq %d id %d errs %d slt %d sso %d\n",uw_type==uw_data?"Data":"Voice",(int)rx_seq,(int)rx_id,errs,slot_i, sso);
+        return;
+    }
+
     ttf->rx_last_id = rx_id;
     ttf->rx_last_seq = rx_seq;
     ttf->rx_last_slot = slot_i;
     ttf->nbits_rx += 23*2;
     ttf->nbits_rx_err += errs;
+    ttf->nframes_rx++;
 
-    int sso = slot->slot_local_frame_offset;
     if(ttf->print_enable)
-        fprintf(stdout,"Got Frame seq %d id %d errs %d slt %d sso %d\n",(int)rx_seq,(int)rx_id,errs,slot_i, sso);    
+        fprintf(stdout,"Got %s Frame seq %d id %d errs %d slt %d sso %d\n",uw_type==uw_data?"Data":"Voice",(int)rx_seq,(int)rx_id,errs,slot_i, sso);    
+}
+
+static void ttf_rx_frame(u8* frame_bits,float* frame_sd,u32 slot_i, slot_t * slot, tdma_t * tdma,u8 uw_type, void * cb_data){
+    tdma_test_framer * ttf = (tdma_test_framer*) cb_data;
+    if(ttf == NULL)
+        return;
+
+    ttf_rx_bits(ttf,frame_bits,frame_sd,slot_i,uw_type,slot->slot_local_frame_offset);
+}
+
+int ttf_use_frame_ring(tdma_test_framer * ttf, size_t n_frames){
+    if(tdma_enable_frame_ring(ttf->tdma,n_frames))
+        return -1;
+    tdma_set_rx_soft_cb(ttf->tdma,NULL,NULL);
+    return 0;
+}
+
+int ttf_drain_frames(tdma_test_framer * ttf){
+    const struct TDMA_FRAME * frame;
+    int n = 0;
+    size_t i;
+
+    while((frame = tdma_frame_acquire(ttf->tdma)) != NULL){
+        u8 frame_bits[frame->n_bits];
+        for(i = 0; i < frame->n_bits; i++)
+            frame_bits[i] = (frame->frame_payload[i>>3] >> (7-(i&7))) & 1;
+        ttf_rx_bits(ttf,frame_bits,NULL,frame->slot_idx,frame->uw_type,frame->frame_offset);
+        tdma_frame_release(ttf->tdma);
+        n++;
+    }
+    return n;
 }
 
 tdma_test_framer * ttf_create(tdma_t * tdma){
     tdma_test_framer * ttf = malloc(sizeof(tdma_test_framer));
     golay23_init();
     /* Setup callbacks */
-    tdma_set_rx_cb(tdma,ttf_rx_frame,(void*)ttf);
+    tdma_set_rx_soft_cb(tdma,ttf_rx_frame,(void*)ttf);
     tdma_set_tx_cb(tdma,ttf_tx_frame,(void*)ttf);
     ttf->tdma = tdma;
+    /* Count every ID as real unless told otherwise */
+    ttf->rx_id_min = 0;
+    ttf->rx_id_max = 0xFFF;
     
     return ttf;
 }
@@ -132,7 +193,7 @@ void ttf_destroy(tdma_test_framer * ttf){
         return;
     
     /* Clear callbacks */
-    tdma_set_rx_cb(ttf->tdma,NULL,NULL);
+    tdma_set_rx_soft_cb(ttf->tdma,NULL,NULL);
     tdma_set_tx_cb(ttf->tdma,NULL,NULL);
 
     free(ttf);
@@ -149,4 +210,6 @@ void ttf_clear_counts(tdma_test_framer * ttf){
     ttf->nbits_rx_err = 0;
     ttf->nbits_tx = 0;
     ttf->tx_frame_count = 0;
+    ttf->nframes_rx = 0;
+    ttf->nframes_rx_false = 0;
 }
\ No newline at end of file
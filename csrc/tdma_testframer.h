@@ -51,6 +51,10 @@ typedef struct {
     uint32_t rx_last_slot;      //Last slot we got a valid RX from
     uint32_t rx_last_seq;       //Last sequence number from an RX slot
     uint32_t rx_last_id;        //Last ID from an rx slot
+    uint32_t nframes_rx;        //Number of rx'ed frames from an expected ID
+    uint32_t nframes_rx_false;  //Number of rx'ed frames with an ID outside rx_id_min..rx_id_max
+    uint16_t rx_id_min;         //Lowest ID a real frame can have
+    uint16_t rx_id_max;         //Highest ID a real frame can have
 
     uint16_t tx_seq;
     uint16_t tx_id;
@@ -66,4 +70,12 @@ tdma_test_framer * ttf_create(tdma_t * tdma);
 void ttf_destroy(tdma_test_framer * ttf);
 void ttf_clear_counts(tdma_test_framer * ttf);
 
+/* Take received frames from the modem's frame ring instead of an RX callback, so
+   they're decoded and printed by whoever calls ttf_drain_frames. They're hard
+   decoded, as the ring carries no soft decisions. Returns -1 on failure */
+int ttf_use_frame_ring(tdma_test_framer * ttf, size_t n_frames);
+
+/* Decode all the frames waiting in the frame ring. Returns how many there were */
+int ttf_drain_frames(tdma_test_framer * ttf);
+
 #endif
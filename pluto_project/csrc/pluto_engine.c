@@ -0,0 +1,391 @@
+/*---------------------------------------------------------------------------*\
+
+  FILE........: pluto_engine.c
+  AUTHOR......: Brady O'Brien
+  DATE CREATED: 19 October 2026
+
+  Runs an instance of TDMA on a PlutoSDR through libiio.
+
+  The RX thread refills libiio buffers and runs them through the CS16 front
+  end straight into blocks on a ring for the DSP loop. The DSP loop
+  (pluto_engine_loop, run by the caller) feeds the modem, whose TX bursts
+  go on a second ring. The TX thread pushes a libiio buffer every buffer
+  period, filling it with silence or with the part of a burst that falls in
+  it. All buffers are allocated up front; nothing is malloc'd or locked per
+  burst.
+
+\*---------------------------------------------------------------------------*/
+
+/*
+  Copyright (C) 2026 Brady O'Brien
+
+  All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License version 2.1, as
+  published by the Free Software Foundation.  This program is
+  distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include "pluto_engine.h"
+
+/* How long to sleep when a ring is empty */
+#define PLUTO_ENGINE_POLL_NS 200000
+
+/* Number of RX buffers' worth of blocks the RX ring can hold */
+#define PLUTO_ENGINE_RX_RING_BLOCKS 64
+
+/* Number of TX bursts that can be queued for the TX thread */
+#define PLUTO_ENGINE_TX_RING_BURSTS 16
+
+/* TX bursts go out this many modem samples early to line up with RX on the Pluto */
+#define PLUTO_ENGINE_TX_ADVANCE 55
+
+static void pluto_engine_sleep_poll(){
+    struct timespec ts = {0, PLUTO_ENGINE_POLL_NS};
+    nanosleep(&ts, NULL);
+}
+
+/* Called by the modem from the DSP loop when a burst is ready. Queue it for the TX thread */
+static int pluto_engine_cb_tx_burst(tdma_t * tdma,COMP* samples, size_t n_samples,i64 timestamp,void * cb_data){
+    pluto_engine_t * eng = (pluto_engine_t*) cb_data;
+
+    pluto_engine_tx_burst * burst = tdma_ring_write_acquire(eng->tx_ring);
+    if(burst == NULL){
+        atomic_fetch_add_explicit(&eng->tx_ring_drops, 1, memory_order_relaxed);
+        return -1;
+    }
+
+    if(n_samples > eng->tx_burst_samps)
+        n_samples = eng->tx_burst_samps;
+    burst->timestamp = timestamp;
+    burst->n_samps = n_samples;
+    memcpy(&burst->samps[0], samples, sizeof(COMP)*n_samples);
+    tdma_ring_write_commit(eng->tx_ring);
+    return 0;
+}
+
+pluto_engine_t * pluto_engine_create(struct iio_device * rx_dev, struct iio_device * tx_dev, tdma_t * tdma,
+                                        int rate_bb, float f_shift, float rx_scale, float tx_scale,
+                                        bool rx_only, int * err){
+    int rate_mdm = tdma->settings.samp_rate;
+    struct iio_channel * ch_q;
+
+    pluto_engine_t * eng = calloc(1, sizeof(pluto_engine_t));
+    if(eng == NULL){
+        if(err != NULL) *err = -1;
+        return NULL;
+    }
+
+    eng->rx_dev = rx_dev;
+    eng->tx_dev = tx_dev;
+    eng->tdma = tdma;
+    eng->f_shift = f_shift;
+    eng->rx_only_mode = rx_only;
+    eng->tx_advance = PLUTO_ENGINE_TX_ADVANCE;
+    atomic_init(&eng->running, false);
+
+    if(rate_bb % rate_mdm != 0){
+        fprintf(stderr,"Radio rate %d is not a multiple of modem rate %d\n",rate_bb,rate_mdm);
+        goto pluto_engine_create_err;
+    }
+    eng->rate_decim = rate_bb/rate_mdm;
+
+    eng->fe_rx = tdma_fe_rx_create(eng->rate_decim, f_shift, (float)rate_bb, rx_scale);
+    if(eng->fe_rx == NULL) goto pluto_engine_create_err;
+
+    eng->rx0_i = iio_device_find_channel(rx_dev, "voltage0", false);
+    ch_q = iio_device_find_channel(rx_dev, "voltage1", false);
+    if(eng->rx0_i == NULL || ch_q == NULL) goto pluto_engine_create_err;
+    iio_channel_enable(eng->rx0_i);
+    iio_channel_enable(ch_q);
+
+    eng->rxbuf = iio_device_create_buffer(rx_dev, PLUTO_ENGINE_BUF_SAMPS, false);
+    if(eng->rxbuf == NULL){
+        fprintf(stderr,"Could not create RX buffer: %s\n", strerror(errno));
+        goto pluto_engine_create_err;
+    }
+    iio_buffer_set_blocking_mode(eng->rxbuf, true);
+
+    eng->rx_block_samps = tdma_fe_rx_max_out(eng->fe_rx, PLUTO_ENGINE_BUF_SAMPS);
+    eng->rx_ring = tdma_ring_create(PLUTO_ENGINE_RX_RING_BLOCKS, sizeof(pluto_engine_rx_block) + sizeof(COMP)*eng->rx_block_samps);
+    if(eng->rx_ring == NULL) goto pluto_engine_create_err;
+
+    eng->rx_slot_buf = (COMP*) malloc(sizeof(COMP)*tdma_nin(tdma));
+    if(eng->rx_slot_buf == NULL) goto pluto_engine_create_err;
+
+    if(!rx_only){
+        eng->fe_tx = tdma_fe_tx_create(eng->rate_decim, f_shift, (float)rate_bb, tx_scale);
+        if(eng->fe_tx == NULL) goto pluto_engine_create_err;
+
+        eng->tx0_i = iio_device_find_channel(tx_dev, "voltage0", true);
+        ch_q = iio_device_find_channel(tx_dev, "voltage1", true);
+        if(eng->tx0_i == NULL || ch_q == NULL) goto pluto_engine_create_err;
+        iio_channel_enable(eng->tx0_i);
+        iio_channel_enable(ch_q);
+
+        eng->txbuf = iio_device_create_buffer(tx_dev, PLUTO_ENGINE_BUF_SAMPS, false);
+        if(eng->txbuf == NULL){
+            fprintf(stderr,"Could not create TX buffer: %s\n", strerror(errno));
+            goto pluto_engine_create_err;
+        }
+        iio_buffer_set_blocking_mode(eng->txbuf, true);
+
+        eng->tx_burst_samps = tdma_nout(tdma);
+        eng->tx_ring = tdma_ring_create(PLUTO_ENGINE_TX_RING_BURSTS, sizeof(pluto_engine_tx_burst) + sizeof(COMP)*eng->tx_burst_samps);
+        if(eng->tx_ring == NULL) goto pluto_engine_create_err;
+        tdma_set_tx_burst_cb(tdma,pluto_engine_cb_tx_burst,(void*)eng);
+    }
+
+    if(err != NULL) *err = 0;
+    return eng;
+
+    pluto_engine_create_err:
+    if(err != NULL) *err = -1;
+    pluto_engine_destroy(eng);
+    return NULL;
+}
+
+void pluto_engine_destroy(pluto_engine_t * eng){
+    if(eng == NULL)
+        return;
+
+    if(eng->threads_started)
+        pluto_engine_stop(eng);
+
+    if(eng->tx_ring != NULL)
+        tdma_set_tx_burst_cb(eng->tdma,NULL,NULL);
+
+    if(eng->rxbuf != NULL) iio_buffer_destroy(eng->rxbuf);
+    if(eng->txbuf != NULL) iio_buffer_destroy(eng->txbuf);
+    tdma_fe_rx_destroy(eng->fe_rx);
+    tdma_fe_tx_destroy(eng->fe_tx);
+    tdma_ring_destroy(eng->rx_ring);
+    tdma_ring_destroy(eng->tx_ring);
+    free(eng->rx_slot_buf);
+    free(eng);
+}
+
+/* RX thread. Refill from the radio, downconvert, decimate, and pass blocks on to the DSP loop */
+static void * pluto_engine_rx_thread(void * arg){
+    pluto_engine_t * eng = (pluto_engine_t*) arg;
+    i64 rx_count = 0;
+    bool discont = false;
+
+    COMP * drop_buf = (COMP*) malloc(sizeof(COMP)*eng->rx_block_samps);
+    if(drop_buf == NULL){
+        fprintf(stderr,"RX thread couldn't allocate buffers\n");
+        return NULL;
+    }
+
+    while(atomic_load_explicit(&eng->running, memory_order_relaxed)){
+        ssize_t ret = iio_buffer_refill(eng->rxbuf);
+        if(ret == -EAGAIN)
+            continue;
+        if(ret < 0){
+            /* The buffer's samples are gone, but their time still passed */
+            atomic_fetch_add_explicit(&eng->rx_errors, 1, memory_order_relaxed);
+            rx_count += PLUTO_ENGINE_BUF_SAMPS/eng->rate_decim;
+            discont = true;
+            pluto_engine_sleep_poll();
+            continue;
+        }
+
+        uint8_t * p_dat = iio_buffer_first(eng->rxbuf, eng->rx0_i);
+        uint8_t * p_end = iio_buffer_end(eng->rxbuf);
+        size_t p_samps = (p_end - p_dat)/iio_buffer_step(eng->rxbuf);
+        atomic_fetch_add_explicit(&eng->rx_samps, p_samps, memory_order_relaxed);
+
+        pluto_engine_rx_block * block = tdma_ring_write_acquire(eng->rx_ring);
+        if(block == NULL){
+            /* DSP loop is behind; drop this block but keep the filter state going */
+            rx_count += tdma_fe_rx_cs16(eng->fe_rx, (int16_t*)p_dat, p_samps, drop_buf);
+            atomic_fetch_add_explicit(&eng->rx_ring_drops, 1, memory_order_relaxed);
+            discont = true;
+            continue;
+        }
+
+        size_t n = tdma_fe_rx_cs16(eng->fe_rx, (int16_t*)p_dat, p_samps, &block->samps[0]);
+        block->timestamp = rx_count;
+        block->n_samps = n;
+        block->flags = discont ? PLUTO_ENGINE_BLOCK_DISCONT : 0;
+        discont = false;
+        rx_count += n;
+        tdma_ring_write_commit(eng->rx_ring);
+    }
+
+    free(drop_buf);
+    return NULL;
+}
+
+/* TX thread. Push a buffer to the radio every buffer period, with any burst that falls in it */
+static void * pluto_engine_tx_thread(void * arg){
+    pluto_engine_t * eng = (pluto_engine_t*) arg;
+    const int rate_decim = eng->rate_decim;
+    const size_t samp_size = 2*sizeof(int16_t);
+    i64 tx_samp_count = 0;
+
+    /* Current burst, already interpolated and converted to CS16 */
+    int16_t * burst_buf = (int16_t*) malloc(samp_size * eng->tx_burst_samps * rate_decim);
+    int16_t * burst_ptr = NULL;
+    size_t burst_samps = 0;
+    i64 burst_start = 0;
+    bool have_burst = false;
+
+    if(burst_buf == NULL){
+        fprintf(stderr,"TX thread couldn't allocate buffers\n");
+        return NULL;
+    }
+
+    while(atomic_load_explicit(&eng->running, memory_order_relaxed)){
+        /* If no burst is pending, take the next one off the ring */
+        if(!have_burst){
+            pluto_engine_tx_burst * burst = tdma_ring_read_acquire(eng->tx_ring);
+            if(burst != NULL){
+                burst_samps = tdma_fe_tx_cs16(eng->fe_tx, &burst->samps[0], burst->n_samps, burst_buf);
+                burst_start = (burst->timestamp - eng->tx_advance) * rate_decim;
+                burst_ptr = burst_buf;
+                have_burst = true;
+                tdma_ring_read_release(eng->tx_ring);
+            }
+        }
+
+        uint8_t * p_dat = iio_buffer_first(eng->txbuf, eng->tx0_i);
+        uint8_t * p_end = iio_buffer_end(eng->txbuf);
+        ptrdiff_t p_inc = iio_buffer_step(eng->txbuf);
+        size_t p_samps = (p_end - p_dat)/p_inc;
+
+        if(have_burst && burst_start < tx_samp_count){
+            /* Burst is already too old to send */
+            atomic_fetch_add_explicit(&eng->tx_late, 1, memory_order_relaxed);
+            have_burst = false;
+        }
+
+        if(!have_burst || burst_start >= tx_samp_count + (i64)p_samps){
+            /* Nothing to send in this buffer */
+            memset(p_dat, 0, p_end-p_dat);
+        }else{
+            /* This buffer will contain some of the burst */
+            size_t start_off = (size_t)(burst_start - tx_samp_count);
+            size_t n = p_samps - start_off;
+            if(n > burst_samps)
+                n = burst_samps;
+
+            memset(p_dat, 0, p_inc*start_off);
+            memcpy(p_dat + p_inc*start_off, burst_ptr, samp_size*n);
+            memset(p_dat + p_inc*(start_off+n), 0, p_inc*(p_samps-start_off-n));
+
+            burst_start += n;
+            burst_ptr += 2*n;
+            burst_samps -= n;
+            if(burst_samps == 0){
+                have_burst = false;
+                atomic_fetch_add_explicit(&eng->tx_bursts, 1, memory_order_relaxed);
+            }
+        }
+
+        if(iio_buffer_push(eng->txbuf) < 0)
+            atomic_fetch_add_explicit(&eng->tx_errors, 1, memory_order_relaxed);
+        tx_samp_count += p_samps;
+    }
+
+    free(burst_buf);
+    return NULL;
+}
+
+int pluto_engine_start(pluto_engine_t * eng){
+    if(eng->threads_started)
+        return 0;
+
+    atomic_store(&eng->running, true);
+    if(pthread_create(&eng->rx_thread, NULL, pluto_engine_rx_thread, (void*)eng)){
+        atomic_store(&eng->running, false);
+        return -1;
+    }
+    if(!eng->rx_only_mode){
+        if(pthread_create(&eng->tx_thread, NULL, pluto_engine_tx_thread, (void*)eng)){
+            atomic_store(&eng->running, false);
+            pthread_join(eng->rx_thread, NULL);
+            return -1;
+        }
+    }
+    eng->threads_started = true;
+    return 0;
+}
+
+int pluto_engine_stop(pluto_engine_t * eng){
+    if(!eng->threads_started)
+        return 0;
+
+    atomic_store(&eng->running, false);
+    pthread_join(eng->rx_thread, NULL);
+    if(!eng->rx_only_mode)
+        pthread_join(eng->tx_thread, NULL);
+    eng->threads_started = false;
+    return 0;
+}
+
+int pluto_engine_loop(pluto_engine_t * eng){
+    size_t nin = tdma_nin(eng->tdma);
+    size_t fill = 0;
+    i64 slot_ts = 0;
+
+    while(fill < nin){
+        if(eng->rx_cur == NULL){
+            eng->rx_cur = tdma_ring_read_acquire(eng->rx_ring);
+            eng->rx_cur_off = 0;
+            if(eng->rx_cur == NULL){
+                if(!atomic_load_explicit(&eng->running, memory_order_relaxed))
+                    return -1;
+                pluto_engine_sleep_poll();
+                continue;
+            }
+        }
+
+        pluto_engine_rx_block * block = eng->rx_cur;
+        /* Samples were lost before this block; the partial slot isn't contiguous, so start again from here */
+        if(eng->rx_cur_off == 0 && (block->flags & PLUTO_ENGINE_BLOCK_DISCONT) && fill > 0){
+            atomic_fetch_add_explicit(&eng->rx_slot_discards, 1, memory_order_relaxed);
+            fill = 0;
+        }
+        if(fill == 0)
+            slot_ts = block->timestamp + eng->rx_cur_off;
+
+        size_t n = block->n_samps - eng->rx_cur_off;
+        if(n > (nin-fill))
+            n = nin-fill;
+        memcpy(&eng->rx_slot_buf[fill], &block->samps[eng->rx_cur_off], sizeof(COMP)*n);
+        fill += n;
+        eng->rx_cur_off += n;
+
+        if(eng->rx_cur_off >= block->n_samps){
+            tdma_ring_read_release(eng->rx_ring);
+            eng->rx_cur = NULL;
+        }
+    }
+
+    tdma_rx(eng->tdma, eng->rx_slot_buf, slot_ts);
+    return 0;
+}
+
+void pluto_engine_get_stats(pluto_engine_t * eng, struct PLUTO_ENGINE_STATS * stats){
+    stats->rx_samps = atomic_load_explicit(&eng->rx_samps, memory_order_relaxed);
+    stats->rx_ring_drops = atomic_load_explicit(&eng->rx_ring_drops, memory_order_relaxed);
+    stats->rx_errors = atomic_load_explicit(&eng->rx_errors, memory_order_relaxed);
+    stats->rx_slot_discards = atomic_load_explicit(&eng->rx_slot_discards, memory_order_relaxed);
+    stats->tx_bursts = atomic_load_explicit(&eng->tx_bursts, memory_order_relaxed);
+    stats->tx_late = atomic_load_explicit(&eng->tx_late, memory_order_relaxed);
+    stats->tx_ring_drops = atomic_load_explicit(&eng->tx_ring_drops, memory_order_relaxed);
+    stats->tx_errors = atomic_load_explicit(&eng->tx_errors, memory_order_relaxed);
+}
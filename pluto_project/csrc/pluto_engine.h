@@ -0,0 +1,140 @@
+/*---------------------------------------------------------------------------*\
+
+  FILE........: pluto_engine.h
+  AUTHOR......: Brady O'Brien
+  DATE CREATED: 19 October 2026
+
+  Runs an instance of TDMA on a PlutoSDR through libiio, with radio I/O on
+  its own threads
+
+\*---------------------------------------------------------------------------*/
+
+/*
+  Copyright (C) 2026 Brady O'Brien
+
+  All rights reserved.
+
+  This program is free software; you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License version 2.1, as
+  published by the Free Software Foundation.  This program is
+  distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or
+  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+  License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __PLUTO_ENGINE_H
+#define __PLUTO_ENGINE_H
+
+#include <iio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include "freedv-tdma/tdma.h"
+#include "freedv-tdma/tdma_ring.h"
+#include "tdma_frontend.h"
+
+/* Samples per libiio buffer, at the radio rate */
+#define PLUTO_ENGINE_BUF_SAMPS 4096
+
+/* Flag set on an RX block if samples were lost before it */
+#define PLUTO_ENGINE_BLOCK_DISCONT 0x1
+
+/* Modem-rate samples decimated from one libiio RX buffer */
+typedef struct {
+    i64 timestamp;                  /* Modem sample count of samps[0] */
+    u32 n_samps;                    /* Number of valid samples */
+    u32 flags;                      /* PLUTO_ENGINE_BLOCK_* flags */
+    COMP samps[];
+} pluto_engine_rx_block;
+
+/* Burst of modem-rate samples passed from the DSP loop to the TX thread */
+typedef struct {
+    i64 timestamp;                  /* Time to start the burst, in modem sample periods */
+    u32 n_samps;                    /* Number of valid samples */
+    COMP samps[];
+} pluto_engine_tx_burst;
+
+/* Counters kept by the radio I/O threads */
+struct PLUTO_ENGINE_STATS {
+    u64 rx_samps;                   /* Radio samples read */
+    u64 rx_ring_drops;              /* RX blocks dropped because the DSP loop fell behind */
+    u64 rx_errors;                  /* Errors from iio_buffer_refill */
+    u64 rx_slot_discards;           /* Partial slots thrown away because samples were lost under them */
+    u64 tx_bursts;                  /* Bursts sent to the radio */
+    u64 tx_late;                    /* Bursts dropped because their start time had passed */
+    u64 tx_ring_drops;              /* Bursts dropped because the TX thread fell behind */
+    u64 tx_errors;                  /* Errors from iio_buffer_push */
+};
+
+typedef struct {
+    struct iio_device * rx_dev;     /* cf-ad9361-lpc */
+    struct iio_device * tx_dev;     /* cf-ad9361-dds-core-lpc */
+    struct iio_channel * rx0_i;
+    struct iio_channel * tx0_i;
+    struct iio_buffer * rxbuf;
+    struct iio_buffer * txbuf;
+    bool rx_only_mode;              /* Flag set if this modem is only rx-ing TDMA frames */
+    tdma_t * tdma;                  /* TDMA modem */
+
+    int rate_decim;                 /* Radio rate / modem rate */
+    float f_shift;                  /* Frequency shift */
+    int tx_advance;                 /* Modem samples to start TX bursts early by, to line up with RX */
+    tdma_fe_rx_t * fe_rx;           /* CS16 radio -> TDMA front end, owned by RX thread */
+    tdma_fe_tx_t * fe_tx;           /* TDMA -> CS16 radio front end, owned by TX thread */
+
+    /* Threading */
+    pthread_t rx_thread;            /* Refills RX buffers, decimates, and fills rx_ring */
+    pthread_t tx_thread;            /* Drains tx_ring, interpolates, and pushes TX buffers */
+    atomic_bool running;            /* Cleared to stop the I/O threads */
+    bool threads_started;
+
+    tdma_ring_t * rx_ring;          /* pluto_engine_rx_block, RX thread -> DSP loop */
+    tdma_ring_t * tx_ring;          /* pluto_engine_tx_burst, DSP loop -> TX thread */
+    size_t rx_block_samps;          /* Capacity of an RX block, in modem samples */
+    size_t tx_burst_samps;          /* Capacity of a TX burst, in modem samples */
+
+    /* DSP loop state */
+    COMP * rx_slot_buf;             /* One slot's worth of modem samples */
+    pluto_engine_rx_block * rx_cur; /* Partially consumed RX block */
+    u32 rx_cur_off;                 /* Samples of rx_cur already consumed */
+
+    /* Counters, updated by the I/O threads */
+    _Atomic u64 rx_samps;
+    _Atomic u64 rx_ring_drops;
+    _Atomic u64 rx_errors;
+    _Atomic u64 rx_slot_discards;   /* Updated by the DSP loop */
+    _Atomic u64 tx_bursts;
+    _Atomic u64 tx_late;
+    _Atomic u64 tx_ring_drops;
+    _Atomic u64 tx_errors;
+} pluto_engine_t;
+
+/*
+ * Set up buffers, front ends, and rings for a TDMA modem. The devices must
+ * already be tuned and set to rate_bb. rx_scale and tx_scale convert
+ * between CS16 and the modem's float samples.
+ */
+pluto_engine_t * pluto_engine_create(struct iio_device * rx_dev, struct iio_device * tx_dev, tdma_t * tdma,
+                                        int rate_bb, float f_shift, float rx_scale, float tx_scale,
+                                        bool rx_only, int * err);
+void pluto_engine_destroy(pluto_engine_t * eng);
+
+/* Start the I/O threads */
+int pluto_engine_start(pluto_engine_t * eng);
+
+/* Stop the I/O threads */
+int pluto_engine_stop(pluto_engine_t * eng);
+
+/* Wait for one slot of samples from the RX thread and run it through the modem.
+   Returns 0 on success, -1 if the engine has been stopped */
+int pluto_engine_loop(pluto_engine_t * eng);
+
+/* Get a snapshot of the I/O thread counters */
+void pluto_engine_get_stats(pluto_engine_t * eng, struct PLUTO_ENGINE_STATS * stats);
+
+#endif